@@ -0,0 +1,339 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "ApiStream.h"
+
+/** @brief Constructor.
+ *  @param source ApiFieldSource_t, Fields source.
+ *  @param format uint8_t, Output format.
+ *  @return ApiStream
+ */
+ApiStream::ApiStream(ApiFieldSource_t source, uint8_t format)
+{
+	m_source = source;
+	m_format = format;
+}
+
+/** @brief Append text to the current group.
+ *  @param text const char*, Text.
+ *  @param length size_t, Text length.
+ *  @return bool, True if it fits.
+ */
+bool ApiStream::append(const char* text, size_t length)
+{
+	if (m_overflow || (m_lineLength + length > API_STREAM_LINE_SIZE))
+	{
+		m_overflow = true;
+		return false;
+	}
+
+	memcpy(m_line + m_lineLength, text, length);
+	m_lineLength += length;
+
+	return true;
+}
+
+/** @brief Append JSON escaped string in quotes.
+ *  @param text const char*, Text.
+ *  @return bool, True if it fits.
+ */
+bool ApiStream::appendEscaped(const char* text)
+{
+	char EscapeL[7];
+
+	append("\"", 1);
+
+	for (; *text != '\0'; text++)
+	{
+		uint8_t SymbolL = (uint8_t)*text;
+
+		if ((SymbolL == '"') || (SymbolL == '\\'))
+		{
+			EscapeL[0] = '\\';
+			EscapeL[1] = (char)SymbolL;
+			append(EscapeL, 2);
+		}
+		else if (SymbolL < 0x20)
+		{
+			snprintf(EscapeL, sizeof(EscapeL), "\\u%04x", SymbolL);
+			append(EscapeL, 6);
+		}
+		else
+		{
+			append(text, 1);
+		}
+	}
+
+	return append("\"", 1);
+}
+
+/** @brief Append bracket, uses the reserved room.
+ *  @param symbol char, Bracket.
+ *  @return Void.
+ */
+void ApiStream::put(char symbol)
+{
+	m_line[m_lineLength++] = symbol;
+}
+
+/** @brief Append the key part of a field.
+ *  @param key const char*, Field key.
+ *  @return bool, True if it fits.
+ */
+bool ApiStream::appendKey(const char* key)
+{
+	if (m_format == ApiFormatLegacy)
+	{
+		append(key, strlen(key));
+		return append("|", 1);
+	}
+
+	if (m_fields > 0)
+	{
+		append(",", 1);
+	}
+
+	appendEscaped(key);
+	return append(":", 1);
+}
+
+/** @brief Append the closing part of a field.
+ *  @param type const char*, Field type.
+ *  @param mark size_t, Group length before the field.
+ *  @return Void.
+ */
+void ApiStream::appendEnd(const char* type, size_t mark)
+{
+	if (m_format == ApiFormatLegacy)
+	{
+		append("|", 1);
+		append(type, strlen(type));
+		append("\n", 1);
+	}
+
+	// Field that does not fit is dropped as whole.
+	if (m_overflow)
+	{
+		m_lineLength = mark;
+		m_overflow = false;
+		return;
+	}
+
+	m_fields++;
+}
+
+/** @brief Write text field.
+ *  @param key const char*, Field key.
+ *  @param value const char*, Field value.
+ *  @param type const char*, Field type of the legacy format.
+ *  @return Void.
+ */
+void ApiStream::field(const char* key, const char* value, const char* type)
+{
+	size_t MarkL = m_lineLength;
+
+	appendKey(key);
+
+	if (m_format == ApiFormatLegacy)
+	{
+		append(value, strlen(value));
+	}
+	else
+	{
+		appendEscaped(value);
+	}
+
+	appendEnd(type, MarkL);
+}
+
+/** @brief Write number field.
+ *  @param key const char*, Field key.
+ *  @param value long, Field value.
+ *  @param type const char*, Field type of the legacy format.
+ *  @return Void.
+ */
+void ApiStream::field(const char* key, long value, const char* type)
+{
+	size_t MarkL = m_lineLength;
+	char NumberL[12];
+	int LengthL = snprintf(NumberL, sizeof(NumberL), "%ld", value);
+
+	appendKey(key);
+	append(NumberL, LengthL);
+	appendEnd(type, MarkL);
+}
+
+/** @brief Write IP address field as text.
+ *  @param key const char*, Field key.
+ *  @param value IPAddress, Field value.
+ *  @param type const char*, Field type of the legacy format.
+ *  @return Void.
+ */
+void ApiStream::field(const char* key, const IPAddress& value, const char* type)
+{
+	char AddressL[16];
+
+	snprintf(AddressL, sizeof(AddressL), "%u.%u.%u.%u", value[0], value[1], value[2], value[3]);
+	field(key, AddressL, type);
+}
+
+/** @brief Write flag field. Legacy format writes "checked" or nothing.
+ *  @param key const char*, Field key.
+ *  @param value bool, Field value.
+ *  @param type const char*, Field type of the legacy format.
+ *  @return Void.
+ */
+void ApiStream::flag(const char* key, bool value, const char* type)
+{
+	size_t MarkL = m_lineLength;
+	const char* TextL;
+
+	if (m_format == ApiFormatLegacy)
+	{
+		TextL = value ? "checked" : "";
+	}
+	else
+	{
+		TextL = value ? "true" : "false";
+	}
+
+	appendKey(key);
+	append(TextL, strlen(TextL));
+	appendEnd(type, MarkL);
+}
+
+/** @brief Build the next group in the line buffer.
+ *  @return Void.
+ */
+void ApiStream::next()
+{
+	m_lineLength = 0;
+	m_linePosition = 0;
+
+	if (m_done)
+	{
+		return;
+	}
+
+	// Opening goes with the first group.
+	if (m_index == 0)
+	{
+		if (m_format == ApiFormatObject)
+		{
+			put('{');
+		}
+		else if (m_format == ApiFormatArray)
+		{
+			put('[');
+		}
+	}
+
+	size_t MarkL = m_lineLength;
+
+	if (m_format == ApiFormatArray)
+	{
+		if (m_groups > 0)
+		{
+			put(',');
+		}
+
+		put('{');
+		m_fields = 0;
+	}
+
+	if (m_source(*this, m_index++))
+	{
+		if (m_format == ApiFormatArray)
+		{
+			put('}');
+		}
+
+		m_groups++;
+		return;
+	}
+
+	// No more groups, close instead.
+	m_done = true;
+	m_lineLength = MarkL;
+
+	if (m_format == ApiFormatObject)
+	{
+		put('}');
+	}
+	else if (m_format == ApiFormatArray)
+	{
+		put(']');
+	}
+}
+
+/** @brief Fill the response buffer.
+ *  @param buffer uint8_t*, Target buffer.
+ *  @param size size_t, Target size.
+ *  @return size_t, Written bytes, 0 at the end.
+ */
+size_t ApiStream::read(uint8_t* buffer, size_t size)
+{
+	size_t WrittenL = 0;
+
+	while (WrittenL < size)
+	{
+		if (m_linePosition >= m_lineLength)
+		{
+			if (m_done)
+			{
+				break;
+			}
+
+			next();
+			continue;
+		}
+
+		size_t ChunkL = m_lineLength - m_linePosition;
+		if (ChunkL > size - WrittenL)
+		{
+			ChunkL = size - WrittenL;
+		}
+
+		memcpy(buffer + WrittenL, m_line + m_linePosition, ChunkL);
+		m_linePosition += ChunkL;
+		WrittenL += ChunkL;
+	}
+
+	return WrittenL;
+}
+
+/** @brief Content type of the format.
+ *  @param format uint8_t, Output format.
+ *  @return const char*, Content type.
+ */
+const char* ApiStream::contentType(uint8_t format)
+{
+	if (format == ApiFormatLegacy)
+	{
+		return "text/plain";
+	}
+
+	return "application/json";
+}
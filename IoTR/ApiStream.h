@@ -0,0 +1,202 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// ApiStream.h
+
+#ifndef _APISTREAM_h
+#define _APISTREAM_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include <IPAddress.h>
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef API_STREAM_LINE_SIZE
+/** @brief Size of the buffer for one group of fields. */
+#define API_STREAM_LINE_SIZE 256
+#endif // !API_STREAM_LINE_SIZE
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Output formats. */
+enum ApiStreamFormat : uint8_t
+{
+	ApiFormatLegacy = 0, ///< "key|value|type\n" lines.
+	ApiFormatObject, ///< One JSON object of all fields.
+	ApiFormatArray, ///< JSON array of one object per group.
+};
+
+class ApiStream;
+
+/** @brief Fields source. Writes group of fields by index.
+ *  @param stream ApiStream, Target stream.
+ *  @param index size_t, Group index.
+ *  @return bool, False when there are no more groups.
+ */
+typedef bool(*ApiFieldSource_t)(ApiStream& stream, size_t index);
+
+#pragma endregion
+
+/** @brief Streaming writer of the API responses.
+ *
+ *  Pulls the fields group by group from the source while the server fills
+ *  the TCP send buffer, so only one group is held in RAM at any time.
+ */
+class ApiStream
+{
+protected:
+
+	/** @brief Fields source. */
+	ApiFieldSource_t m_source;
+
+	/** @brief Output format. */
+	uint8_t m_format;
+
+	/** @brief Next group index. */
+	size_t m_index = 0;
+
+	/** @brief Written fields in the current object. */
+	size_t m_fields = 0;
+
+	/** @brief Written groups. */
+	size_t m_groups = 0;
+
+	/** @brief Source is done. */
+	bool m_done = false;
+
+	/** @brief Current group does not fit. */
+	bool m_overflow = false;
+
+	/** @brief Current group text, with room for the closing brackets. */
+	char m_line[API_STREAM_LINE_SIZE + 4];
+
+	/** @brief Current group length. */
+	size_t m_lineLength = 0;
+
+	/** @brief Sent part of the current group. */
+	size_t m_linePosition = 0;
+
+	/** @brief Append text to the current group.
+	 *  @param text const char*, Text.
+	 *  @param length size_t, Text length.
+	 *  @return bool, True if it fits.
+	 */
+	bool append(const char* text, size_t length);
+
+	/** @brief Append JSON escaped string in quotes.
+	 *  @param text const char*, Text.
+	 *  @return bool, True if it fits.
+	 */
+	bool appendEscaped(const char* text);
+
+	/** @brief Append bracket, uses the reserved room.
+	 *  @param symbol char, Bracket.
+	 *  @return Void.
+	 */
+	void put(char symbol);
+
+	/** @brief Append the key part of a field.
+	 *  @param key const char*, Field key.
+	 *  @return bool, True if it fits.
+	 */
+	bool appendKey(const char* key);
+
+	/** @brief Append the closing part of a field.
+	 *  @param type const char*, Field type.
+	 *  @param mark size_t, Group length before the field.
+	 *  @return Void.
+	 */
+	void appendEnd(const char* type, size_t mark);
+
+	/** @brief Build the next group in the line buffer.
+	 *  @return Void.
+	 */
+	void next();
+
+public:
+
+	/** @brief Constructor.
+	 *  @param source ApiFieldSource_t, Fields source.
+	 *  @param format uint8_t, Output format.
+	 *  @return ApiStream
+	 */
+	ApiStream(ApiFieldSource_t source, uint8_t format);
+
+	/** @brief Write text field.
+	 *  @param key const char*, Field key.
+	 *  @param value const char*, Field value.
+	 *  @param type const char*, Field type of the legacy format.
+	 *  @return Void.
+	 */
+	void field(const char* key, const char* value, const char* type);
+
+	/** @brief Write number field.
+	 *  @param key const char*, Field key.
+	 *  @param value long, Field value.
+	 *  @param type const char*, Field type of the legacy format.
+	 *  @return Void.
+	 */
+	void field(const char* key, long value, const char* type);
+
+	/** @brief Write IP address field as text.
+	 *  @param key const char*, Field key.
+	 *  @param value IPAddress, Field value.
+	 *  @param type const char*, Field type of the legacy format.
+	 *  @return Void.
+	 */
+	void field(const char* key, const IPAddress& value, const char* type);
+
+	/** @brief Write flag field. Legacy format writes "checked" or nothing.
+	 *  @param key const char*, Field key.
+	 *  @param value bool, Field value.
+	 *  @param type const char*, Field type of the legacy format.
+	 *  @return Void.
+	 */
+	void flag(const char* key, bool value, const char* type);
+
+	/** @brief Fill the response buffer.
+	 *  @param buffer uint8_t*, Target buffer.
+	 *  @param size size_t, Target size.
+	 *  @return size_t, Written bytes, 0 at the end.
+	 */
+	size_t read(uint8_t* buffer, size_t size);
+
+	/** @brief Content type of the format.
+	 *  @param format uint8_t, Output format.
+	 *  @return const char*, Content type.
+	 */
+	static const char* contentType(uint8_t format);
+};
+
+#endif
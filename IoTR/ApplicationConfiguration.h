@@ -73,6 +73,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 /** @brief Enable rescue button. */
 #define ENABLE_RESCUE_BTN
 
+/** @brief Enable serial out flow control messages. */
+#define ENABLE_SERIAL_FLOW_CONTROL
+
+/** @brief Enable execution time profiler of the main loop sections. */
+#define ENABLE_LOOP_PROFILER
+
 #ifndef ARDUINO_ESP8266_NODEMCU
 static const uint8_t D1 = 5;
 static const uint8_t D2 = 4;
@@ -81,6 +87,25 @@ static const uint8_t D3 = 0;
 
 #pragma endregion
 
+#pragma region Scheduler Configuration
+
+/** @brief Maximum count of the scheduled tasks. */
+#define SCHEDULER_MAX_TASKS 8
+
+/** @brief Period of the WiFi and MQTT upkeep, NTP, batches and offline queue [ms]. */
+#define NETWORK_UPDATE_TIME 10UL
+
+/** @brief Run time budget of the network task [us]. */
+#define NETWORK_TASK_BUDGET 5000UL
+
+/** @brief Run time budget of the device status task [us]. */
+#define STATUS_TASK_BUDGET 5000UL
+
+/** @brief Run time budget of the device state task [us]. */
+#define STATE_TASK_BUDGET 2000UL
+
+#pragma endregion
+
 #pragma region Device Configuration
 
 /** @brief Default STA SSID. */
@@ -95,6 +120,12 @@ static const uint8_t D3 = 0;
 /** @brief Serial port. */
 #define COM_PORT Serial
 
+/** @brief Default serial frame delimiter. */
+#define DEFAULT_SERIAL_FRAME_DELIMITER '\n'
+
+/** @brief Default and minimum idle gap that closes a serial frame [us]. */
+#define DEFAULT_SERIAL_FRAME_IDLE_GAP 1000UL
+
 #pragma endregion
 
 #pragma region Debug Terminal Configuration
@@ -122,12 +153,27 @@ static const uint8_t D3 = 0;
 /** @brief Enable editor WEB editor. */
 #define ENABLE_EDITOR
 
-/** @brief Stay connected time to the WEB server. */
+/** @brief Stay connected time to the WEB server, a session expires after it without requests. */
 #define ALIVE_TIME 300 // 300s -> 5min
 
+/** @brief Maximum count of the logged in sessions. */
+#define SESSION_MAX_COUNT 4
+
 /** @brief WEB socket maximum queue messages. */
 #define WS_MAX_QUEUED_MESSAGES 12
 
+/** @brief Maximum count of the event source clients. */
+#define EVENT_FANOUT_MAX_CLIENTS 4
+
+/** @brief Queued messages of a client, above it the client gets only the latest events. */
+#define EVENT_FANOUT_MAX_BACKLOG 4
+
+/** @brief Time a client may stay above the backlog limit before it is closed [ms]. */
+#define EVENT_FANOUT_STALL_TIMEOUT 10000UL
+
+/** @brief Cache lifetime of the PROGMEM images [s], the rest is revalidated by ETag. */
+#define STATIC_ASSET_MAX_AGE 86400
+
 #pragma endregion
 
 #pragma region AP Configuration
@@ -148,6 +194,18 @@ static const uint8_t D3 = 0;
 /** @brief Default STA password. */
 #define DEFAULT_STA_PASSWORD "YOUR_DEFAULT_WIFI_PASS"
 
+/** @brief First WiFi reconnect delay [ms]. */
+#define WIFI_RECONNECT_MIN_DELAY 1000UL
+
+/** @brief Maximum WiFi reconnect delay [ms]. */
+#define WIFI_RECONNECT_MAX_DELAY 60000UL
+
+/** @brief WiFi reconnect delay jitter [%]. */
+#define WIFI_RECONNECT_JITTER 25
+
+/** @brief Minimum time between two WiFi scans, shared by all clients [ms]. */
+#define WIFI_SCAN_MIN_INTERVAL 30000UL
+
 /** @brief Default enabled DHCP client. */
 #define DEFAULT_ENABLED_DHCP 1
 
@@ -187,15 +245,76 @@ static const uint8_t D3 = 0;
 #define DEFAULT_MQTT_PASS ""
 #define MQTT_HEARTBEAT_TIME 5000UL
 
+/** @brief Device status sampling period, changes are published after each sample [ms]. */
+#define DEVICE_STATUS_SAMPLE_TIME 1000UL
+
+/** @brief Minimum time between two device state changes [ms]. */
+#define DEVICE_STATE_MIN_INTERVAL 50UL
+
+/** @brief Period of the full device state [ms]. */
+#define DEVICE_STATE_KEYFRAME_TIME 1000UL
+
+/** @brief Period of the loop profile message, zero to disable [ms]. */
+#define PROFILE_PUBLISH_TIME 60000UL
+
+/** @brief First MQTT reconnect delay [ms]. */
+#define MQTT_RECONNECT_MIN_DELAY 2000UL
+
+/** @brief Maximum MQTT reconnect delay [ms]. */
+#define MQTT_RECONNECT_MAX_DELAY 120000UL
+
+/** @brief MQTT reconnect delay jitter [%]. */
+#define MQTT_RECONNECT_JITTER 25
+
+/** @brief Default serial frames batching state. */
+#define DEFAULT_MQTT_BATCH false
+
+/** @brief Default byte budget of one batch payload. */
+#define DEFAULT_MQTT_BATCH_SIZE 1024
+
+/** @brief Default batch flush interval [ms]. */
+#define DEFAULT_MQTT_BATCH_INTERVAL 250
+
+/** @brief Default QoS of the serial data publish. */
+#define DEFAULT_MQTT_SERIAL_QOS 2
+
+/** @brief Default retain of the serial data publish. */
+#define DEFAULT_MQTT_SERIAL_RETAIN true
+
+/** @brief Default QoS of the status publish. */
+#define DEFAULT_MQTT_STATUS_QOS 0
+
+/** @brief Default retain of the status publish. */
+#define DEFAULT_MQTT_STATUS_RETAIN true
+
+/** @brief Default QoS of the command subscriptions. */
+#define DEFAULT_MQTT_COMMAND_QOS 2
+
+/** @brief JSON payload encoding. */
+#define MQTT_ENCODING_JSON 0
+
+/** @brief MessagePack payload encoding. */
+#define MQTT_ENCODING_MSGPACK 1
+
+/** @brief Default payload encoding of the status and serial data. */
+#define DEFAULT_MQTT_ENCODING MQTT_ENCODING_JSON
+
 // oraganization/product/hostname/function/subfunction
-#define TOPIC_SER_OUT String(String("roboleague/iotr/") + NetworkConfiguration.Hostname + String("/serial/out")).c_str()
-#define TOPIC_SER_IN String(String("roboleague/iotr/") + NetworkConfiguration.Hostname + String("/serial/in")).c_str()
-#define TOPIC_STAT String(String("roboleague/iotr/") + NetworkConfiguration.Hostname + String("/status")).c_str()
-#define TOPIC_UPDATE String(String("roboleague/iotr/") + NetworkConfiguration.Hostname + String("/update")).c_str()
-#define TOPIC_IR String(String("roboleague/iotr/") + NetworkConfiguration.Hostname + String("/ir")).c_str()
-#define TOPIC_RELAY_IN String(String("roboleague/iotr/") + NetworkConfiguration.Hostname + String("/relay/in")).c_str()
-#define TOPIC_RELAY_OUT String(String("roboleague/iotr/") + NetworkConfiguration.Hostname + String("/relay/out")).c_str()
-#define TOPIC_BUTTON String(String("roboleague/iotr/") + NetworkConfiguration.Hostname + String("/button/out")).c_str()
+/** @brief Topics base, followed by the host name. */
+#define MQTT_TOPIC_BASE "roboleague/iotr/"
+
+// Topic suffixes, the full topics are built by MqttTopics.
+#define TOPIC_SER_OUT "/serial/out"
+#define TOPIC_SER_IN "/serial/in"
+#define TOPIC_STAT "/status"
+#define TOPIC_UPDATE "/update"
+#define TOPIC_IR "/ir"
+#define TOPIC_RELAY_IN "/relay/in"
+#define TOPIC_RELAY_OUT "/relay/out"
+#define TOPIC_BUTTON "/button/out"
+#define TOPIC_SER_FLOW "/serial/flow"
+#define TOPIC_BOOT "/boot"
+#define TOPIC_PROFILE "/profile"
 
 #pragma endregion
 
@@ -216,6 +335,12 @@ static const uint8_t D3 = 0;
 
 #ifdef ENABLE_IR_INTERFACE
 #define PIN_IR_RECV D3
+
+/** @brief IR receiver poll period [ms]. */
+#define IR_POLL_TIME 20UL
+
+/** @brief Run time budget of the IR task [us]. */
+#define IR_TASK_BUDGET 2000UL
 #endif // ENABLE_IR_INTERFACE
 
 #pragma endregion
@@ -0,0 +1,172 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "BackoffTimer.h"
+
+/** @brief Next random number.
+ *  @return uint32_t, Random number.
+ */
+uint32_t BackoffTimer::random()
+{
+	// xorshift32
+	m_seed ^= m_seed << 13;
+	m_seed ^= m_seed >> 17;
+	m_seed ^= m_seed << 5;
+
+	return m_seed;
+}
+
+/** @brief Spread the delay by the jitter.
+ *  @param delay unsigned long, Delay [ms].
+ *  @return unsigned long, Delay with jitter [ms].
+ */
+unsigned long BackoffTimer::spread(unsigned long delay)
+{
+	if (m_jitter == 0)
+	{
+		return delay;
+	}
+
+	unsigned long SpreadL = delay / 100 * m_jitter;
+
+	return delay - SpreadL + (random() % (2 * SpreadL + 1));
+}
+
+/** @brief Set the backoff policy.
+ *  @param minDelay unsigned long, First retry delay [ms].
+ *  @param maxDelay unsigned long, Maximum retry delay [ms].
+ *  @param jitter uint8_t, Jitter [%].
+ *  @return Void.
+ */
+void BackoffTimer::setPolicy(unsigned long minDelay, unsigned long maxDelay, uint8_t jitter)
+{
+	m_minDelay = minDelay;
+	m_maxDelay = (maxDelay < minDelay) ? minDelay : maxDelay;
+	m_jitter = (jitter > 100) ? 100 : jitter;
+
+	setExpirationTime(m_minDelay);
+}
+
+/** @brief Seed the jitter generator, use something unique to the device.
+ *  @param seed uint32_t, Seed.
+ *  @return Void.
+ */
+void BackoffTimer::seed(uint32_t seed)
+{
+	// Zero state would stay zero.
+	m_seed = (seed == 0) ? 1 : seed;
+}
+
+/** @brief Mark the connection as lost and schedule the first attempt after
+ *  the jittered first delay. Later calls keep the first time.
+ *  @return Void.
+ */
+void BackoffTimer::markDown()
+{
+	if (m_down)
+	{
+		return;
+	}
+
+	m_down = true;
+	m_downSince = millis();
+
+	// The timer still runs from the connect, without this the whole fleet retries at once.
+	setExpirationTime(spread(m_minDelay));
+	updateLastTime();
+	clear();
+}
+
+/** @brief Count the attempt and schedule the next one.
+ *  @return Void.
+ */
+void BackoffTimer::next()
+{
+	unsigned long DelayL = m_maxDelay;
+
+	m_attempts++;
+
+	if (m_attempt < 16)
+	{
+		m_attempt++;
+	}
+
+	// Doubling until the maximum, without overflow.
+	if ((m_maxDelay >> (m_attempt - 1)) >= m_minDelay)
+	{
+		DelayL = m_minDelay << (m_attempt - 1);
+	}
+
+	setExpirationTime(spread(DelayL));
+	updateLastTime();
+	clear();
+}
+
+/** @brief Connection is up, start over from the first delay.
+ *  @return Void.
+ */
+void BackoffTimer::reset()
+{
+	if (m_down)
+	{
+		m_lastDowntime = millis() - m_downSince;
+		m_down = false;
+	}
+
+	m_attempt = 0;
+
+	setExpirationTime(m_minDelay);
+	updateLastTime();
+	clear();
+}
+
+/** @brief Connection is marked as lost.
+ *  @return bool, True if down.
+ */
+bool BackoffTimer::down()
+{
+	return m_down;
+}
+
+/** @brief Attempts since start.
+ *  @return unsigned long, Attempts.
+ */
+unsigned long BackoffTimer::getAttempts()
+{
+	return m_attempts;
+}
+
+/** @brief Duration of the current or the last outage.
+ *  @return unsigned long, Duration [ms].
+ */
+unsigned long BackoffTimer::getDowntime()
+{
+	if (m_down)
+	{
+		return millis() - m_downSince;
+	}
+
+	return m_lastDowntime;
+}
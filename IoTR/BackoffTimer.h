@@ -0,0 +1,135 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// BackoffTimer.h
+
+#ifndef _BACKOFFTIMER_h
+#define _BACKOFFTIMER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "FxTimer.h"
+
+#pragma endregion
+
+/** @brief Reconnect timer with exponential backoff and bounded jitter.
+ *
+ *  Every failed attempt doubles the delay up to the maximum. The delay is
+ *  spread by up to +/- jitter percent, so devices seeded differently do not
+ *  retry in lockstep.
+ */
+class BackoffTimer : public FxTimer
+{
+protected:
+
+	/** @brief First retry delay [ms]. */
+	unsigned long m_minDelay = 1000;
+
+	/** @brief Maximum retry delay [ms]. */
+	unsigned long m_maxDelay = 60000;
+
+	/** @brief Jitter [%]. */
+	uint8_t m_jitter = 0;
+
+	/** @brief Random generator state. */
+	uint32_t m_seed = 1;
+
+	/** @brief Failed attempts since the last success. */
+	uint16_t m_attempt = 0;
+
+	/** @brief Attempts since start. */
+	unsigned long m_attempts = 0;
+
+	/** @brief Connection is down. */
+	bool m_down = false;
+
+	/** @brief Time when the connection was lost [ms]. */
+	unsigned long m_downSince = 0;
+
+	/** @brief Duration of the last outage [ms]. */
+	unsigned long m_lastDowntime = 0;
+
+	/** @brief Next random number.
+	 *  @return uint32_t, Random number.
+	 */
+	uint32_t random();
+
+	/** @brief Spread the delay by the jitter.
+	 *  @param delay unsigned long, Delay [ms].
+	 *  @return unsigned long, Delay with jitter [ms].
+	 */
+	unsigned long spread(unsigned long delay);
+
+public:
+
+	/** @brief Set the backoff policy.
+	 *  @param minDelay unsigned long, First retry delay [ms].
+	 *  @param maxDelay unsigned long, Maximum retry delay [ms].
+	 *  @param jitter uint8_t, Jitter [%].
+	 *  @return Void.
+	 */
+	void setPolicy(unsigned long minDelay, unsigned long maxDelay, uint8_t jitter);
+
+	/** @brief Seed the jitter generator, use something unique to the device.
+	 *  @param seed uint32_t, Seed.
+	 *  @return Void.
+	 */
+	void seed(uint32_t seed);
+
+	/** @brief Mark the connection as lost and schedule the first attempt after
+	 *  the jittered first delay. Later calls keep the first time.
+	 *  @return Void.
+	 */
+	void markDown();
+
+	/** @brief Count the attempt and schedule the next one.
+	 *  @return Void.
+	 */
+	void next();
+
+	/** @brief Connection is up, start over from the first delay.
+	 *  @return Void.
+	 */
+	void reset();
+
+	/** @brief Connection is marked as lost.
+	 *  @return bool, True if down.
+	 */
+	bool down();
+
+	/** @brief Attempts since start.
+	 *  @return unsigned long, Attempts.
+	 */
+	unsigned long getAttempts();
+
+	/** @brief Duration of the current or the last outage.
+	 *  @return unsigned long, Duration [ms].
+	 */
+	unsigned long getDowntime();
+};
+
+#endif
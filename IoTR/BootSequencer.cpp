@@ -0,0 +1,160 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "BootSequencer.h"
+
+/** @brief Add stage.
+ *  @param name const char*, Name.
+ *  @param run Deferred work or NULL.
+ *  @return uint8_t, Identifier or BOOT_NO_STAGE if the table is full.
+ */
+uint8_t BootSequencerClass::add(const char* name, bool(*run)(void))
+{
+	if (m_count >= BOOT_MAX_STAGES)
+	{
+		DEBUGLOG("Boot stages limit: %s\r\n", name);
+		return BOOT_NO_STAGE;
+	}
+
+	m_stages[m_count].Name = name;
+	m_stages[m_count].Run = run;
+	m_stages[m_count].Time = 0;
+	m_stages[m_count].Done = false;
+
+	return m_count++;
+}
+
+/** @brief Add deferred stage.
+ *  @param name const char*, Name.
+ *  @param run Work, returns false to be called again on the next tick.
+ *  @return uint8_t, Identifier.
+ */
+uint8_t BootSequencerClass::defer(const char* name, bool(*run)(void))
+{
+	return add(name, run);
+}
+
+/** @brief Add milestone.
+ *  @param name const char*, Name.
+ *  @return uint8_t, Identifier.
+ */
+uint8_t BootSequencerClass::milestone(const char* name)
+{
+	return add(name, NULL);
+}
+
+/** @brief Mark stage as done. Only the first mark counts.
+ *  @param id uint8_t, Identifier.
+ *  @return Void.
+ */
+void BootSequencerClass::mark(uint8_t id)
+{
+	if ((id >= m_count) || m_stages[id].Done)
+	{
+		return;
+	}
+
+	m_stages[id].Time = millis();
+	m_stages[id].Done = true;
+
+	DEBUGLOG("Boot stage %s: %lu ms\r\n", m_stages[id].Name, m_stages[id].Time);
+}
+
+/** @brief Check if the stage is done.
+ *  @param id uint8_t, Identifier.
+ *  @return bool, True if done.
+ */
+bool BootSequencerClass::isDone(uint8_t id)
+{
+	return (id < m_count) && m_stages[id].Done;
+}
+
+/** @brief Run the first pending deferred stage. Call it from the main loop.
+ *  @return Void.
+ */
+void BootSequencerClass::update()
+{
+	// One stage per tick, so the loop keeps bridging between them.
+	for (uint8_t index = 0; index < m_count; index++)
+	{
+		if (m_stages[index].Done || (m_stages[index].Run == NULL))
+		{
+			continue;
+		}
+
+		if (m_stages[index].Run())
+		{
+			mark(index);
+		}
+
+		return;
+	}
+}
+
+/** @brief Check if all stages and milestones are done.
+ *  @return bool, True if done.
+ */
+bool BootSequencerClass::complete()
+{
+	for (uint8_t index = 0; index < m_count; index++)
+	{
+		if (!m_stages[index].Done)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/** @brief Boot profile as JSON object of the stage times.
+ *  @param buffer char*, Output buffer.
+ *  @param size size_t, Output buffer size.
+ *  @return size_t, Length or zero if it does not fit.
+ */
+size_t BootSequencerClass::toJson(char* buffer, size_t size)
+{
+	size_t LengthL = 0;
+	bool StateL = buffer_append(buffer, size, &LengthL, "{");
+
+	for (uint8_t index = 0; index < m_count; index++)
+	{
+		// Stages that never came are left out.
+		if (!m_stages[index].Done)
+		{
+			continue;
+		}
+
+		StateL &= buffer_append(buffer, size, &LengthL, "%s\"%s\":%lu",
+			(LengthL > 1) ? "," : "", m_stages[index].Name, m_stages[index].Time);
+	}
+
+	StateL &= buffer_append(buffer, size, &LengthL, "}");
+
+	return StateL ? LengthL : 0;
+}
+
+/* @brief Singleton boot sequencer instance. */
+BootSequencerClass BootSequencer;
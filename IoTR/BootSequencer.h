@@ -0,0 +1,145 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// BootSequencer.h
+
+#ifndef _BOOTSEQUENCER_h
+#define _BOOTSEQUENCER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#include "GeneralHelper.h"
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef BOOT_MAX_STAGES
+/** @brief Maximum count of the boot stages and milestones. */
+#define BOOT_MAX_STAGES 12
+#endif // !BOOT_MAX_STAGES
+
+#ifndef BOOT_PROFILE_BUFFER_SIZE
+/** @brief Size of the boot profile message. */
+#define BOOT_PROFILE_BUFFER_SIZE 192
+#endif // !BOOT_PROFILE_BUFFER_SIZE
+
+/** @brief Invalid stage identifier. */
+#define BOOT_NO_STAGE 0xFF
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Boot stage. */
+typedef struct {
+	const char* Name; ///< Name in the boot profile.
+	bool(*Run)(void); ///< Deferred work, true when done. NULL for milestones marked from outside.
+	unsigned long Time; ///< Time since power up when it was done [ms].
+	bool Done; ///< Stage is done.
+} BootStage_t;
+
+#pragma endregion
+
+/** @brief Staged boot.
+ *
+ *  setup() does only what the bridge needs at once and marks it. The rest
+ *  is added as deferred stages, run one per loop tick in the order they
+ *  were added. Milestones like the first connection are marked when they
+ *  happen. The times make up the boot profile.
+ */
+class BootSequencerClass
+{
+protected:
+
+	/** @brief Stages storage. */
+	BootStage_t m_stages[BOOT_MAX_STAGES];
+
+	/** @brief Count of the stages. */
+	uint8_t m_count = 0;
+
+	/** @brief Add stage.
+	 *  @param name const char*, Name.
+	 *  @param run Deferred work or NULL.
+	 *  @return uint8_t, Identifier or BOOT_NO_STAGE if the table is full.
+	 */
+	uint8_t add(const char* name, bool(*run)(void));
+
+public:
+
+	/** @brief Add deferred stage.
+	 *  @param name const char*, Name.
+	 *  @param run Work, returns false to be called again on the next tick.
+	 *  @return uint8_t, Identifier.
+	 */
+	uint8_t defer(const char* name, bool(*run)(void));
+
+	/** @brief Add milestone.
+	 *  @param name const char*, Name.
+	 *  @return uint8_t, Identifier.
+	 */
+	uint8_t milestone(const char* name);
+
+	/** @brief Mark stage as done. Only the first mark counts.
+	 *  @param id uint8_t, Identifier.
+	 *  @return Void.
+	 */
+	void mark(uint8_t id);
+
+	/** @brief Check if the stage is done.
+	 *  @param id uint8_t, Identifier.
+	 *  @return bool, True if done.
+	 */
+	bool isDone(uint8_t id);
+
+	/** @brief Run the first pending deferred stage. Call it from the main loop.
+	 *  @return Void.
+	 */
+	void update();
+
+	/** @brief Check if all stages and milestones are done.
+	 *  @return bool, True if done.
+	 */
+	bool complete();
+
+	/** @brief Boot profile as JSON object of the stage times.
+	 *  @param buffer char*, Output buffer.
+	 *  @param size size_t, Output buffer size.
+	 *  @return size_t, Length or zero if it does not fit.
+	 */
+	size_t toJson(char* buffer, size_t size);
+};
+
+/* @brief Singleton boot sequencer instance. */
+extern BootSequencerClass BootSequencer;
+
+#endif
+
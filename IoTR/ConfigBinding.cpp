@@ -0,0 +1,186 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "ConfigBinding.h"
+
+/** @brief Parse number and check the range.
+ *  @param field const ConfigField_t*, Field.
+ *  @param value const String&, Posted value.
+ *  @param number long*, Parsed number.
+ *  @return bool, True if the value is a number in the range.
+ */
+static bool parse_number(const ConfigField_t* field, const String& value, long* number) {
+
+	const char* TextL = value.c_str();
+	char* EndL = NULL;
+
+	*number = strtol(TextL, &EndL, 10);
+
+	if ((EndL == TextL) || (*EndL != '\0'))
+	{
+		return false;
+	}
+
+	return ((*number >= field->Min) && (*number <= field->Max));
+}
+
+/** @brief Clear the check boxes, unchecked boxes are not posted.
+ *         Boxes with CONFIG_KEEP_EMPTY are left as they are.
+ *  @param fields const ConfigField_t*, Fields table.
+ *  @param count size_t, Count of the fields.
+ *  @return Void.
+ */
+void config_clear_flags(const ConfigField_t* fields, size_t count) {
+
+	for (size_t index = 0; index < count; index++)
+	{
+		if ((fields[index].Type == ConfigFlag) && ((fields[index].Flags & CONFIG_KEEP_EMPTY) == 0))
+		{
+			*(bool*)fields[index].Value = false;
+		}
+	}
+}
+
+/** @brief Parse and store posted value.
+ *  @param fields const ConfigField_t*, Fields table.
+ *  @param count size_t, Count of the fields.
+ *  @param key const char*, Posted key.
+ *  @param value const String&, Decoded posted value.
+ *  @return bool, False if the key is unknown or the value is not valid.
+ */
+bool config_bind(const ConfigField_t* fields, size_t count, const char* key, const String& value) {
+
+	const ConfigField_t* FieldL = NULL;
+
+	for (size_t index = 0; index < count; index++)
+	{
+		if (strcmp(fields[index].Key, key) == 0)
+		{
+			FieldL = &fields[index];
+			break;
+		}
+	}
+
+	if (FieldL == NULL)
+	{
+		return false;
+	}
+
+	if (((FieldL->Flags & CONFIG_KEEP_EMPTY) != 0) && (value.length() == 0))
+	{
+		return true;
+	}
+
+	long NumberL = 0;
+
+	switch (FieldL->Type)
+	{
+	case ConfigText:
+		*(String*)FieldL->Value = value;
+		return true;
+
+	case ConfigFlag:
+		*(bool*)FieldL->Value = true;
+		return true;
+
+	case ConfigInt:
+		if (!parse_number(FieldL, value, &NumberL))
+		{
+			return false;
+		}
+		*(int*)FieldL->Value = (int)(NumberL * FieldL->Scale);
+		return true;
+
+	case ConfigByte:
+		if (!parse_number(FieldL, value, &NumberL))
+		{
+			return false;
+		}
+		*(uint8_t*)FieldL->Value = (uint8_t)NumberL;
+		return true;
+
+	case ConfigOctet:
+		if (!parse_number(FieldL, value, &NumberL))
+		{
+			return false;
+		}
+		(*(IPAddress*)FieldL->Value)[FieldL->Scale] = (uint8_t)NumberL;
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+/** @brief Write one field per group.
+ *  @param stream ApiStream, Target stream.
+ *  @param fields const ConfigField_t*, Fields table.
+ *  @param count size_t, Count of the fields.
+ *  @param index size_t, Group index.
+ *  @return bool, False when there are no more fields.
+ */
+bool config_write_field(ApiStream& stream, const ConfigField_t* fields, size_t count, size_t index) {
+
+	if (index >= count)
+	{
+		return false;
+	}
+
+	const ConfigField_t* FieldL = &fields[index];
+
+	// Hidden fields leave empty group.
+	if ((FieldL->Flags & CONFIG_HIDDEN) != 0)
+	{
+		return true;
+	}
+
+	switch (FieldL->Type)
+	{
+	case ConfigText:
+		stream.field(FieldL->Key, ((String*)FieldL->Value)->c_str(), FieldL->FieldType);
+		break;
+
+	case ConfigFlag:
+		stream.flag(FieldL->Key, *(bool*)FieldL->Value, FieldL->FieldType);
+		break;
+
+	case ConfigInt:
+		stream.field(FieldL->Key, (long)(*(int*)FieldL->Value / FieldL->Scale), FieldL->FieldType);
+		break;
+
+	case ConfigByte:
+		stream.field(FieldL->Key, (long)*(uint8_t*)FieldL->Value, FieldL->FieldType);
+		break;
+
+	case ConfigOctet:
+		stream.field(FieldL->Key, (long)(*(IPAddress*)FieldL->Value)[FieldL->Scale], FieldL->FieldType);
+		break;
+
+	default:
+		break;
+	}
+
+	return true;
+}
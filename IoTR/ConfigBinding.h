@@ -0,0 +1,129 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// ConfigBinding.h
+
+#ifndef _CONFIGBINDING_h
+#define _CONFIGBINDING_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "ApiStream.h"
+
+#include <IPAddress.h>
+
+#include <limits.h>
+
+#pragma endregion
+
+#pragma region Definitions
+
+/** @brief Configuration field value types. */
+enum ConfigFieldType_t : uint8_t
+{
+	ConfigText = 0, ///< String.
+	ConfigInt, ///< int, posted value times the scale.
+	ConfigByte, ///< uint8_t.
+	ConfigFlag, ///< bool, check box, set when posted.
+	ConfigOctet, ///< One octet of IPAddress, the scale is the octet index.
+};
+
+/** @brief Empty posted value keeps the current one, check box is not cleared. */
+#define CONFIG_KEEP_EMPTY 0x01
+
+/** @brief Field is not sent by the API. */
+#define CONFIG_HIDDEN 0x02
+
+/** @brief Text field. */
+#define CONFIG_TEXT(key, value, flags, type) { key, ConfigText, flags, &(value), 0, 0, 1, type }
+
+/** @brief Number field with valid range. */
+#define CONFIG_INT(key, value, min, max, type) { key, ConfigInt, 0, &(value), min, max, 1, type }
+
+/** @brief Number field stored scaled, the range is of the posted value. */
+#define CONFIG_SCALED(key, value, min, max, scale, type) { key, ConfigInt, 0, &(value), min, max, scale, type }
+
+/** @brief Small number field with valid range. */
+#define CONFIG_BYTE(key, value, min, max, type) { key, ConfigByte, 0, &(value), min, max, 1, type }
+
+/** @brief Check box field. */
+#define CONFIG_FLAG(key, value, flags) { key, ConfigFlag, flags, &(value), 0, 1, 1, "chk" }
+
+/** @brief IP address octet field. */
+#define CONFIG_OCTET(key, address, octet) { key, ConfigOctet, 0, &(address), 0, 255, octet, "input" }
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Binding of one form and API field to a configuration value. */
+typedef struct {
+	const char* Key; ///< Form and API field key.
+	uint8_t Type; ///< Value type.
+	uint8_t Flags; ///< Binding flags.
+	void* Value; ///< Configuration value.
+	long Min; ///< Minimum valid number.
+	long Max; ///< Maximum valid number.
+	long Scale; ///< Number scale or octet index.
+	const char* FieldType; ///< Field type of the legacy format.
+} ConfigField_t;
+
+#pragma endregion
+
+#pragma region Prototypes
+
+/** @brief Clear the check boxes, unchecked boxes are not posted.
+ *         Boxes with CONFIG_KEEP_EMPTY are left as they are.
+ *  @param fields const ConfigField_t*, Fields table.
+ *  @param count size_t, Count of the fields.
+ *  @return Void.
+ */
+void config_clear_flags(const ConfigField_t* fields, size_t count);
+
+/** @brief Parse and store posted value.
+ *  @param fields const ConfigField_t*, Fields table.
+ *  @param count size_t, Count of the fields.
+ *  @param key const char*, Posted key.
+ *  @param value const String&, Decoded posted value.
+ *  @return bool, False if the key is unknown or the value is not valid.
+ */
+bool config_bind(const ConfigField_t* fields, size_t count, const char* key, const String& value);
+
+/** @brief Write one field per group.
+ *  @param stream ApiStream, Target stream.
+ *  @param fields const ConfigField_t*, Fields table.
+ *  @param count size_t, Count of the fields.
+ *  @param index size_t, Group index.
+ *  @return bool, False when there are no more fields.
+ */
+bool config_write_field(ApiStream& stream, const ConfigField_t* fields, size_t count, size_t index);
+
+#pragma endregion
+
+#endif
@@ -0,0 +1,580 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "ConfigStore.h"
+
+#pragma region Structures
+
+/** @brief Position in the record buffer. */
+typedef struct {
+	uint8_t* Buffer; ///< Record buffer.
+	size_t Size; ///< Size of the buffer.
+	size_t Position; ///< Current position.
+	bool Overflow; ///< Access out of the buffer, the content is not valid.
+} ConfigCursor_t;
+
+#pragma endregion
+
+#pragma region Variables
+
+/* @brief Record buffer, shared by load and save to stay off the heap and the stack. */
+static uint8_t ConfigBuffer_g[CONFIG_STORE_MAX_SIZE];
+
+/* @brief Slot files. */
+static const char* const ConfigSlots_g[CONFIG_STORE_SLOTS] = { CONFIG_STORE_SLOT_A, CONFIG_STORE_SLOT_B };
+
+/* @brief Slot of the active record. */
+static uint8_t ActiveSlot_g = CONFIG_STORE_NO_SLOT;
+
+/* @brief Payload length of the active record. */
+static uint16_t ActiveLength_g = 0;
+
+/* @brief Store counters. */
+static ConfigStoreStats_t ConfigStats_g = { 0, 0, 0, 0 };
+
+#pragma endregion
+
+#pragma region Functions
+
+/** @brief Calculate CRC32 (IEEE 802.3).
+ *  @param data const uint8_t*, Data.
+ *  @param length size_t, Data length.
+ *  @param crc uint32_t, CRC of the previous data, to continue it.
+ *  @return uint32_t, CRC.
+ */
+static uint32_t config_crc32(const uint8_t* data, size_t length, uint32_t crc = 0)
+{
+	uint32_t CrcL = ~crc;
+
+	for (size_t index = 0; index < length; index++)
+	{
+		CrcL ^= data[index];
+		for (uint8_t bit = 0; bit < 8; bit++)
+		{
+			CrcL = (CrcL >> 1) ^ (0xEDB88320UL & (0 - (CrcL & 1)));
+		}
+	}
+
+	return ~CrcL;
+}
+
+/** @brief Write unsigned integer, little endian.
+ *  @param cursor ConfigCursor_t*, Cursor.
+ *  @param value uint32_t, Value.
+ *  @param size uint8_t, Bytes to write.
+ *  @return Void.
+ */
+static void config_put(ConfigCursor_t* cursor, uint32_t value, uint8_t size)
+{
+	if (cursor->Position + size > cursor->Size)
+	{
+		cursor->Overflow = true;
+		return;
+	}
+
+	for (uint8_t index = 0; index < size; index++)
+	{
+		cursor->Buffer[cursor->Position++] = (uint8_t)(value >> (8 * index));
+	}
+}
+
+/** @brief Write string with one byte length.
+ *  @param cursor ConfigCursor_t*, Cursor.
+ *  @param value const String&, Value.
+ *  @return Void.
+ */
+static void config_put_string(ConfigCursor_t* cursor, const String& value)
+{
+	size_t LengthL = value.length();
+	if ((LengthL > 255) || (cursor->Position + 1 + LengthL > cursor->Size))
+	{
+		cursor->Overflow = true;
+		return;
+	}
+
+	cursor->Buffer[cursor->Position++] = (uint8_t)LengthL;
+	memcpy(cursor->Buffer + cursor->Position, value.c_str(), LengthL);
+	cursor->Position += LengthL;
+}
+
+/** @brief Write IP address.
+ *  @param cursor ConfigCursor_t*, Cursor.
+ *  @param value IPAddress, Value.
+ *  @return Void.
+ */
+static void config_put_ip(ConfigCursor_t* cursor, IPAddress value)
+{
+	for (uint8_t index = 0; index < 4; index++)
+	{
+		config_put(cursor, value[index], 1);
+	}
+}
+
+/** @brief Read unsigned integer, little endian.
+ *  @param cursor ConfigCursor_t*, Cursor.
+ *  @param size uint8_t, Bytes to read.
+ *  @return uint32_t, Value, zero if out of the record.
+ */
+static uint32_t config_get(ConfigCursor_t* cursor, uint8_t size)
+{
+	if (cursor->Position + size > cursor->Size)
+	{
+		cursor->Overflow = true;
+		return 0;
+	}
+
+	uint32_t ValueL = 0;
+	for (uint8_t index = 0; index < size; index++)
+	{
+		ValueL |= (uint32_t)cursor->Buffer[cursor->Position++] << (8 * index);
+	}
+
+	return ValueL;
+}
+
+/** @brief Read string with one byte length.
+ *  @param cursor ConfigCursor_t*, Cursor.
+ *  @return String, Value, empty if out of the record.
+ */
+static String config_get_string(ConfigCursor_t* cursor)
+{
+	size_t LengthL = config_get(cursor, 1);
+	if (cursor->Position + LengthL > cursor->Size)
+	{
+		cursor->Overflow = true;
+		return String();
+	}
+
+	String ValueL;
+	ValueL.reserve(LengthL);
+	for (size_t index = 0; index < LengthL; index++)
+	{
+		ValueL += (char)cursor->Buffer[cursor->Position++];
+	}
+
+	return ValueL;
+}
+
+/** @brief Read IP address.
+ *  @param cursor ConfigCursor_t*, Cursor.
+ *  @return IPAddress, Value.
+ */
+static IPAddress config_get_ip(ConfigCursor_t* cursor)
+{
+	uint8_t OctetsL[4];
+	for (uint8_t index = 0; index < 4; index++)
+	{
+		OctetsL[index] = config_get(cursor, 1);
+	}
+
+	return IPAddress(OctetsL[0], OctetsL[1], OctetsL[2], OctetsL[3]);
+}
+
+/** @brief Serialize the configuration, version CONFIG_STORE_VERSION.
+ *  @param cursor ConfigCursor_t*, Cursor at the payload.
+ *  @return Void.
+ */
+static void config_write_payload(ConfigCursor_t* cursor)
+{
+	// Network
+	config_put_string(cursor, NetworkConfiguration.Hostname);
+	config_put_string(cursor, NetworkConfiguration.SSID);
+	config_put_string(cursor, NetworkConfiguration.Password);
+	config_put_ip(cursor, NetworkConfiguration.IP);
+	config_put_ip(cursor, NetworkConfiguration.NetMask);
+	config_put_ip(cursor, NetworkConfiguration.Gateway);
+	config_put_ip(cursor, NetworkConfiguration.DNS);
+	config_put(cursor, NetworkConfiguration.DHCP, 1);
+
+	// Device
+	config_put_string(cursor, DeviceConfiguration.Username);
+	config_put_string(cursor, DeviceConfiguration.Password);
+	config_put(cursor, DeviceConfiguration.PortBaudrate, 4);
+	config_put_string(cursor, DeviceConfiguration.NTPDomain);
+	config_put(cursor, DeviceConfiguration.NTPPort, 4);
+	config_put(cursor, DeviceConfiguration.NTPTimezone, 4);
+	config_put(cursor, DeviceConfiguration.ActivationCode, 4);
+
+	// MQTT
+	config_put(cursor, MqttConfiguration.Auth, 1);
+	config_put(cursor, MqttConfiguration.Port, 4);
+	config_put_string(cursor, MqttConfiguration.Domain);
+	config_put_string(cursor, MqttConfiguration.Username);
+	config_put_string(cursor, MqttConfiguration.Password);
+	config_put(cursor, MqttConfiguration.Batch, 1);
+	config_put(cursor, MqttConfiguration.BatchSize, 4);
+	config_put(cursor, MqttConfiguration.BatchInterval, 4);
+	config_put(cursor, MqttConfiguration.SerialQoS, 1);
+	config_put(cursor, MqttConfiguration.SerialRetain, 1);
+	config_put(cursor, MqttConfiguration.StatusQoS, 1);
+	config_put(cursor, MqttConfiguration.StatusRetain, 1);
+	config_put(cursor, MqttConfiguration.CommandQoS, 1);
+	config_put(cursor, MqttConfiguration.Encoding, 1);
+}
+
+/** @brief Deserialize the configuration.
+ *  @param cursor ConfigCursor_t*, Cursor at the payload.
+ *  @return Void.
+ */
+static void config_read_payload(ConfigCursor_t* cursor)
+{
+	// Network
+	NetworkConfiguration.Hostname = config_get_string(cursor);
+	NetworkConfiguration.SSID = config_get_string(cursor);
+	NetworkConfiguration.Password = config_get_string(cursor);
+	NetworkConfiguration.IP = config_get_ip(cursor);
+	NetworkConfiguration.NetMask = config_get_ip(cursor);
+	NetworkConfiguration.Gateway = config_get_ip(cursor);
+	NetworkConfiguration.DNS = config_get_ip(cursor);
+	NetworkConfiguration.DHCP = config_get(cursor, 1) != 0;
+
+	// Device
+	DeviceConfiguration.Username = config_get_string(cursor);
+	DeviceConfiguration.Password = config_get_string(cursor);
+	DeviceConfiguration.PortBaudrate = (int32_t)config_get(cursor, 4);
+	DeviceConfiguration.NTPDomain = config_get_string(cursor);
+	DeviceConfiguration.NTPPort = (int32_t)config_get(cursor, 4);
+	DeviceConfiguration.NTPTimezone = (int32_t)config_get(cursor, 4);
+	DeviceConfiguration.ActivationCode = (int32_t)config_get(cursor, 4);
+
+	// MQTT
+	MqttConfiguration.Auth = config_get(cursor, 1) != 0;
+	MqttConfiguration.Port = (int32_t)config_get(cursor, 4);
+	MqttConfiguration.Domain = config_get_string(cursor);
+	MqttConfiguration.Username = config_get_string(cursor);
+	MqttConfiguration.Password = config_get_string(cursor);
+	MqttConfiguration.Batch = config_get(cursor, 1) != 0;
+	MqttConfiguration.BatchSize = (int32_t)config_get(cursor, 4);
+	MqttConfiguration.BatchInterval = (int32_t)config_get(cursor, 4);
+	MqttConfiguration.SerialQoS = mqtt_valid_qos(config_get(cursor, 1));
+	MqttConfiguration.SerialRetain = config_get(cursor, 1) != 0;
+	MqttConfiguration.StatusQoS = mqtt_valid_qos(config_get(cursor, 1));
+	MqttConfiguration.StatusRetain = config_get(cursor, 1) != 0;
+	MqttConfiguration.CommandQoS = mqtt_valid_qos(config_get(cursor, 1));
+	MqttConfiguration.Encoding = mqtt_valid_encoding(config_get(cursor, 1));
+}
+
+/** @brief Read the slot and check its record.
+ *  @param fileSystem FS, File system of the device.
+ *  @param slot uint8_t, Slot index.
+ *  @param sequence uint32_t*, Sequence of the record.
+ *  @return uint16_t, Payload length, zero if the record is not valid.
+ */
+static uint16_t config_check_slot(FS* fileSystem, uint8_t slot, uint32_t* sequence)
+{
+	File file = fileSystem->open(ConfigSlots_g[slot], "r");
+	if (!file)
+	{
+		return 0;
+	}
+
+	size_t SizeL = file.read(ConfigBuffer_g, sizeof(ConfigBuffer_g));
+	file.close();
+
+	if (SizeL < CONFIG_STORE_HEADER_SIZE)
+	{
+		DEBUGLOG("Configuration record is too short: %s\r\n", ConfigSlots_g[slot]);
+		return 0;
+	}
+
+	ConfigCursor_t CursorL = { ConfigBuffer_g, SizeL, 0, false };
+	uint32_t MagicL = config_get(&CursorL, 4);
+	uint16_t VersionL = config_get(&CursorL, 2);
+	uint16_t LengthL = config_get(&CursorL, 2);
+	*sequence = config_get(&CursorL, 4);
+	uint32_t CrcL = config_get(&CursorL, 4);
+
+	if ((MagicL != CONFIG_STORE_MAGIC) || (VersionL == 0) || (VersionL > CONFIG_STORE_VERSION))
+	{
+		DEBUGLOG("Unknown configuration record: %s\r\n", ConfigSlots_g[slot]);
+		return 0;
+	}
+
+	// The CRC covers the header before it and the payload.
+	uint32_t CheckL = config_crc32(ConfigBuffer_g, CONFIG_STORE_HEADER_SIZE - 4);
+	if ((CONFIG_STORE_HEADER_SIZE + LengthL > SizeL)
+		|| (config_crc32(ConfigBuffer_g + CONFIG_STORE_HEADER_SIZE, LengthL, CheckL) != CrcL))
+	{
+		DEBUGLOG("Configuration record is corrupted: %s\r\n", ConfigSlots_g[slot]);
+		return 0;
+	}
+
+	return LengthL;
+}
+
+/** @brief Load the record of the slot.
+ *  @param fileSystem FS, File system of the device.
+ *  @param slot uint8_t, Slot index.
+ *  @return boolean, True if the record is valid and loaded.
+ */
+static bool config_load_slot(FS* fileSystem, uint8_t slot)
+{
+	uint32_t SequenceL = 0;
+	uint16_t LengthL = config_check_slot(fileSystem, slot, &SequenceL);
+	if (LengthL == 0)
+	{
+		return false;
+	}
+
+	// Fields missing in records of older versions keep their defaults.
+	set_default_network_configuration();
+	set_default_device_config();
+	set_default_mqtt_configuration();
+
+	ConfigCursor_t CursorL = { ConfigBuffer_g, (size_t)CONFIG_STORE_HEADER_SIZE + LengthL, CONFIG_STORE_HEADER_SIZE, false };
+	config_read_payload(&CursorL);
+
+	uint16_t VersionL = ConfigBuffer_g[4] | (ConfigBuffer_g[5] << 8);
+	if ((VersionL == CONFIG_STORE_VERSION) && CursorL.Overflow)
+	{
+		DEBUGLOG("Configuration record is incomplete: %s\r\n", ConfigSlots_g[slot]);
+		return false;
+	}
+
+	ActiveSlot_g = slot;
+	ActiveLength_g = LengthL;
+	ConfigStats_g.Sequence = SequenceL;
+
+	return true;
+}
+
+/** @brief Compare the payload with the record of the active slot.
+ *  @param fileSystem FS, File system of the device.
+ *  @param payload const uint8_t*, New payload.
+ *  @param length size_t, Length of the new payload.
+ *  @return boolean, True if the content is the same.
+ */
+static bool config_same_as_active(FS* fileSystem, const uint8_t* payload, size_t length)
+{
+	if ((ActiveSlot_g == CONFIG_STORE_NO_SLOT) || (length != ActiveLength_g))
+	{
+		return false;
+	}
+
+	File file = fileSystem->open(ConfigSlots_g[ActiveSlot_g], "r");
+	if (!file)
+	{
+		return false;
+	}
+
+	bool SameL = file.seek(CONFIG_STORE_HEADER_SIZE, SeekSet);
+	uint8_t ChunkL[32];
+	size_t PositionL = 0;
+
+	while (SameL && (PositionL < length))
+	{
+		size_t SizeL = min(sizeof(ChunkL), length - PositionL);
+		SameL = (file.read(ChunkL, SizeL) == SizeL) && (memcmp(ChunkL, payload + PositionL, SizeL) == 0);
+		PositionL += SizeL;
+	}
+
+	file.close();
+
+	return SameL;
+}
+
+/** @brief Import legacy JSON configuration file. The file is kept until the record is saved.
+ *  @param fileSystem FS, File system of the device.
+ *  @param path const char*, JSON file.
+ *  @param load Loader of the file.
+ *  @return boolean, True if the file was imported.
+ */
+static bool config_import_json(FS* fileSystem, const char* path, bool(*load)(FS*, const char*))
+{
+	if (!fileSystem->exists(path))
+	{
+		return false;
+	}
+
+	DEBUGLOG("Import configuration: %s\r\n", path);
+
+	return load(fileSystem, path);
+}
+
+/** @brief Remove the legacy JSON configuration files.
+ *  @param fileSystem FS, File system of the device.
+ *  @return Void.
+ */
+static void config_remove_json(FS* fileSystem)
+{
+	const char* PathsL[] = { CONFIG_NET, CONFIG_DEVICE, CONFIG_MQTT };
+
+	for (uint8_t index = 0; index < sizeof(PathsL) / sizeof(PathsL[0]); index++)
+	{
+		if (fileSystem->exists(PathsL[index]))
+		{
+			fileSystem->remove(PathsL[index]);
+		}
+	}
+}
+
+/** @brief Load the network, device and MQTT configuration.
+ *
+ *  The record is kept in two slots, the valid one with the newest
+ *  sequence wins. JSON files left by older firmware or uploaded with
+ *  the editor are imported on top of it, saved to the record and removed.
+ *
+ *  @param fileSystem FS, File system of the device.
+ *  @return boolean, True if a record or a JSON file was loaded, defaults otherwise.
+ */
+bool load_configuration(FS* fileSystem)
+{
+#ifdef SHOW_FUNC_NAMES
+	DEBUGLOG("\r\n");
+	DEBUGLOG(__PRETTY_FUNCTION__);
+	DEBUGLOG("\r\n");
+#endif // SHOW_FUNC_NAMES
+
+	ActiveSlot_g = CONFIG_STORE_NO_SLOT;
+
+	// Find the newest valid record, the sequence may wrap.
+	uint32_t SequenceAL = 0;
+	uint32_t SequenceBL = 0;
+	bool ValidAL = config_check_slot(fileSystem, 0, &SequenceAL) > 0;
+	bool ValidBL = config_check_slot(fileSystem, 1, &SequenceBL) > 0;
+	uint8_t FirstL = (ValidBL && (!ValidAL || (int32_t)(SequenceBL - SequenceAL) > 0)) ? 1 : 0;
+
+	bool LoadedL = config_load_slot(fileSystem, FirstL)
+		|| config_load_slot(fileSystem, 1 - FirstL);
+
+	if (!LoadedL)
+	{
+		// Nothing valid, do not keep half of a record.
+		set_default_network_configuration();
+		set_default_device_config();
+		set_default_mqtt_configuration();
+	}
+
+	bool ImportedL = false;
+	ImportedL |= config_import_json(fileSystem, CONFIG_NET, load_network_configuration);
+	ImportedL |= config_import_json(fileSystem, CONFIG_DEVICE, load_device_config);
+	ImportedL |= config_import_json(fileSystem, CONFIG_MQTT, load_mqtt_configuration);
+
+	bool SavedL = true;
+	if (ImportedL || !LoadedL)
+	{
+		SavedL = save_configuration(fileSystem);
+	}
+
+	// Imported or broken, the record is the only configuration from now on.
+	// If it could not be written, the files are imported again on the next boot.
+	if (SavedL)
+	{
+		config_remove_json(fileSystem);
+	}
+
+	return LoadedL || ImportedL;
+}
+
+/** @brief Save the network, device and MQTT configuration.
+ *
+ *  The record goes to the older slot and is read back before it becomes
+ *  active, so a power loss while writing leaves the previous one in place.
+ *  Nothing is written if the content did not change.
+ *
+ *  @param fileSystem FS, File system of the device.
+ *  @return boolean, Successful saving.
+ */
+bool save_configuration(FS* fileSystem)
+{
+#ifdef SHOW_FUNC_NAMES
+	DEBUGLOG("\r\n");
+	DEBUGLOG(__PRETTY_FUNCTION__);
+	DEBUGLOG("\r\n");
+#endif // SHOW_FUNC_NAMES
+
+	ConfigCursor_t CursorL = { ConfigBuffer_g, sizeof(ConfigBuffer_g), CONFIG_STORE_HEADER_SIZE, false };
+	config_write_payload(&CursorL);
+
+	if (CursorL.Overflow)
+	{
+		DEBUGLOG("Configuration does not fit the record.\r\n");
+		ConfigStats_g.Failures++;
+		return false;
+	}
+
+	size_t LengthL = CursorL.Position - CONFIG_STORE_HEADER_SIZE;
+
+	// Save the flash, nothing changed.
+	if (config_same_as_active(fileSystem, ConfigBuffer_g + CONFIG_STORE_HEADER_SIZE, LengthL))
+	{
+		ConfigStats_g.Skipped++;
+		return true;
+	}
+
+	uint32_t SequenceL = ConfigStats_g.Sequence + 1;
+
+	CursorL.Position = 0;
+	config_put(&CursorL, CONFIG_STORE_MAGIC, 4);
+	config_put(&CursorL, CONFIG_STORE_VERSION, 2);
+	config_put(&CursorL, LengthL, 2);
+	config_put(&CursorL, SequenceL, 4);
+
+	uint32_t CrcL = config_crc32(ConfigBuffer_g, CONFIG_STORE_HEADER_SIZE - 4);
+	CrcL = config_crc32(ConfigBuffer_g + CONFIG_STORE_HEADER_SIZE, LengthL, CrcL);
+	config_put(&CursorL, CrcL, 4);
+
+	// Never touch the active record.
+	uint8_t SlotL = (ActiveSlot_g == 0) ? 1 : 0;
+
+	File file = fileSystem->open(ConfigSlots_g[SlotL], "w");
+	if (!file)
+	{
+		DEBUGLOG("Failed to open config file for writing\r\n");
+		ConfigStats_g.Failures++;
+		return false;
+	}
+
+	size_t WrittenL = file.write(ConfigBuffer_g, CONFIG_STORE_HEADER_SIZE + LengthL);
+	file.close();
+
+	// Read it back, the slot becomes active only if it is valid.
+	uint32_t CheckL = 0;
+	if ((WrittenL != CONFIG_STORE_HEADER_SIZE + LengthL)
+		|| (config_check_slot(fileSystem, SlotL, &CheckL) != LengthL)
+		|| (CheckL != SequenceL))
+	{
+		DEBUGLOG("Failed to write config file\r\n");
+		ConfigStats_g.Failures++;
+		return false;
+	}
+
+	ActiveSlot_g = SlotL;
+	ActiveLength_g = LengthL;
+	ConfigStats_g.Sequence = SequenceL;
+	ConfigStats_g.Writes++;
+
+	return true;
+}
+
+/** @brief Get the store counters.
+ *  @return ConfigStoreStats_t, Counters.
+ */
+ConfigStoreStats_t config_store_stats()
+{
+	return ConfigStats_g;
+}
+
+#pragma endregion
@@ -0,0 +1,127 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// ConfigStore.h
+
+#ifndef _CONFIGSTORE_h
+#define _CONFIGSTORE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#include <FS.h>
+
+#include "NetworkConfiguration.h"
+
+#include "DeviceConfiguration.h"
+
+#include "MQTTConfiguration.h"
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef CONFIG_STORE_SLOT_A
+/* @brief First slot of the binary configuration. */
+#define CONFIG_STORE_SLOT_A "/config.a.bin"
+#endif // !CONFIG_STORE_SLOT_A
+
+#ifndef CONFIG_STORE_SLOT_B
+/* @brief Second slot of the binary configuration. */
+#define CONFIG_STORE_SLOT_B "/config.b.bin"
+#endif // !CONFIG_STORE_SLOT_B
+
+#ifndef CONFIG_STORE_MAX_SIZE
+/** @brief Maximum size of the record, header included. */
+#define CONFIG_STORE_MAX_SIZE 1024
+#endif // !CONFIG_STORE_MAX_SIZE
+
+/** @brief Record magic, "IOTR" in the file. */
+#define CONFIG_STORE_MAGIC 0x52544F49UL
+
+/** @brief Record layout version. New fields are appended and bump it. */
+#define CONFIG_STORE_VERSION 1
+
+/** @brief Header size: magic (4), version (2), length (2), sequence (4) and CRC32 (4). */
+#define CONFIG_STORE_HEADER_SIZE 16
+
+/** @brief Count of the record slots. */
+#define CONFIG_STORE_SLOTS 2
+
+/** @brief No valid slot. */
+#define CONFIG_STORE_NO_SLOT 0xFF
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Configuration store counters, for flash wear monitoring. */
+typedef struct {
+	uint32_t Sequence; ///< Sequence of the active record, count of the writes over the device life.
+	unsigned long Writes; ///< Records written since boot.
+	unsigned long Skipped; ///< Saves skipped since boot, nothing changed.
+	unsigned long Failures; ///< Failed writes since boot.
+} ConfigStoreStats_t;
+
+#pragma endregion
+
+#pragma region Functions
+
+/** @brief Load the network, device and MQTT configuration.
+ *
+ *  The record is kept in two slots, the valid one with the newest
+ *  sequence wins. JSON files left by older firmware or uploaded with
+ *  the editor are imported on top of it, saved to the record and removed.
+ *
+ *  @param fileSystem FS, File system of the device.
+ *  @return boolean, True if a record or a JSON file was loaded, defaults otherwise.
+ */
+bool load_configuration(FS* fileSystem);
+
+/** @brief Save the network, device and MQTT configuration.
+ *
+ *  The record goes to the older slot and is read back before it becomes
+ *  active, so a power loss while writing leaves the previous one in place.
+ *  Nothing is written if the content did not change.
+ *
+ *  @param fileSystem FS, File system of the device.
+ *  @return boolean, Successful saving.
+ */
+bool save_configuration(FS* fileSystem);
+
+/** @brief Get the store counters.
+ *  @return ConfigStoreStats_t, Counters.
+ */
+ConfigStoreStats_t config_store_stats();
+
+#pragma endregion
+
+#endif
+
@@ -86,16 +86,11 @@ bool load_device_config(FS* fileSystem, const char* path) {
 	return true;
 }
 
-/** @brief Save authentication data.
+/** @brief Export authentication data as JSON.
+ *  @param output Print, Destination of the JSON.
  *  @return boolean, Return true if successful.
  */
-bool save_device_config(FS* fileSystem, const char* path) {
-#ifdef SHOW_FUNC_NAMES
-	DEBUGLOG("\r\n");
-	DEBUGLOG(__PRETTY_FUNCTION__);
-	DEBUGLOG("\r\n");
-#endif // SHOW_FUNC_NAMES
-
+bool save_device_config(Print* output) {
 	//flag_config = false;
 	DynamicJsonDocument doc(256);
 	// Logins
@@ -110,6 +105,25 @@ bool save_device_config(FS* fileSystem, const char* path) {
 	// Activation code.
 	doc["activation_code"] = DeviceConfiguration.ActivationCode;
 
+	String temp;
+	serializeJson(doc, temp);
+	DEBUGLOG("%s\r\n", temp.c_str());
+
+	serializeJson(doc, *output);
+
+	return true;
+}
+
+/** @brief Save authentication data.
+ *  @return boolean, Return true if successful.
+ */
+bool save_device_config(FS* fileSystem, const char* path) {
+#ifdef SHOW_FUNC_NAMES
+	DEBUGLOG("\r\n");
+	DEBUGLOG(__PRETTY_FUNCTION__);
+	DEBUGLOG("\r\n");
+#endif // SHOW_FUNC_NAMES
+
 	File file = fileSystem->open(path, "w");
 
 	if (!file) {
@@ -118,11 +132,7 @@ bool save_device_config(FS* fileSystem, const char* path) {
 		return false;
 	}
 
-	String temp;
-	serializeJson(doc, temp);
-	DEBUGLOG("%s\r\n", temp.c_str());
-
-	serializeJson(doc, file);
+	save_device_config(&file);
 	file.flush();
 	file.close();
 
@@ -83,6 +83,12 @@ bool load_device_config(FS* fileSystem, const char* path);
  */
 bool save_device_config(FS* fileSystem, const char* path);
 
+/** @brief Export authentication data as JSON.
+ *  @param output Print, Destination of the JSON.
+ *  @return boolean, Return true if successful.
+ */
+bool save_device_config(Print* output);
+
 bool set_default_device_config();
 
 #pragma endregion
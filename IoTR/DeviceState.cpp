@@ -25,10 +25,28 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "DeviceState.h"
 
+#include "GeneralHelper.h"
+
 /* @brief Singelton device state instance. */
 DeviceState_t DeviceState;
 
-String dev_state_to_json() {
+/** @brief Keys of the state fields, in bit order. */
+static const char* const StateKeys_g[] = {
+	"Wall",
+	"CliffLeft",
+	"CliffFrontLeft",
+	"CliffFrontRight",
+	"CliffRight",
+	"BumpersAndWheelDrops",
+};
+
+/** @brief Write device state as JSON.
+ *  @param buffer char*, Target buffer.
+ *  @param size size_t, Buffer size.
+ *  @param fields uint8_t, Field bits to write.
+ *  @return size_t, Length or 0 if the buffer is too small.
+ */
+size_t dev_state_to_json(char* buffer, size_t size, uint8_t fields) {
 /*
 #ifdef SHOW_FUNC_NAMES
 	DEBUGLOG("\r\n");
@@ -36,17 +54,56 @@ String dev_state_to_json() {
 	DEBUGLOG("\r\n");
 #endif // SHOW_FUNC_NAMES
 */
-	String json = "";
-	json += "{";
-	json += "\"Wall\":" + String(DeviceState.Wall);
-	json += ",\"CliffLeft\":" + String(DeviceState.CliffLeft);
-	json += ",\"CliffFrontLeft\":" + String(DeviceState.CliffFrontLeft);
-	json += ",\"CliffFrontRight\":" + String(DeviceState.CliffFrontRight);
-	json += ",\"CliffRight\":" + String(DeviceState.CliffRight);
-	json += ",\"BumpersAndWheelDrops\":" + String(DeviceState.BumpersAndWheelDrops);
-	json += "}";
-
-	//DEBUGLOG("%s\r\n", json.c_str());
-
-	return json;
-}
\ No newline at end of file
+
+	const unsigned int ValuesL[] = {
+		DeviceState.Wall,
+		DeviceState.CliffLeft,
+		DeviceState.CliffFrontLeft,
+		DeviceState.CliffFrontRight,
+		DeviceState.CliffRight,
+		DeviceState.BumpersAndWheelDrops,
+	};
+
+	size_t LengthL = 0;
+	bool FitsL = buffer_append(buffer, size, &LengthL, "{");
+
+	for (uint8_t index = 0; index < (sizeof(ValuesL) / sizeof(ValuesL[0])); index++)
+	{
+		if ((fields & (1U << index)) == 0)
+		{
+			continue;
+		}
+
+		FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"%s\":%u",
+			(LengthL > 1) ? "," : "", StateKeys_g[index], ValuesL[index]);
+	}
+
+	FitsL = FitsL && buffer_append(buffer, size, &LengthL, "}");
+
+	if (!FitsL)
+	{
+		return 0;
+	}
+
+	//DEBUGLOG("%s\r\n", buffer);
+
+	return LengthL;
+}
+
+/** @brief Compare device state with snapshot.
+ *  @param last const DeviceState_t*, Snapshot.
+ *  @return uint8_t, Bits of the changed fields.
+ */
+uint8_t dev_state_diff(const DeviceState_t* last) {
+
+	uint8_t FieldsL = 0;
+
+	if (DeviceState.Wall != last->Wall) FieldsL |= DEVICE_STATE_WALL;
+	if (DeviceState.CliffLeft != last->CliffLeft) FieldsL |= DEVICE_STATE_CLIFF_LEFT;
+	if (DeviceState.CliffFrontLeft != last->CliffFrontLeft) FieldsL |= DEVICE_STATE_CLIFF_FRONT_LEFT;
+	if (DeviceState.CliffFrontRight != last->CliffFrontRight) FieldsL |= DEVICE_STATE_CLIFF_FRONT_RIGHT;
+	if (DeviceState.CliffRight != last->CliffRight) FieldsL |= DEVICE_STATE_CLIFF_RIGHT;
+	if (DeviceState.BumpersAndWheelDrops != last->BumpersAndWheelDrops) FieldsL |= DEVICE_STATE_BUMPERS;
+
+	return FieldsL;
+}
@@ -39,10 +39,36 @@ typedef struct {
 	uint8_t BumpersAndWheelDrops = false; ///< Device name.
 } DeviceState_t;
 
+/** @brief Size of the encoded state buffer. */
+#define DEVICE_STATE_BUFFER_SIZE 160
+
+/** @brief State field bits, select the encoded fields. */
+#define DEVICE_STATE_WALL 0x01
+#define DEVICE_STATE_CLIFF_LEFT 0x02
+#define DEVICE_STATE_CLIFF_FRONT_LEFT 0x04
+#define DEVICE_STATE_CLIFF_FRONT_RIGHT 0x08
+#define DEVICE_STATE_CLIFF_RIGHT 0x10
+#define DEVICE_STATE_BUMPERS 0x20
+
+/** @brief All state fields. */
+#define DEVICE_STATE_ALL 0x3F
+
 /* @brief Singelton device state. */
 extern DeviceState_t DeviceState;
 
-String dev_state_to_json();
+/** @brief Write device state as JSON.
+ *  @param buffer char*, Target buffer.
+ *  @param size size_t, Buffer size.
+ *  @param fields uint8_t, Field bits to write.
+ *  @return size_t, Length or 0 if the buffer is too small.
+ */
+size_t dev_state_to_json(char* buffer, size_t size, uint8_t fields = DEVICE_STATE_ALL);
+
+/** @brief Compare device state with snapshot.
+ *  @param last const DeviceState_t*, Snapshot.
+ *  @return uint8_t, Bits of the changed fields.
+ */
+uint8_t dev_state_diff(const DeviceState_t* last);
 
 #endif
 
@@ -4,10 +4,18 @@
 
 #include "DeviceStatus.h"
 
+#include "GeneralHelper.h"
+
 /* @brief Singleton device stater instance. */
 DeviceStatus_t DeviceStatus;
 
-String dev_status_to_json() {
+/** @brief Write device status as JSON.
+ *  @param buffer char*, Target buffer.
+ *  @param size size_t, Buffer size.
+ *  @param fields uint16_t, Field bits to write.
+ *  @return size_t, Length or 0 if the buffer is too small.
+ */
+size_t dev_status_to_json(char* buffer, size_t size, uint16_t fields) {
 /*
 #ifdef SHOW_FUNC_NAMES
 	DEBUGLOG("\r\n");
@@ -16,17 +24,154 @@ String dev_status_to_json() {
 #endif // SHOW_FUNC_NAMES
 */
 
-	String json = "";
-	json += "{";
-	json += "\"ts\":" + String(DeviceStatus.Timestamp);
-	json += ",\"rssi\":" + String(DeviceStatus.RSSI);
-	json += ",\"ssid\":\"" + DeviceStatus.SSID + "\"";
-	json += ",\"voltage\":" + String(DeviceStatus.Voltage);
-	json += ",\"free_heap\":" + String(DeviceStatus.FreeHeap);
-	json += ",\"flags\":" + String(DeviceStatus.Flags);
-	json += "}";
+	size_t LengthL = 0;
+	bool FitsL = buffer_append(buffer, size, &LengthL, "{");
+
+	// Separator before every field but the first.
+#define SEP ((LengthL > 1) ? "," : "")
+
+	if (fields & DEVICE_STATUS_TS) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"ts\":%lu", SEP, DeviceStatus.Timestamp);
+	if (fields & DEVICE_STATUS_RSSI) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"rssi\":%d", SEP, DeviceStatus.RSSI);
+	if (fields & DEVICE_STATUS_SSID) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"ssid\":\"%s\"", SEP, DeviceStatus.SSID.c_str());
+	if (fields & DEVICE_STATUS_VOLTAGE) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"voltage\":%.2f", SEP, DeviceStatus.Voltage);
+	if (fields & DEVICE_STATUS_FREE_HEAP) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"free_heap\":%u", SEP, DeviceStatus.FreeHeap);
+	if (fields & DEVICE_STATUS_FLAGS) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"flags\":%u", SEP, DeviceStatus.Flags);
+	if (fields & DEVICE_STATUS_SER_TX_DEPTH) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"ser_tx_depth\":%u", SEP, DeviceStatus.SerialTxDepth);
+	if (fields & DEVICE_STATUS_SER_TX_DROPS) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"ser_tx_drops\":%lu", SEP, DeviceStatus.SerialTxDropped);
+	if (fields & DEVICE_STATUS_WIFI_ATTEMPTS) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"wifi_attempts\":%lu", SEP, DeviceStatus.WiFiAttempts);
+	if (fields & DEVICE_STATUS_WIFI_DOWNTIME) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"wifi_downtime\":%lu", SEP, DeviceStatus.WiFiDowntime);
+	if (fields & DEVICE_STATUS_MQTT_ATTEMPTS) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"mqtt_attempts\":%lu", SEP, DeviceStatus.MqttAttempts);
+	if (fields & DEVICE_STATUS_MQTT_DOWNTIME) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"mqtt_downtime\":%lu", SEP, DeviceStatus.MqttDowntime);
+	if (fields & DEVICE_STATUS_OFFLINE_QUEUED) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"offline_queued\":%lu", SEP, DeviceStatus.OfflineQueued);
+	if (fields & DEVICE_STATUS_OFFLINE_DROPS) FitsL = FitsL && buffer_append(buffer, size, &LengthL, "%s\"offline_drops\":%lu", SEP, DeviceStatus.OfflineDropped);
+
+#undef SEP
+
+	FitsL = FitsL && buffer_append(buffer, size, &LengthL, "}");
+
+	if (!FitsL)
+	{
+		return 0;
+	}
+
+	//DEBUGLOG("%s\r\n", buffer);
+
+	return LengthL;
+}
+
+/** @brief Write device status as MessagePack, same keys as JSON.
+ *  @param buffer uint8_t*, Target buffer.
+ *  @param size size_t, Buffer size.
+ *  @param fields uint16_t, Field bits to write.
+ *  @return size_t, Length or 0 if the buffer is too small.
+ */
+size_t dev_status_to_msgpack(uint8_t* buffer, size_t size, uint16_t fields) {
+
+	MsgPackWriter WriterL(buffer, size);
+
+	WriterL.writeMap(__builtin_popcount(fields & DEVICE_STATUS_ALL));
+
+	if (fields & DEVICE_STATUS_TS)
+	{
+		WriterL.writeString("ts");
+		WriterL.writeUInt(DeviceStatus.Timestamp);
+	}
+	if (fields & DEVICE_STATUS_RSSI)
+	{
+		WriterL.writeString("rssi");
+		WriterL.writeInt(DeviceStatus.RSSI);
+	}
+	if (fields & DEVICE_STATUS_SSID)
+	{
+		WriterL.writeString("ssid");
+		WriterL.writeString(DeviceStatus.SSID.c_str(), DeviceStatus.SSID.length());
+	}
+	if (fields & DEVICE_STATUS_VOLTAGE)
+	{
+		WriterL.writeString("voltage");
+		WriterL.writeFloat(DeviceStatus.Voltage);
+	}
+	if (fields & DEVICE_STATUS_FREE_HEAP)
+	{
+		WriterL.writeString("free_heap");
+		WriterL.writeUInt(DeviceStatus.FreeHeap);
+	}
+	if (fields & DEVICE_STATUS_FLAGS)
+	{
+		WriterL.writeString("flags");
+		WriterL.writeUInt(DeviceStatus.Flags);
+	}
+	if (fields & DEVICE_STATUS_SER_TX_DEPTH)
+	{
+		WriterL.writeString("ser_tx_depth");
+		WriterL.writeUInt(DeviceStatus.SerialTxDepth);
+	}
+	if (fields & DEVICE_STATUS_SER_TX_DROPS)
+	{
+		WriterL.writeString("ser_tx_drops");
+		WriterL.writeUInt(DeviceStatus.SerialTxDropped);
+	}
+	if (fields & DEVICE_STATUS_WIFI_ATTEMPTS)
+	{
+		WriterL.writeString("wifi_attempts");
+		WriterL.writeUInt(DeviceStatus.WiFiAttempts);
+	}
+	if (fields & DEVICE_STATUS_WIFI_DOWNTIME)
+	{
+		WriterL.writeString("wifi_downtime");
+		WriterL.writeUInt(DeviceStatus.WiFiDowntime);
+	}
+	if (fields & DEVICE_STATUS_MQTT_ATTEMPTS)
+	{
+		WriterL.writeString("mqtt_attempts");
+		WriterL.writeUInt(DeviceStatus.MqttAttempts);
+	}
+	if (fields & DEVICE_STATUS_MQTT_DOWNTIME)
+	{
+		WriterL.writeString("mqtt_downtime");
+		WriterL.writeUInt(DeviceStatus.MqttDowntime);
+	}
+	if (fields & DEVICE_STATUS_OFFLINE_QUEUED)
+	{
+		WriterL.writeString("offline_queued");
+		WriterL.writeUInt(DeviceStatus.OfflineQueued);
+	}
+	if (fields & DEVICE_STATUS_OFFLINE_DROPS)
+	{
+		WriterL.writeString("offline_drops");
+		WriterL.writeUInt(DeviceStatus.OfflineDropped);
+	}
+
+	if (WriterL.overflow())
+	{
+		return 0;
+	}
+
+	return WriterL.length();
+}
+
+/** @brief Compare device status with snapshot.
+ *  @param last const DeviceStatus_t*, Snapshot.
+ *  @return uint16_t, Bits of the changed fields.
+ */
+uint16_t dev_status_diff(const DeviceStatus_t* last) {
+
+	uint16_t FieldsL = 0;
 
-	//DEBUGLOG("%s\r\n", json.c_str());
+	if (DeviceStatus.Timestamp != last->Timestamp) FieldsL |= DEVICE_STATUS_TS;
+	if (DeviceStatus.RSSI != last->RSSI) FieldsL |= DEVICE_STATUS_RSSI;
+	if (DeviceStatus.SSID != last->SSID) FieldsL |= DEVICE_STATUS_SSID;
+	if (DeviceStatus.Voltage != last->Voltage) FieldsL |= DEVICE_STATUS_VOLTAGE;
+	if (DeviceStatus.FreeHeap != last->FreeHeap) FieldsL |= DEVICE_STATUS_FREE_HEAP;
+	if (DeviceStatus.Flags != last->Flags) FieldsL |= DEVICE_STATUS_FLAGS;
+	if (DeviceStatus.SerialTxDepth != last->SerialTxDepth) FieldsL |= DEVICE_STATUS_SER_TX_DEPTH;
+	if (DeviceStatus.SerialTxDropped != last->SerialTxDropped) FieldsL |= DEVICE_STATUS_SER_TX_DROPS;
+	if (DeviceStatus.WiFiAttempts != last->WiFiAttempts) FieldsL |= DEVICE_STATUS_WIFI_ATTEMPTS;
+	if (DeviceStatus.WiFiDowntime != last->WiFiDowntime) FieldsL |= DEVICE_STATUS_WIFI_DOWNTIME;
+	if (DeviceStatus.MqttAttempts != last->MqttAttempts) FieldsL |= DEVICE_STATUS_MQTT_ATTEMPTS;
+	if (DeviceStatus.MqttDowntime != last->MqttDowntime) FieldsL |= DEVICE_STATUS_MQTT_DOWNTIME;
+	if (DeviceStatus.OfflineQueued != last->OfflineQueued) FieldsL |= DEVICE_STATUS_OFFLINE_QUEUED;
+	if (DeviceStatus.OfflineDropped != last->OfflineDropped) FieldsL |= DEVICE_STATUS_OFFLINE_DROPS;
 
-	return json;
+	return FieldsL;
 }
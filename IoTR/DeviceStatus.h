@@ -32,6 +32,36 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "ApplicationConfiguration.h"
 
+#include "MsgPack.h"
+
+/** @brief Size of the encoded status buffer. */
+#define DEVICE_STATUS_BUFFER_SIZE 512
+
+/** @brief Status field bits, select the encoded fields. */
+#define DEVICE_STATUS_TS 0x0001
+#define DEVICE_STATUS_RSSI 0x0002
+#define DEVICE_STATUS_SSID 0x0004
+#define DEVICE_STATUS_VOLTAGE 0x0008
+#define DEVICE_STATUS_FREE_HEAP 0x0010
+#define DEVICE_STATUS_FLAGS 0x0020
+#define DEVICE_STATUS_SER_TX_DEPTH 0x0040
+#define DEVICE_STATUS_SER_TX_DROPS 0x0080
+#define DEVICE_STATUS_WIFI_ATTEMPTS 0x0100
+#define DEVICE_STATUS_WIFI_DOWNTIME 0x0200
+#define DEVICE_STATUS_MQTT_ATTEMPTS 0x0400
+#define DEVICE_STATUS_MQTT_DOWNTIME 0x0800
+#define DEVICE_STATUS_OFFLINE_QUEUED 0x1000
+#define DEVICE_STATUS_OFFLINE_DROPS 0x2000
+
+/** @brief All status fields. */
+#define DEVICE_STATUS_ALL 0x3FFF
+
+/** @brief Serial out bytes were dropped since the last status. */
+#define STATUS_FLAG_SER_TX_DROP 0x0001
+
+/** @brief Serial out sender is asked to pause. */
+#define STATUS_FLAG_SER_TX_PAUSED 0x0002
+
 /*
 {
 	"ts": 1584114705,
@@ -49,12 +79,40 @@ typedef struct {
 	float Voltage = 0; ///< Device voltage.
 	int RSSI = 0; ///< Device name.
 	String SSID = ""; ///< Device name.
+	unsigned int SerialTxDepth = 0; ///< Serial out queue depth.
+	unsigned long SerialTxDropped = 0; ///< Serial out dropped bytes.
+	unsigned long WiFiAttempts = 0; ///< WiFi reconnect attempts.
+	unsigned long WiFiDowntime = 0; ///< Current or last WiFi outage [ms].
+	unsigned long MqttAttempts = 0; ///< MQTT reconnect attempts.
+	unsigned long MqttDowntime = 0; ///< Current or last MQTT outage [ms].
+	unsigned long OfflineQueued = 0; ///< Messages kept for replay.
+	unsigned long OfflineDropped = 0; ///< Messages dropped while offline.
 } DeviceStatus_t;
 
 /* @brief Singelton device stater instance. */
 extern DeviceStatus_t DeviceStatus;
 
-String dev_status_to_json();
+/** @brief Write device status as JSON.
+ *  @param buffer char*, Target buffer.
+ *  @param size size_t, Buffer size.
+ *  @param fields uint16_t, Field bits to write.
+ *  @return size_t, Length or 0 if the buffer is too small.
+ */
+size_t dev_status_to_json(char* buffer, size_t size, uint16_t fields = DEVICE_STATUS_ALL);
+
+/** @brief Write device status as MessagePack, same keys as JSON.
+ *  @param buffer uint8_t*, Target buffer.
+ *  @param size size_t, Buffer size.
+ *  @param fields uint16_t, Field bits to write.
+ *  @return size_t, Length or 0 if the buffer is too small.
+ */
+size_t dev_status_to_msgpack(uint8_t* buffer, size_t size, uint16_t fields = DEVICE_STATUS_ALL);
+
+/** @brief Compare device status with snapshot.
+ *  @param last const DeviceStatus_t*, Snapshot.
+ *  @return uint16_t, Bits of the changed fields.
+ */
+uint16_t dev_status_diff(const DeviceStatus_t* last);
 
 #endif
 
@@ -0,0 +1,293 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "EventFanout.h"
+
+/** @brief Attach to event source. Takes its connect callback.
+ *  @param source AsyncEventSource*, Event source.
+ *  @return Void.
+ */
+void EventFanout::attach(AsyncEventSource* source)
+{
+	m_source = source;
+	source->onConnect([this](AsyncEventSourceClient* client) {
+		DEBUGLOG("Event source client connected from %s\r\n", client->client()->remoteIP().toString().c_str());
+		this->add(client);
+	});
+}
+
+/** @brief Add client.
+ *  @param client AsyncEventSourceClient*, Client.
+ *  @return Void.
+ */
+void EventFanout::add(AsyncEventSourceClient* client)
+{
+	enter();
+
+	for (uint8_t index = 0; index < EVENT_FANOUT_MAX_CLIENTS; index++)
+	{
+		if (m_clients[index].Client != NULL)
+		{
+			continue;
+		}
+
+		// New client gets the latest of every type, the full value of the changes.
+		m_clients[index].Client = client;
+		m_clients[index].Pending = (uint8_t)((1U << m_slotsCount) - 1);
+		m_clients[index].Resync = m_clients[index].Pending;
+		m_clients[index].Stalled = false;
+		m_pending = true;
+
+		leave();
+		return;
+	}
+
+	leave();
+
+	DEBUGLOG("Event source clients limit, closing.\r\n");
+	client->close();
+}
+
+/** @brief Stop tracking client.
+ *  @param index uint8_t, Client entry.
+ *  @return Void.
+ */
+void EventFanout::remove(uint8_t index)
+{
+	enter();
+	m_clients[index].Client = NULL;
+	m_clients[index].Pending = 0;
+	m_clients[index].Resync = 0;
+	leave();
+}
+
+/** @brief Check that the tracked clients still exist, close all of them if not.
+ *  @return bool, True if the tracked clients can be used.
+ */
+bool EventFanout::validate()
+{
+	size_t TrackedL = 0;
+
+	enter();
+	for (uint8_t index = 0; index < EVENT_FANOUT_MAX_CLIENTS; index++)
+	{
+		if (m_clients[index].Client != NULL)
+		{
+			TrackedL++;
+		}
+	}
+	leave();
+
+	// A client that is just connecting is counted before it is tracked,
+	// so only fewer clients than tracked means one of them is gone.
+	if ((TrackedL == 0) || (m_source->count() >= TrackedL))
+	{
+		return true;
+	}
+
+	// Which one is not known, its entry may point to freed memory.
+	// Forget all of them, the pages reconnect and get the full values.
+	DEBUGLOG("Event source client gone, closing all.\r\n");
+
+	for (uint8_t index = 0; index < EVENT_FANOUT_MAX_CLIENTS; index++)
+	{
+		remove(index);
+	}
+
+	m_source->close();
+
+	return false;
+}
+
+/** @brief Find or take slot for event.
+ *  @param event const char*, Event name.
+ *  @return int, Slot index or -1 if there is no free slot.
+ */
+int EventFanout::slot(const char* event)
+{
+	for (uint8_t index = 0; index < m_slotsCount; index++)
+	{
+		if (strcmp(m_slots[index].Event, event) == 0)
+		{
+			return index;
+		}
+	}
+
+	if (m_slotsCount == EVENT_FANOUT_SLOTS)
+	{
+		return -1;
+	}
+
+	m_slots[m_slotsCount].Event = event;
+
+	return m_slotsCount++;
+}
+
+/** @brief Serialize event frame.
+ *  @param frame String, Target frame.
+ *  @param event const char*, Event name.
+ *  @param data const char*, Event data.
+ *  @return Void.
+ */
+void EventFanout::serialize(String& frame, const char* event, const char* data)
+{
+	frame = "";
+	frame.reserve(strlen(event) + strlen(data) + 24);
+	frame += "event: ";
+	frame += event;
+	frame += "\r\ndata: ";
+
+	// Every data line needs its own field.
+	for (const char* SymbolL = data; *SymbolL != '\0'; SymbolL++)
+	{
+		if (*SymbolL == '\n')
+		{
+			frame += "\r\ndata: ";
+		}
+		else
+		{
+			frame += *SymbolL;
+		}
+	}
+
+	frame += "\r\n\r\n";
+}
+
+/** @brief Publish event, replaces the previous one of the same type.
+ *  @param event const char*, Event name, must stay valid.
+ *  @param data const char*, Event data.
+ *  @param snapshot const char*, Full value if the data are only changes, NULL if not.
+ *  @return Void.
+ */
+void EventFanout::publish(const char* event, const char* data, const char* snapshot)
+{
+	int SlotL = slot(event);
+
+	if (SlotL < 0)
+	{
+		DEBUGLOG("No event slot for %s\r\n", event);
+		return;
+	}
+
+	// Serialize once for all clients.
+	EventSlot_t* EntryL = &m_slots[SlotL];
+	serialize(EntryL->Frame, event, data);
+
+	if (snapshot == NULL)
+	{
+		EntryL->Snapshot = "";
+	}
+	else if (snapshot == data)
+	{
+		EntryL->Snapshot = EntryL->Frame;
+	}
+	else
+	{
+		serialize(EntryL->Snapshot, event, snapshot);
+	}
+
+	uint8_t BitL = (uint8_t)(1U << SlotL);
+
+	enter();
+
+	for (uint8_t index = 0; index < EVENT_FANOUT_MAX_CLIENTS; index++)
+	{
+		if (m_clients[index].Client != NULL)
+		{
+			// Undelivered change is replaced, the client needs the full value.
+			if ((m_clients[index].Pending & BitL) != 0)
+			{
+				m_clients[index].Resync |= BitL;
+			}
+
+			m_clients[index].Pending |= BitL;
+			m_pending = true;
+		}
+	}
+
+	leave();
+}
+
+/** @brief Deliver pending events and close stalled clients. Call it from the main loop.
+ *  @return Void.
+ */
+void EventFanout::update()
+{
+	if ((m_source == nullptr) || !validate() || !m_pending)
+	{
+		return;
+	}
+
+	m_pending = false;
+
+	for (uint8_t index = 0; index < EVENT_FANOUT_MAX_CLIENTS; index++)
+	{
+		EventClient_t* EntryL = &m_clients[index];
+
+		if ((EntryL->Client == NULL) || (EntryL->Pending == 0))
+		{
+			continue;
+		}
+
+		// Keep the pending bits, the client gets the latest when it drains.
+		if (EntryL->Client->packetsWaiting() >= EVENT_FANOUT_MAX_BACKLOG)
+		{
+			m_pending = true;
+
+			if (!EntryL->Stalled)
+			{
+				EntryL->Stalled = true;
+				EntryL->StalledTime = millis();
+			}
+			else if ((millis() - EntryL->StalledTime) > EVENT_FANOUT_STALL_TIMEOUT)
+			{
+				DEBUGLOG("Event source client stalled, closing.\r\n");
+				EntryL->Client->close();
+				remove(index);
+			}
+
+			continue;
+		}
+
+		EntryL->Stalled = false;
+
+		for (uint8_t slot = 0; slot < m_slotsCount; slot++)
+		{
+			if ((EntryL->Pending & (1U << slot)) == 0)
+			{
+				continue;
+			}
+
+			const String& FrameL = (((EntryL->Resync & (1U << slot)) != 0) && (m_slots[slot].Snapshot.length() > 0))
+				? m_slots[slot].Snapshot : m_slots[slot].Frame;
+
+			EntryL->Client->write(FrameL.c_str(), FrameL.length());
+		}
+
+		EntryL->Pending = 0;
+		EntryL->Resync = 0;
+	}
+}
+
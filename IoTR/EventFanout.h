@@ -0,0 +1,185 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// EventFanout.h
+
+#ifndef _EVENTFANOUT_h
+#define _EVENTFANOUT_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#include <ESPAsyncWebServer.h>
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef EVENT_FANOUT_SLOTS
+/** @brief Count of the coalesced event types, up to 8. */
+#define EVENT_FANOUT_SLOTS 4
+#endif // !EVENT_FANOUT_SLOTS
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Latest event of one type. */
+typedef struct {
+	const char* Event; ///< Event name.
+	String Frame; ///< Serialized event, ready for all clients.
+	String Snapshot; ///< Serialized full value, empty if the events are not changes.
+} EventSlot_t;
+
+/** @brief Subscribed client. */
+typedef struct {
+	AsyncEventSourceClient* Client; ///< Client or NULL if the entry is free.
+	uint8_t Pending; ///< Slots not delivered to the client, one bit per slot.
+	uint8_t Resync; ///< Slots where the client missed a change and needs the snapshot.
+	bool Stalled; ///< Client backlog is full.
+	unsigned long StalledTime; ///< Time the backlog became full [ms].
+} EventClient_t;
+
+#pragma endregion
+
+/** @brief Event source fan-out with coalescing.
+ *
+ *  Each event is serialized once and kept as the latest of its type.
+ *  Clients get the latest of every pending type when their backlog allows,
+ *  so a slow client skips the old values instead of queueing them, and a
+ *  client that stays stalled for EVENT_FANOUT_STALL_TIMEOUT is closed.
+ *  Events that carry only the changes are published with the full value,
+ *  new clients and clients that missed a change get the full value instead.
+ *  The event source deletes its clients on disconnect and does not report
+ *  it, so the tracked clients are used only while the source still has as
+ *  many connected, otherwise all are closed and the pages reconnect.
+ */
+class EventFanout
+{
+protected:
+
+	/** @brief Event source of the clients. */
+	AsyncEventSource* m_source = nullptr;
+
+#ifdef ESP32
+	/** @brief Guard of the clients, AsyncTCP connects them in its own task. */
+	portMUX_TYPE m_mux = portMUX_INITIALIZER_UNLOCKED;
+#endif // ESP32
+
+	/** @brief Latest events. */
+	EventSlot_t m_slots[EVENT_FANOUT_SLOTS];
+
+	/** @brief Count of the used slots. */
+	uint8_t m_slotsCount = 0;
+
+	/** @brief Clients. */
+	EventClient_t m_clients[EVENT_FANOUT_MAX_CLIENTS] = {};
+
+	/** @brief There is something to deliver. */
+	bool m_pending = false;
+
+	/** @brief Enter the critical section.
+	 *  @return Void.
+	 */
+	inline void enter()
+	{
+#ifdef ESP32
+		portENTER_CRITICAL(&m_mux);
+#else
+		noInterrupts();
+#endif // ESP32
+	}
+
+	/** @brief Leave the critical section.
+	 *  @return Void.
+	 */
+	inline void leave()
+	{
+#ifdef ESP32
+		portEXIT_CRITICAL(&m_mux);
+#else
+		interrupts();
+#endif // ESP32
+	}
+
+	/** @brief Find or take slot for event.
+	 *  @param event const char*, Event name.
+	 *  @return int, Slot index or -1 if there is no free slot.
+	 */
+	int slot(const char* event);
+
+	/** @brief Add client.
+	 *  @param client AsyncEventSourceClient*, Client.
+	 *  @return Void.
+	 */
+	void add(AsyncEventSourceClient* client);
+
+	/** @brief Stop tracking client.
+	 *  @param index uint8_t, Client entry.
+	 *  @return Void.
+	 */
+	void remove(uint8_t index);
+
+	/** @brief Check that the tracked clients still exist, close all of them if not.
+	 *  @return bool, True if the tracked clients can be used.
+	 */
+	bool validate();
+
+	/** @brief Serialize event frame.
+	 *  @param frame String, Target frame.
+	 *  @param event const char*, Event name.
+	 *  @param data const char*, Event data.
+	 *  @return Void.
+	 */
+	static void serialize(String& frame, const char* event, const char* data);
+
+public:
+
+	/** @brief Attach to event source. Takes its connect callback.
+	 *  @param source AsyncEventSource*, Event source.
+	 *  @return Void.
+	 */
+	void attach(AsyncEventSource* source);
+
+	/** @brief Publish event, replaces the previous one of the same type.
+	 *  @param event const char*, Event name, must stay valid.
+	 *  @param data const char*, Event data.
+	 *  @param snapshot const char*, Full value if the data are only changes, NULL if not.
+	 *  @return Void.
+	 */
+	void publish(const char* event, const char* data, const char* snapshot = NULL);
+
+	/** @brief Deliver pending events and close stalled clients. Call it from the main loop.
+	 *  @return Void.
+	 */
+	void update();
+};
+
+#endif
@@ -0,0 +1,171 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "FileCache.h"
+
+/** @brief Content types by file extension. */
+static const char* const MIME_TYPES[][2] = {
+	{ ".htm", "text/html" },
+	{ ".html", "text/html" },
+	{ ".css", "text/css" },
+	{ ".js", "application/javascript" },
+	{ ".json", "application/json" },
+	{ ".png", "image/png" },
+	{ ".gif", "image/gif" },
+	{ ".jpg", "image/jpeg" },
+	{ ".ico", "image/x-icon" },
+	{ ".svg", "image/svg+xml" },
+	{ ".xml", "text/xml" },
+	{ ".pdf", "application/x-pdf" },
+	{ ".zip", "application/x-zip" },
+	{ ".gz", "application/x-gzip" },
+};
+
+/** @brief Get content type from the file extension.
+ *  @param path const char*, File path.
+ *  @return const char*, Content type.
+ */
+const char* get_mime_type(const char* path)
+{
+	const char* ExtensionL = strrchr(path, '.');
+
+	if (ExtensionL != NULL)
+	{
+		for (size_t index = 0; index < sizeof(MIME_TYPES) / sizeof(MIME_TYPES[0]); index++)
+		{
+			if (strcmp(ExtensionL, MIME_TYPES[index][0]) == 0)
+			{
+				return MIME_TYPES[index][1];
+			}
+		}
+	}
+
+	return "text/plain";
+}
+
+/** @brief Constructor.
+ *  @return FileCacheClass
+ */
+FileCacheClass::FileCacheClass()
+{
+	clear();
+}
+
+/** @brief Initialize the cache.
+ *  @param fileSystem FS*, File system.
+ *  @return Void.
+ */
+void FileCacheClass::init(FS* fileSystem)
+{
+	m_fileSystem = fileSystem;
+	clear();
+}
+
+/** @brief Load metadata of a path to entry.
+ *  @param entry FileMeta_t*, Entry to fill.
+ *  @param path const char*, File path.
+ *  @return Void.
+ */
+void FileCacheClass::load(FileMeta_t* entry, const char* path)
+{
+	strncpy(entry->Path, path, FILE_CACHE_PATH_SIZE - 1);
+	entry->Path[FILE_CACHE_PATH_SIZE - 1] = '\0';
+	entry->Exists = false;
+	entry->Gzip = false;
+	entry->Size = 0;
+	entry->MimeType = get_mime_type(path);
+
+	// Prefer the compressed sibling.
+	String PathWithGzL = String(path) + ".gz";
+	File FileL = m_fileSystem->open(PathWithGzL, "r");
+
+	if (FileL)
+	{
+		entry->Gzip = true;
+	}
+	else
+	{
+		FileL = m_fileSystem->open(path, "r");
+	}
+
+	if (FileL)
+	{
+		entry->Exists = true;
+		entry->Size = FileL.size();
+		FileL.close();
+	}
+
+	DEBUGLOG("File cache load: %s, exists: %d, gz: %d\r\n", entry->Path, entry->Exists, entry->Gzip);
+}
+
+/** @brief Get metadata of a path.
+ *  @param path const char*, File path.
+ *  @return const FileMeta_t*, Metadata.
+ */
+const FileMeta_t* FileCacheClass::get(const char* path)
+{
+	static FileMeta_t UncachedL;
+	FileMeta_t* OldestL = &m_entries[0];
+
+	m_tick++;
+
+	for (uint8_t index = 0; index < FILE_CACHE_SIZE; index++)
+	{
+		if ((m_entries[index].Path[0] != '\0') && (strcmp(m_entries[index].Path, path) == 0))
+		{
+			m_entries[index].LastUse = m_tick;
+			return &m_entries[index];
+		}
+
+		if (m_entries[index].LastUse < OldestL->LastUse)
+		{
+			OldestL = &m_entries[index];
+		}
+	}
+
+	// Paths that do not fit are not cached.
+	if (strlen(path) >= FILE_CACHE_PATH_SIZE)
+	{
+		load(&UncachedL, path);
+		return &UncachedL;
+	}
+
+	load(OldestL, path);
+	OldestL->LastUse = m_tick;
+
+	return OldestL;
+}
+
+/** @brief Drop all entries. Call after every file system change.
+ *  @return Void.
+ */
+void FileCacheClass::clear()
+{
+	for (uint8_t index = 0; index < FILE_CACHE_SIZE; index++)
+	{
+		m_entries[index].Path[0] = '\0';
+		m_entries[index].LastUse = 0;
+	}
+}
@@ -0,0 +1,131 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// FileCache.h
+
+#ifndef _FILECACHE_h
+#define _FILECACHE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#include <FS.h>
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef FILE_CACHE_SIZE
+/** @brief Count of the cached file entries. */
+#define FILE_CACHE_SIZE 8
+#endif // !FILE_CACHE_SIZE
+
+#ifndef FILE_CACHE_PATH_SIZE
+/** @brief Maximum cached path length including the terminator. */
+#define FILE_CACHE_PATH_SIZE 32
+#endif // !FILE_CACHE_PATH_SIZE
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Cached file metadata. */
+typedef struct {
+	char Path[FILE_CACHE_PATH_SIZE]; ///< Requested path, empty for free entry.
+	bool Exists; ///< File or its gzip sibling exists.
+	bool Gzip; ///< Gzip sibling is served.
+	size_t Size; ///< Size of the served file.
+	const char* MimeType; ///< Content type of the requested path.
+	uint32_t LastUse; ///< Use tick for the eviction.
+} FileMeta_t;
+
+#pragma endregion
+
+#pragma region Prototypes
+
+/** @brief Get content type from the file extension.
+ *  @param path const char*, File path.
+ *  @return const char*, Content type.
+ */
+const char* get_mime_type(const char* path);
+
+#pragma endregion
+
+/** @brief Metadata cache of the served file system files.
+ *
+ *  Keeps the existence, gzip sibling, size and content type of the recently
+ *  requested paths, including the missing ones, so the hits do not touch the file system.
+ */
+class FileCacheClass
+{
+protected:
+
+	/** @brief File system. */
+	FS* m_fileSystem = NULL;
+
+	/** @brief Cache entries. */
+	FileMeta_t m_entries[FILE_CACHE_SIZE];
+
+	/** @brief Use tick. */
+	uint32_t m_tick = 0;
+
+	/** @brief Load metadata of a path to entry.
+	 *  @param entry FileMeta_t*, Entry to fill.
+	 *  @param path const char*, File path.
+	 *  @return Void.
+	 */
+	void load(FileMeta_t* entry, const char* path);
+
+public:
+
+	/** @brief Constructor.
+	 *  @return FileCacheClass
+	 */
+	FileCacheClass();
+
+	/** @brief Initialize the cache.
+	 *  @param fileSystem FS*, File system.
+	 *  @return Void.
+	 */
+	void init(FS* fileSystem);
+
+	/** @brief Get metadata of a path.
+	 *  @param path const char*, File path.
+	 *  @return const FileMeta_t*, Metadata.
+	 */
+	const FileMeta_t* get(const char* path);
+
+	/** @brief Drop all entries. Call after every file system change.
+	 *  @return Void.
+	 */
+	void clear();
+};
+
+#endif
@@ -0,0 +1,233 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "FramePool.h"
+
+/** @brief Frame payload prefix. */
+static const char FRAME_PREFIX[] = "{\"ts\":";
+
+/** @brief Frame payload separator. */
+static const char FRAME_SEPARATOR[] = ",\"msg\":\"";
+
+/** @brief Frame payload suffix. */
+static const char FRAME_SUFFIX[] = "\"}";
+
+/** @brief Constructor.
+ *  @return FramePoolClass
+ */
+FramePoolClass::FramePoolClass()
+{
+	for (uint8_t index = 0; index < SERIAL_FRAME_POOL_SIZE; index++)
+	{
+		m_free[index] = SERIAL_FRAME_POOL_SIZE - 1 - index;
+	}
+
+	m_freeCount = SERIAL_FRAME_POOL_SIZE;
+}
+
+/** @brief Take a free frame.
+ *  @return SerialFrame_t*, Frame or nullptr if the pool is exhausted.
+ */
+SerialFrame_t* FramePoolClass::acquire()
+{
+	if (m_freeCount == 0)
+	{
+		m_exhausted++;
+		return nullptr;
+	}
+
+	SerialFrame_t* FrameL = &m_frames[m_free[--m_freeCount]];
+	FrameL->Timestamp = 0;
+	FrameL->Length = 0;
+
+	return FrameL;
+}
+
+/** @brief Give the frame back to the pool.
+ *  @param frame SerialFrame_t*, Frame taken by acquire().
+ *  @return Void.
+ */
+void FramePoolClass::release(SerialFrame_t* frame)
+{
+	if ((frame < m_frames) || (frame >= (m_frames + SERIAL_FRAME_POOL_SIZE)))
+	{
+		return;
+	}
+
+	if (m_freeCount < SERIAL_FRAME_POOL_SIZE)
+	{
+		m_free[m_freeCount++] = (uint8_t)(frame - m_frames);
+	}
+}
+
+/** @brief Count of the free frames.
+ *  @return uint8_t, Free frames.
+ */
+uint8_t FramePoolClass::available()
+{
+	return m_freeCount;
+}
+
+/** @brief Count of failed acquires.
+ *  @return unsigned long, Failed acquires.
+ */
+unsigned long FramePoolClass::getExhausted()
+{
+	return m_exhausted;
+}
+
+/** @brief Serialize message as JSON publish payload in the frame.
+ *  @param frame SerialFrame_t*, Target frame.
+ *  @param timestamp unsigned long long, Timestamp [ms].
+ *  @param data const char*, Message content.
+ *  @param length size_t, Message length.
+ *  @return size_t, Count of the message bytes that fit in the frame.
+ */
+size_t FramePoolClass::serialize(SerialFrame_t* frame, unsigned long long timestamp, const char* data, size_t length)
+{
+	static const char HexL[] = "0123456789abcdef";
+
+	char DigitsL[20];
+	uint8_t DigitsCountL = 0;
+	char* OutputL = frame->Payload;
+	// Room for the suffix and the terminator is kept aside.
+	char* EndL = frame->Payload + SERIAL_FRAME_PAYLOAD_SIZE - sizeof(FRAME_SUFFIX);
+	size_t ConsumedL = 0;
+	uint8_t SymbolL;
+
+	frame->Timestamp = timestamp;
+
+	memcpy(OutputL, FRAME_PREFIX, sizeof(FRAME_PREFIX) - 1);
+	OutputL += sizeof(FRAME_PREFIX) - 1;
+
+	do
+	{
+		DigitsL[DigitsCountL++] = (char)('0' + (timestamp % 10ULL));
+		timestamp /= 10ULL;
+	} while (timestamp > 0);
+
+	while (DigitsCountL > 0)
+	{
+		*OutputL++ = DigitsL[--DigitsCountL];
+	}
+
+	memcpy(OutputL, FRAME_SEPARATOR, sizeof(FRAME_SEPARATOR) - 1);
+	OutputL += sizeof(FRAME_SEPARATOR) - 1;
+
+	for (; ConsumedL < length; ConsumedL++)
+	{
+		SymbolL = (uint8_t)data[ConsumedL];
+
+		if ((SymbolL == '"') || (SymbolL == '\\') || (SymbolL < 0x20))
+		{
+			char EscapeL = 0;
+
+			if (SymbolL == '"') EscapeL = '"';
+			else if (SymbolL == '\\') EscapeL = '\\';
+			else if (SymbolL == '\n') EscapeL = 'n';
+			else if (SymbolL == '\r') EscapeL = 'r';
+			else if (SymbolL == '\t') EscapeL = 't';
+
+			if (EscapeL != 0)
+			{
+				if ((EndL - OutputL) < 2)
+				{
+					break;
+				}
+
+				*OutputL++ = '\\';
+				*OutputL++ = EscapeL;
+			}
+			else
+			{
+				if ((EndL - OutputL) < 6)
+				{
+					break;
+				}
+
+				*OutputL++ = '\\';
+				*OutputL++ = 'u';
+				*OutputL++ = '0';
+				*OutputL++ = '0';
+				*OutputL++ = HexL[SymbolL >> 4];
+				*OutputL++ = HexL[SymbolL & 0x0F];
+			}
+		}
+		else
+		{
+			if ((EndL - OutputL) < 1)
+			{
+				break;
+			}
+
+			*OutputL++ = (char)SymbolL;
+		}
+	}
+
+	// The suffix fits because it is excluded from EndL.
+	memcpy(OutputL, FRAME_SUFFIX, sizeof(FRAME_SUFFIX));
+	OutputL += sizeof(FRAME_SUFFIX) - 1;
+
+	frame->Length = (size_t)(OutputL - frame->Payload);
+
+	return ConsumedL;
+}
+
+/** @brief Serialize message as MessagePack publish payload in the frame.
+ *  @param frame SerialFrame_t*, Target frame.
+ *  @param timestamp unsigned long long, Timestamp [ms].
+ *  @param data const char*, Message content.
+ *  @param length size_t, Message length.
+ *  @return size_t, Count of the message bytes that fit in the frame.
+ */
+size_t FramePoolClass::serializeMsgPack(SerialFrame_t* frame, unsigned long long timestamp, const char* data, size_t length)
+{
+	// Map header, "ts" and "msg" keys and the widest timestamp.
+	const size_t HeaderL = 1 + 3 + 9 + 4;
+	size_t RoomL = SERIAL_FRAME_PAYLOAD_SIZE - HeaderL;
+
+	if (length + MsgPackWriter::stringHeaderSize(length) > RoomL)
+	{
+		length = RoomL - MsgPackWriter::stringHeaderSize(RoomL);
+	}
+
+	MsgPackWriter WriterL((uint8_t*)frame->Payload, SERIAL_FRAME_PAYLOAD_SIZE);
+
+	frame->Timestamp = timestamp;
+
+	// No escaping, the content is copied as it is.
+	WriterL.writeMap(2);
+	WriterL.writeString("ts", 2);
+	WriterL.writeUInt(timestamp);
+	WriterL.writeString("msg", 3);
+	WriterL.writeString(data, length);
+
+	frame->Length = WriterL.length();
+
+	return length;
+}
+
+/* @brief Singleton frame pool instance. */
+FramePoolClass FramePool;
@@ -0,0 +1,144 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// FramePool.h
+
+#ifndef _FRAMEPOOL_h
+#define _FRAMEPOOL_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#include "SerialIngest.h"
+
+#include "MsgPack.h"
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef SERIAL_FRAME_POOL_SIZE
+/** @brief Count of the preallocated frames. A frame is acquired and released within
+ *         one publish and the batch copies it, so one frame is ever in use. */
+#define SERIAL_FRAME_POOL_SIZE 1
+#endif // !SERIAL_FRAME_POOL_SIZE
+
+#ifndef SERIAL_FRAME_PAYLOAD_SIZE
+/** @brief Size of the publish payload of one frame. Escaped content that does not fit continues in the next frame. */
+#define SERIAL_FRAME_PAYLOAD_SIZE (SERIAL_FRAME_MAX_SIZE + 64)
+#endif // !SERIAL_FRAME_PAYLOAD_SIZE
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Serial frame structure.
+ *
+ *  Holds one serial message serialized as its publish payload.
+ */
+typedef struct {
+	unsigned long long Timestamp = 0; ///< Timestamp of the frame [ms].
+	size_t Length = 0; ///< Length of the payload.
+	char Payload[SERIAL_FRAME_PAYLOAD_SIZE]; ///< Publish payload.
+} SerialFrame_t;
+
+#pragma endregion
+
+/** @brief Fixed capacity pool of serial frames.
+ *
+ *  Frames are taken and given back without touching the heap.
+ */
+class FramePoolClass
+{
+protected:
+
+	/** @brief Frames storage. */
+	SerialFrame_t m_frames[SERIAL_FRAME_POOL_SIZE];
+
+	/** @brief Stack of the free frame indexes. */
+	uint8_t m_free[SERIAL_FRAME_POOL_SIZE];
+
+	/** @brief Count of the free frames. */
+	uint8_t m_freeCount = 0;
+
+	/** @brief Count of failed acquires. */
+	unsigned long m_exhausted = 0;
+
+public:
+
+	/** @brief Constructor.
+	 *  @return FramePoolClass
+	 */
+	FramePoolClass();
+
+	/** @brief Take a free frame.
+	 *  @return SerialFrame_t*, Frame or nullptr if the pool is exhausted.
+	 */
+	SerialFrame_t* acquire();
+
+	/** @brief Give the frame back to the pool.
+	 *  @param frame SerialFrame_t*, Frame taken by acquire().
+	 *  @return Void.
+	 */
+	void release(SerialFrame_t* frame);
+
+	/** @brief Count of the free frames.
+	 *  @return uint8_t, Free frames.
+	 */
+	uint8_t available();
+
+	/** @brief Count of failed acquires.
+	 *  @return unsigned long, Failed acquires.
+	 */
+	unsigned long getExhausted();
+
+	/** @brief Serialize message as JSON publish payload in the frame.
+	 *  @param frame SerialFrame_t*, Target frame.
+	 *  @param timestamp unsigned long long, Timestamp [ms].
+	 *  @param data const char*, Message content.
+	 *  @param length size_t, Message length.
+	 *  @return size_t, Count of the message bytes that fit in the frame.
+	 */
+	static size_t serialize(SerialFrame_t* frame, unsigned long long timestamp, const char* data, size_t length);
+
+	/** @brief Serialize message as MessagePack publish payload in the frame.
+	 *  @param frame SerialFrame_t*, Target frame.
+	 *  @param timestamp unsigned long long, Timestamp [ms].
+	 *  @param data const char*, Message content.
+	 *  @param length size_t, Message length.
+	 *  @return size_t, Count of the message bytes that fit in the frame.
+	 */
+	static size_t serializeMsgPack(SerialFrame_t* frame, unsigned long long timestamp, const char* data, size_t length);
+};
+
+/* @brief Singleton frame pool instance. */
+extern FramePoolClass FramePool;
+
+#endif
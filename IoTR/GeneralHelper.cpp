@@ -25,6 +25,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "GeneralHelper.h"
 
+#include <stdarg.h>
+
 /** @brief Get MAC address.
  *  @return String, Returns the string of MAC address.
  */
@@ -85,6 +87,35 @@ boolean check_octet_range(int value) {
 	return (value > 0 && value < 256);
 }
 
+/** @brief Append formatted text to buffer.
+ *  @param buffer char*, Target buffer.
+ *  @param size size_t, Buffer size.
+ *  @param length size_t*, Used length, updated.
+ *  @param format const char*, Format.
+ *  @return bool, False if the text does not fit.
+ */
+bool buffer_append(char* buffer, size_t size, size_t* length, const char* format, ...) {
+
+	if (*length >= size)
+	{
+		return false;
+	}
+
+	va_list ArgsL;
+	va_start(ArgsL, format);
+	int LengthL = vsnprintf(buffer + *length, size - *length, format, ArgsL);
+	va_end(ArgsL);
+
+	if ((LengthL < 0) || ((size_t)LengthL >= (size - *length)))
+	{
+		return false;
+	}
+
+	*length += (size_t)LengthL;
+
+	return true;
+}
+
 /** @brief Convert size to nice text type.
  *  @param bytes, size_t Size of the file.
  *  @return String, Nice formated size text.
@@ -82,6 +82,15 @@ boolean check_octet_range(String value);
  */
 boolean check_octet_range(int value);
 
+/** @brief Append formatted text to buffer.
+ *  @param buffer char*, Target buffer.
+ *  @param size size_t, Buffer size.
+ *  @param length size_t*, Used length, updated.
+ *  @param format const char*, Format.
+ *  @return bool, False if the text does not fit.
+ */
+bool buffer_append(char* buffer, size_t size, size_t* length, const char* format, ...);
+
 /** @brief Convert size to nice text type.
  *  @param bytes, size_t Size of the file.
  *  @return String, Nice formated size text.
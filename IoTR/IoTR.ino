@@ -52,13 +52,29 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 /* Device configuration. */
 #include "NetworkConfiguration.h"
 
+#include "ConfigStore.h"
+
 /* Base WEB server. */
 #include "WEBServer.h"
 
-#include "FxTimer.h"
-
 #include "DeviceStatus.h"
 
+#include "SerialIngest.h"
+
+#include "FramePool.h"
+
+#include "TelemetryBatch.h"
+
+#include "MqttTopics.h"
+
+#include "MqttDispatcher.h"
+
+#include "SerialTxQueue.h"
+
+#include "BackoffTimer.h"
+
+#include "OfflineQueue.h"
+
 #ifdef ENABLE_ARDUINO_OTA
 #include <ArduinoOTA.h>
 #endif // ENABLE_ARDUINO_OTA
@@ -86,6 +102,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "DeviceState.h"
 
+#include "BootSequencer.h"
+
+#include "Scheduler.h"
+
+#include "LoopProfiler.h"
+
 #pragma endregion
 
 #pragma region Classes
@@ -122,8 +144,6 @@ protected:
 			}
 
 			request->send(200, MIME_TYPE_PLAIN_TEXT, "");
-
-			this->clearAliveTime();
 		});
 
 		// Start device.
@@ -140,8 +160,6 @@ protected:
 			}
 
 			request->send(200, MIME_TYPE_PLAIN_TEXT, "");
-
-			this->clearAliveTime();
 		});
 
 		on("/api/v1/keepalive", [this](AsyncWebServerRequest* request) {
@@ -152,8 +170,6 @@ protected:
 			}
 
 			request->send(200, MIME_TYPE_PLAIN_TEXT, "");
-
-			this->clearAliveTime();
 		});
 
 		// Start device.
@@ -171,21 +187,22 @@ protected:
 					DEBUGLOG("Arg %s: %s\r\n", request->argName(index).c_str(), urlDecode(request->arg(index)).c_str());
 
 					// HTTP Authentication.
+					// Async context, the loop writes to the port.
 					if (request->argName(index) == "read") {
-						Serial.print(urlDecode(request->arg(index)));
+						String DataL = urlDecode(request->arg(index));
+						SerialTxQueue.push((const uint8_t*)DataL.c_str(), DataL.length());
 						continue;
 					}
 
 					if (request->argName(index) == "write") {
-						Serial.print(urlDecode(request->arg(index)));
+						String DataL = urlDecode(request->arg(index));
+						SerialTxQueue.push((const uint8_t*)DataL.c_str(), DataL.length());
 						continue;
 					}
 				}
 			}
 
 			request->send(200, MIME_TYPE_PLAIN_TEXT, "");
-
-			this->clearAliveTime();
 		});
 
 	}
@@ -202,9 +219,10 @@ public:
 	/**
 	 * @brief Execute every one second, if attached event. Part of the API.
 	 * 
-	 * @param device_state Device state.
+	 * @param device_state Changed device state fields.
+	 * @param snapshot All device state fields, for clients that missed a change.
 	 */
-	void sendDeviceState(String device_state) {
+	void sendDeviceState(const char* device_state, const char* snapshot) {
 	/*
 	#ifdef SHOW_FUNC_NAMES
 		DEBUGLOG("\r\n");
@@ -213,11 +231,8 @@ public:
 	#endif // SHOW_FUNC_NAMES
 	*/
 
-		// Check does have someone connected.
-		if (m_webSocketEvents.count() > 0)
-		{
-			m_webSocketEvents.send(device_state.c_str(), ESS_DEV_STATE);
-		}
+		// Kept as the latest also without clients, new clients get the snapshot first.
+		m_eventFanout.publish(ESS_DEV_STATE, device_state, snapshot);
 	}
 
 	/**
@@ -290,20 +305,52 @@ WiFiUDP NTP_UDP_g;
 NTPClient NTPClient_g(NTP_UDP_g);
 
 /** @brief WiFi connection timer. */
-FxTimer WiFiConnTimer_g = FxTimer();
+BackoffTimer WiFiConnTimer_g = BackoffTimer();
+
+/** @brief First station connect is in progress. */
+bool WiFiConnecting_g = false;
+
+/** @brief Boot stages followed from the loop. */
+uint8_t BootWiFi_g = BOOT_NO_STAGE;
+uint8_t BootMqtt_g = BOOT_NO_STAGE;
+uint8_t BootTelemetry_g = BOOT_NO_STAGE;
+uint8_t BootWeb_g = BOOT_NO_STAGE;
+
+/** @brief Boot profile was published. */
+bool BootProfileSent_g = false;
 
 /** @brief MQTT connection timer. */
-FxTimer MQTTConnTimer_g = FxTimer();
+BackoffTimer MQTTConnTimer_g = BackoffTimer();
+
+/** @brief Last published device status. */
+DeviceStatus_t LastStatus_g;
+
+/** @brief Last published device state. */
+DeviceState_t LastState_g;
 
-/** @brief Heart beat timer. */
-FxTimer HeartbeatTimer_g = FxTimer();
+/** @brief Time of the last full device status [ms]. */
+unsigned long StatusTime_g = 0;
 
-/** @brief Device state timer. */
-FxTimer DeviceStateTimer_g = FxTimer();
+/** @brief Time of the last full device state [ms]. */
+unsigned long StateTime_g = 0;
 
 /** @brief MQTT client */
 AsyncMqttClient MQTTClient_g;
 
+/** @brief Encoded device status. */
+char StatusBuff_g[DEVICE_STATUS_BUFFER_SIZE];
+
+/** @brief Encoded device state. */
+char StateBuff_g[DEVICE_STATE_BUFFER_SIZE];
+
+/** @brief All fields of the status or the state, for the WEB clients that missed a change. The status is the larger. */
+char SnapshotBuff_g[DEVICE_STATUS_BUFFER_SIZE];
+
+#ifdef ENABLE_LOOP_PROFILER
+/** @brief Encoded loop profile. */
+char ProfileBuff_g[PROFILER_BUFFER_SIZE];
+#endif // ENABLE_LOOP_PROFILER
+
 #ifdef ENABLE_IR_INTERFACE
 
 /**
@@ -321,9 +368,6 @@ decode_results IRResults_g;
 
 #endif // ENABLE_IR_INTERFACE
 
-/** @brief Timestamp text buffer. */
-char TimestampBuff_g[18];
-
 /**
  * @brief Application WEB server.
  * 
@@ -377,6 +421,12 @@ void handler_ap_mode_station_disconnected(const WiFiEventSoftAPModeStationDiscon
  */
 void configure_to_sta();
 
+/**
+ * @brief Follow the first station connect, go to AP mode if it takes too long.
+ * 
+ */
+void update_sta_connect();
+
 /**
  * @brief Printout in the debug console flash state.
  * 
@@ -391,6 +441,12 @@ void show_device_properties();
 void configure_arduino_ota();
 #endif // ENABLE_ARDUINO_OTA
 
+/**
+ * @brief Publish the boot profile once, when all boot stages are done.
+ * 
+ */
+void publish_boot_profile();
+
 #pragma endregion
 
 #pragma region Functions
@@ -410,7 +466,7 @@ void power_on() {
 
 	digitalWrite(PIN_RELAY, HIGH);
 	// Publish message.
-	MQTTClient_g.publish(TOPIC_RELAY_OUT, 2, true, "1");
+	MQTTClient_g.publish(MqttTopics.get(TopicRelayOut), 2, true, "1");
 }
 
 /**
@@ -426,7 +482,7 @@ void power_off() {
 
 	digitalWrite(PIN_RELAY, LOW);
 	// Publish message.
-	MQTTClient_g.publish(TOPIC_RELAY_OUT, 2, true, "0");
+	MQTTClient_g.publish(MqttTopics.get(TopicRelayOut), 2, true, "0");
 }
 
 #pragma endregion
@@ -636,8 +692,8 @@ void configure_to_sta() {
 	// improves reconnect reliability.
 	WiFi.disconnect();
 
-	// Encourage clean recovery after disconnect species5618, 08-March-2018.
-	WiFi.setAutoReconnect(true);
+	// Reconnects are scheduled by wifi_reconnect() with backoff.
+	WiFi.setAutoReconnect(false);
 	WiFi.mode(WIFI_STA);
 
 	DEBUGLOG("Connecting: %s\r\n", NetworkConfiguration.SSID.c_str());
@@ -651,27 +707,42 @@ void configure_to_sta() {
 		WiFi.config(NetworkConfiguration.IP, NetworkConfiguration.Gateway, NetworkConfiguration.NetMask, NetworkConfiguration.DNS);
 	}
 
+	// Do not wait here, update_sta_connect() follows the connect from the loop.
 	WiFiConnTimer_g.setExpirationTime(TIMEOUT_TO_CONNECT * 1000UL);
-	while (WiFi.status() != WL_CONNECTED)
-	{ // Wait for the Wi-Fi to connect
+	WiFiConnTimer_g.updateLastTime();
+	WiFiConnecting_g = true;
+}
+
+/**
+ * @brief Follow the first station connect, go to AP mode if it takes too long.
+ * 
+ */
+void update_sta_connect()
+{
+	if (WiFi.status() != WL_CONNECTED)
+	{
 		//DEBUGLOG("Stat: %d\r\n", WiFi.status());
 		WiFiConnTimer_g.update();
 		if (WiFiConnTimer_g.expired())
 		{
 			WiFiConnTimer_g.clear();
+			WiFiConnecting_g = false;
 			configure_to_ap();
-			return;
+#ifdef ENABLE_STATUS_LED
+			StatusLed.setAnumation(AnimationType::Blue);
+#endif // ENABLE_STATUS_LED
 		}
-		delay(500);
-#ifdef ESP32
-// ESP32
-
-#elif defined(ESP8266)
-// ESP8266
-		ESP.wdtFeed();
-#endif
+		return;
 	}
 
+	WiFiConnecting_g = false;
+	BootSequencer.mark(BootWiFi_g);
+
+	// From now on the timer schedules reconnects.
+	WiFiConnTimer_g.setPolicy(WIFI_RECONNECT_MIN_DELAY, WIFI_RECONNECT_MAX_DELAY, WIFI_RECONNECT_JITTER);
+	WiFiConnTimer_g.seed(get_device_seed());
+	WiFiConnTimer_g.reset();
+
 	DEBUGLOG("Connected:  %s\r\n", NetworkConfiguration.SSID.c_str());
 	DEBUGLOG("IP Address: %s\r\n", WiFi.localIP().toString().c_str());
 	DEBUGLOG("Gateway:    %s\r\n", WiFi.gatewayIP().toString().c_str());
@@ -679,6 +750,43 @@ void configure_to_sta() {
 	DEBUGLOG("\r\n");
 }
 
+/**
+ * @brief WiFi Reconnect.
+ * 
+ */
+void wifi_reconnect()
+{
+	WiFiConnTimer_g.markDown();
+
+	// Check does the timer has expired.
+	WiFiConnTimer_g.update();
+
+	// If yes schedule the next attempt and try to connect.
+	if (WiFiConnTimer_g.expired())
+	{
+		WiFiConnTimer_g.next();
+
+		DEBUGLOG("WiFi reconnect, next in %lu ms.\r\n", WiFiConnTimer_g.getExpirationTime());
+		WiFi.reconnect();
+	}
+}
+
+/**
+ * @brief Get seed unique to the device.
+ * 
+ * @return uint32_t Seed.
+ */
+uint32_t get_device_seed()
+{
+#ifdef ESP32
+	uint64_t MacL = ESP.getEfuseMac();
+
+	return (uint32_t)MacL ^ (uint32_t)(MacL >> 32);
+#elif defined(ESP8266)
+	return ESP.getChipId();
+#endif
+}
+
 #pragma endregion
 
 #pragma region Local WEB Server
@@ -698,6 +806,7 @@ void configure_web_server() {
 	AppWEBServer_g.setCbReboot(reboot);
 	AppWEBServer_g.setCbStopDevice(power_off);
 	AppWEBServer_g.setCbStartDevice(power_on);
+	AppWEBServer_g.setCbConsoleInput(on_console_input);
 }
 
 /**
@@ -827,20 +936,23 @@ void onMqttConnect(bool sessionPresent) {
 
 	uint16_t PacketIdSubL;
 
+	MQTTConnTimer_g.reset();
+	BootSequencer.mark(BootMqtt_g);
+
 	DEBUGLOG("Connected to MQTT.\r\n");
 	DEBUGLOG("Session present: %d\r\n", sessionPresent);
 
-	PacketIdSubL = MQTTClient_g.subscribe(TOPIC_SER_OUT, 2);
-	DEBUGLOG("Subscribing at QoS 2, packetId: %d\r\n", PacketIdSubL);
+	PacketIdSubL = MQTTClient_g.subscribe(MqttTopics.get(TopicSerialOut), MqttConfiguration.CommandQoS);
+	DEBUGLOG("Subscribing at QoS %d, packetId: %d\r\n", MqttConfiguration.CommandQoS, PacketIdSubL);
 
-	PacketIdSubL = MQTTClient_g.subscribe(TOPIC_STAT, 2);
-	DEBUGLOG("Subscribing at QoS 2, packetId: %d\r\n", PacketIdSubL);
+	PacketIdSubL = MQTTClient_g.subscribe(MqttTopics.get(TopicStatus), MqttConfiguration.CommandQoS);
+	DEBUGLOG("Subscribing at QoS %d, packetId: %d\r\n", MqttConfiguration.CommandQoS, PacketIdSubL);
 
-	PacketIdSubL = MQTTClient_g.subscribe(TOPIC_RELAY_IN, 2);
-	DEBUGLOG("Subscribing at QoS 2, packetId: %d\r\n", PacketIdSubL);
+	PacketIdSubL = MQTTClient_g.subscribe(MqttTopics.get(TopicRelayIn), MqttConfiguration.CommandQoS);
+	DEBUGLOG("Subscribing at QoS %d, packetId: %d\r\n", MqttConfiguration.CommandQoS, PacketIdSubL);
 
-	PacketIdSubL = MQTTClient_g.subscribe(TOPIC_UPDATE, 2);
-	DEBUGLOG("Subscribing at QoS 2, packetId: %d\r\n", PacketIdSubL);
+	PacketIdSubL = MQTTClient_g.subscribe(MqttTopics.get(TopicUpdate), MqttConfiguration.CommandQoS);
+	DEBUGLOG("Subscribing at QoS %d, packetId: %d\r\n", MqttConfiguration.CommandQoS, PacketIdSubL);
 }
 
 /**
@@ -857,9 +969,8 @@ void onMqttDisconnect(AsyncMqttClientDisconnectReason reason) {
 
 	DEBUGLOG("Disconnected from MQTT.\r\n");
 
-	if (WiFi.isConnected()) {
-		//mqttReconnectTimer.once(2, connectToMqtt);
-	}
+	// mqtt_reconnect() schedules the next attempt from the network task.
+	MQTTConnTimer_g.markDown();
 }
 
 /**
@@ -896,6 +1007,83 @@ void onMqttUnsubscribe(uint16_t packetId) {
 	DEBUGLOG("  packetId: %d\r\n", packetId);
 }
 
+/**
+ * @brief Firmware update request handler.
+ * 
+ * @param payload Payload data.
+ * @param length Payload length.
+ * @param index Offset in the message.
+ * @param total Message length.
+ */
+void on_update_request(const char* payload, size_t length, size_t index, size_t total)
+{
+	if (length == 0)
+	{
+		return;
+	}
+
+	if ((uint8_t)payload[0] != (uint8_t)ESP_FW_VERSION)
+	{
+		DEBUGLOG("Time to update.\r\n");
+		//check_update_ESP();
+	}
+	else
+	{
+		DEBUGLOG("No need to update.\r\n");
+	}
+}
+
+/**
+ * @brief Serial out handler, queues the slices for the device as they come.
+ * 
+ * @param payload Payload data.
+ * @param length Payload length.
+ * @param index Offset in the message.
+ * @param total Message length.
+ */
+void on_serial_out(const char* payload, size_t length, size_t index, size_t total)
+{
+	// Do not block the network context, loop() drains the queue.
+	SerialTxQueue.push((const uint8_t*)payload, length);
+}
+
+#ifdef ENABLE_SERIAL_FLOW_CONTROL
+/**
+ * @brief Publish serial out flow control state.
+ * 
+ * @param paused True when the sender has to pause.
+ */
+void publish_serial_flow(bool paused)
+{
+	MQTTClient_g.publish(MqttTopics.get(TopicSerialFlow), 1, true, paused ? "XOFF" : "XON");
+}
+#endif // ENABLE_SERIAL_FLOW_CONTROL
+
+/**
+ * @brief Power control handler.
+ * 
+ * @param payload Payload data.
+ * @param length Payload length.
+ * @param index Offset in the message.
+ * @param total Message length.
+ */
+void on_relay_request(const char* payload, size_t length, size_t index, size_t total)
+{
+	if (length == 0)
+	{
+		return;
+	}
+
+	if (payload[0] == '0')
+	{
+		power_off();
+	}
+	if (payload[0] == '1')
+	{
+		power_on();
+	}
+}
+
 /**
  * @brief On MQTT Message
  * 
@@ -919,43 +1107,7 @@ void onMqttMessage(
 	DEBUGLOG("\r\n");
 #endif // SHOW_FUNC_NAMES
 
-	String tp = String(topic);
-
-	// Update request.
-	if (tp == TOPIC_UPDATE)
-	{
-		if ((uint8_t)payload[0] != (uint8_t)ESP_FW_VERSION)
-		{
-			DEBUGLOG("Time to update.\r\n");
-			//check_update_ESP();
-		}
-		else
-		{
-			DEBUGLOG("No need to update.\r\n");
-		}
-	}
-
-	// Serial out.
-	if (tp == TOPIC_SER_OUT)
-	{
-		for (size_t idx = 0; idx < len; idx++)
-		{
-			Serial.print(payload[idx]);
-		}
-	}
-
-	// Power control.
-	if (tp == TOPIC_RELAY_IN)
-	{
-		if (payload[0] == '0')
-		{
-			power_off();
-		}
-		if (payload[0] == '1')
-		{
-			power_on();
-		}
-	}
+	MqttDispatcher.dispatch(topic, payload, len, index, total);
 
 	DEBUGLOG("Publish received.\r\n");
 	DEBUGLOG("  topic: %s\r\n", topic);
@@ -1002,7 +1154,16 @@ void mqtt_begin() {
 	MQTTClient_g.onPublish(onMqttPublish);
 	MQTTClient_g.setServer(MqttConfiguration.Domain.c_str(), MqttConfiguration.Port);
 
-	MQTTConnTimer_g.setExpirationTime(5000);
+	MqttDispatcher.on(TopicUpdate, on_update_request, true);
+	MqttDispatcher.on(TopicSerialOut, on_serial_out);
+	MqttDispatcher.on(TopicRelayIn, on_relay_request, true);
+
+	TelemetryBatch.setBudget(MqttConfiguration.BatchSize);
+	TelemetryBatch.setInterval(MqttConfiguration.BatchInterval);
+	TelemetryBatch.setFlushCb(publish_device_batch);
+
+	MQTTConnTimer_g.setPolicy(MQTT_RECONNECT_MIN_DELAY, MQTT_RECONNECT_MAX_DELAY, MQTT_RECONNECT_JITTER);
+	MQTTConnTimer_g.seed(get_device_seed() ^ 0x5A5A5A5AUL);
 }
 
 /**
@@ -1011,13 +1172,15 @@ void mqtt_begin() {
  */
 void mqtt_reconnect()
 {
+	MQTTConnTimer_g.markDown();
+
 	// Check does the timer has expired.
 	MQTTConnTimer_g.update();
 
-	// If yes clear it and try to connect.
+	// If yes schedule the next attempt and try to connect.
 	if (MQTTConnTimer_g.expired())
 	{
-		MQTTConnTimer_g.clear();
+		MQTTConnTimer_g.next();
 
 		if (MqttConfiguration.Auth)
 		{
@@ -1026,267 +1189,715 @@ void mqtt_reconnect()
 				MqttConfiguration.Password.c_str());
 		}
 
+		// Topics follow the host name, so build them for this connection.
+		MqttTopics.build(NetworkConfiguration.Hostname.c_str());
+
 		MQTTClient_g.setClientId(NetworkConfiguration.Hostname.c_str());
 		MQTTClient_g.connect();
 	}
 }
 
 /**
- * @brief Read incoming data from the serial buffer.
+ * @brief Get the current time in milliseconds since epoch.
  * 
+ * @return unsigned long long Timestamp.
  */
-void read_device_serial()
+unsigned long long get_timestamp_ms()
 {
-	static String JSONMsgL = "";
-	static String MessageL = "";
-	static unsigned long long TSL = 0;
+	// Get epoch time.
+	unsigned long long TSL = (unsigned long long)NTPClient_g.getEpochTime();
 
-	if (COM_PORT.available() < 1)
-	{
-		return;
-	}
+	// Add miliseconds
+	TSL *= 1000ULL;
+
+	// Add the miliseconds part.
+	TSL += (unsigned long long)(millis() % 999ULL);
+
+	return TSL;
+}
+
+/**
+ * @brief Publish batch of serial frames.
+ * 
+ * @param payload Array of frames.
+ * @param length Payload length.
+ */
+void publish_device_batch(const char* payload, size_t length)
+{
+	MQTTClient_g.publish(MqttTopics.get(TopicSerialIn), MqttConfiguration.SerialQoS, MqttConfiguration.SerialRetain, payload, length);
+	BootSequencer.mark(BootTelemetry_g);
+}
 
-	while (COM_PORT.available() > 0)
+/**
+ * @brief Publish message kept while offline.
+ * 
+ * @param id Topic identifier.
+ * @param payload Payload.
+ * @param length Payload length.
+ * @return true Published.
+ * @return false Not published, try again later.
+ */
+bool replay_offline_message(MqttTopicId id, const char* payload, size_t length)
+{
+	uint8_t QoSL = MqttConfiguration.SerialQoS;
+	bool RetainL = MqttConfiguration.SerialRetain;
+
+	if (id == TopicStatus)
 	{
-		// Add new char.
-		MessageL += (char)COM_PORT.read();
-		// Wait a while for a a new char.
-		delay(1);
-		//ESP.wdtFeed();
-		yield();
+		QoSL = MqttConfiguration.StatusQoS;
+		RetainL = MqttConfiguration.StatusRetain;
 	}
 
-	// If command if not empty parse it.
-	if (MessageL != "")
+	return MQTTClient_g.publish(MqttTopics.get(id), QoSL, RetainL, payload, length) != 0;
+}
+
+/**
+ * @brief Publish one frame received from the device serial port.
+ * 
+ * @param data Frame content.
+ * @param length Frame length.
+ */
+void publish_device_frame(const char* data, size_t length)
+{
+	SerialFrame_t* FrameL;
+	size_t ConsumedL;
+	unsigned long long TSL = get_timestamp_ms();
+
+	// Content that does not fit after escaping continues in the next frame.
+	while (length > 0)
 	{
-		// Get epoch time.
-		TSL = (unsigned long long)NTPClient_g.getEpochTime();
+		FrameL = FramePool.acquire();
+		if (FrameL == nullptr)
+		{
+			DEBUGLOG("Frame pool exhausted.\r\n");
+			return;
+		}
 
-		// Add miliseconds
-		TSL *= 1000ULL;
+		// Serialize the publish payload in place.
+		if (MqttConfiguration.Encoding == MQTT_ENCODING_MSGPACK)
+		{
+			ConsumedL = FramePool.serializeMsgPack(FrameL, TSL, data, length);
+		}
+		else
+		{
+			ConsumedL = FramePool.serialize(FrameL, TSL, data, length);
+		}
 
-		// Add the miliseconds part.
-		TSL += (unsigned long long)(millis() % 999ULL);
+		if (!MQTTClient_g.connected())
+		{
+			// Replayed after reconnect.
+			OfflineQueue.push(TopicSerialIn, FrameL->Payload, FrameL->Length);
+		}
+		else if (MqttConfiguration.Batch)
+		{
+			// Timestamp is part of the frame, so it stays with it in the batch.
+			// The settings are applied here, so changes from the page take effect at once.
+			TelemetryBatch.setEncoding(MqttConfiguration.Encoding);
+			TelemetryBatch.setBudget(MqttConfiguration.BatchSize);
+			TelemetryBatch.setInterval(MqttConfiguration.BatchInterval);
+			TelemetryBatch.append(FrameL->Payload, FrameL->Length);
+		}
+		else
+		{
+			// Publish message.
+			MQTTClient_g.publish(MqttTopics.get(TopicSerialIn), MqttConfiguration.SerialQoS, MqttConfiguration.SerialRetain, FrameL->Payload, FrameL->Length);
+			BootSequencer.mark(BootTelemetry_g);
+		}
 
-		// Print it to the buffer.
-		sprintf(TimestampBuff_g, "%llu", TSL);
+		FramePool.release(FrameL);
 
-		// Form the JSON message.
-		JSONMsgL += "{\"ts\":";
-		JSONMsgL += String(TimestampBuff_g);
-		JSONMsgL += ", \"msg\":\"";
-		JSONMsgL += MessageL;
-		JSONMsgL += "\"}";
+		data += ConsumedL;
+		length -= ConsumedL;
+	}
+}
 
-		// Publish message.
-		MQTTClient_g.publish(TOPIC_SER_IN, 2, true, JSONMsgL.c_str());
+/**
+ * @brief Serial in frame handler, shared by the local console and the broker.
+ * 
+ * @param data Frame content.
+ * @param length Frame length.
+ */
+void on_device_frame(const char* data, size_t length)
+{
+	// Operators next to the robot get it without the broker.
+	AppWEBServer_g.sendConsole(data, length);
 
-		// Clear the command data buffer.
-		JSONMsgL = "";
-		MessageL = "";
+	// Frames are published or kept offline, AP mode has no broker at all.
+	if (WiFi.getMode() == WIFI_STA)
+	{
+		publish_device_frame(data, length);
 	}
 }
 
-#pragma endregion
+/**
+ * @brief Local console input handler, queues the keys for the device.
+ * 
+ * @param data Input data.
+ * @param length Input length.
+ */
+void on_console_input(const uint8_t* data, size_t length)
+{
+	// Do not block the network context, loop() drains the queue.
+	SerialTxQueue.push(data, length);
+}
 
 #pragma endregion
 
-void setup()
+#pragma region Device Status
+
+/**
+ * @brief Sample the device status.
+ * 
+ */
+void sample_device_status()
 {
-	// Setup debug port module.
-	setup_debug_port();
+	DeviceStatus.Timestamp = NTPClient_g.getEpochTime(); // -DeviceConfiguration.NTPTimezone;
+#ifdef ESP32
+	DeviceStatus.Voltage = battery_voltage(PIN_BATT);
+#elif defined(ESP8266)
+	DeviceStatus.Voltage = 0.0F;
+#endif
+	DeviceStatus.RSSI = WiFi.RSSI();
+	DeviceStatus.SSID = NetworkConfiguration.SSID;
+	DeviceStatus.Flags = 0;
+	if (SerialTxQueue.takeDropFlag())
+	{
+		DeviceStatus.Flags |= STATUS_FLAG_SER_TX_DROP;
+	}
+	if (SerialTxQueue.paused())
+	{
+		DeviceStatus.Flags |= STATUS_FLAG_SER_TX_PAUSED;
+	}
+	DeviceStatus.SerialTxDepth = SerialTxQueue.depth();
+	DeviceStatus.SerialTxDropped = SerialTxQueue.getDropped();
+	DeviceStatus.WiFiAttempts = WiFiConnTimer_g.getAttempts();
+	DeviceStatus.WiFiDowntime = WiFiConnTimer_g.getDowntime();
+	DeviceStatus.MqttAttempts = MQTTConnTimer_g.getAttempts();
+	DeviceStatus.MqttDowntime = MQTTConnTimer_g.getDowntime();
+	DeviceStatus.OfflineQueued = OfflineQueue.count();
+	DeviceStatus.OfflineDropped = OfflineQueue.getDropped();
+	DeviceStatus.FreeHeap = ESP.getFreeHeap();
+
+	// part of the flags. - MQTTClient_g.connected();
+}
 
-	//
-	COM_PORT.begin(DeviceConfiguration.PortBaudrate);
+/**
+ * @brief Publish the changed status fields to the WEB clients and the broker.
+ * 
+ * @param keyframe Publish all fields.
+ */
+void publish_device_status(bool keyframe)
+{
+	uint16_t FieldsL = DEVICE_STATUS_ALL;
 
-	// Setup the relay.
-	pinMode(PIN_RELAY, OUTPUT);
+	if (!keyframe)
+	{
+		FieldsL = dev_status_diff(&LastStatus_g);
 
-#ifdef ENABLE_RESCUE_BTN
-	config_rescue_procedure();
-#endif // ENABLE_RESCUE_BTN
+		// Time stamp alone is not a change.
+		if ((FieldsL & ~DEVICE_STATUS_TS) == 0)
+		{
+			return;
+		}
+	}
 
-	// Turn ON the self power latch.
-	power_off();
+	// Every message has its time.
+	FieldsL |= DEVICE_STATUS_TS;
+	LastStatus_g = DeviceStatus;
 
-#ifdef ENABLE_STATUS_LED
-	// Setup the RGB led.
-	StatusLed.init(PIN_RGB_LED);
-#endif // ENABLE_STATUS_LED
+	// Event source is text only, so the page always gets JSON.
+	if (dev_status_to_json(StatusBuff_g, sizeof(StatusBuff_g), FieldsL) > 0)
+	{
+		const char* SnapshotL = StatusBuff_g;
 
-	// Show flash state.
-	show_device_properties();
+		if (FieldsL != DEVICE_STATUS_ALL)
+		{
+			SnapshotL = (dev_status_to_json(SnapshotBuff_g, sizeof(SnapshotBuff_g), DEVICE_STATUS_ALL) > 0) ? SnapshotBuff_g : NULL;
+		}
 
-	// Start the file system.
-	configure_file_system();
+		AppWEBServer_g.sendDeviceStatus(StatusBuff_g, SnapshotL);
+	}
 
-	// Try to load configuration from file system. Load defaults if any error.
-	if (!load_network_configuration(&SPIFFS, CONFIG_NET))
+	// AP mode has no broker, in STA the status is kept while offline too.
+	if (WiFi.getMode() != WIFI_STA)
 	{
-		save_network_configuration(&SPIFFS, CONFIG_NET);
+		return;
 	}
 
-	// Load HTTP authorization. Load defaults if any error.
-	if (!load_device_config(&SPIFFS, CONFIG_DEVICE))
+	size_t StatusLengthL;
+
+	if (MqttConfiguration.Encoding == MQTT_ENCODING_MSGPACK)
 	{
-		save_device_config(&SPIFFS, CONFIG_DEVICE);
+		StatusLengthL = dev_status_to_msgpack((uint8_t*)StatusBuff_g, sizeof(StatusBuff_g), FieldsL);
+	}
+	else
+	{
+		StatusLengthL = dev_status_to_json(StatusBuff_g, sizeof(StatusBuff_g), FieldsL);
 	}
 
-	// Load MQTT authorization. Load defaults if any error.
-	if (!load_mqtt_configuration(&SPIFFS, CONFIG_MQTT))
+	if (StatusLengthL == 0)
+	{
+		DEBUGLOG("Status does not fit in the buffer.\r\n");
+	}
+	else if (MQTTClient_g.connected())
 	{
-		save_mqtt_configuration(&SPIFFS, CONFIG_MQTT);
+		// Only the full status is retained, so new subscribers get all fields.
+		MQTTClient_g.publish(MqttTopics.get(TopicStatus), MqttConfiguration.StatusQoS, keyframe && MqttConfiguration.StatusRetain, StatusBuff_g, StatusLengthL);
+		BootSequencer.mark(BootTelemetry_g);
 	}
+	else if (keyframe)
+	{
+		// Changes are of no use after reconnect, the full status is.
+		OfflineQueue.push(TopicStatus, StatusBuff_g, StatusLengthL);
+	}
+}
 
-	// If no SSID and Password wer set the go to AP mode.
-	if (NetworkConfiguration.SSID != "" && NetworkConfiguration.Password != "")
+/**
+ * @brief Publish the changed state fields to the WEB clients,
+ * and all fields every DEVICE_STATE_KEYFRAME_TIME.
+ * 
+ * @param now Time of the scheduler pass [ms].
+ */
+void publish_device_state(unsigned long now)
+{
+	uint8_t FieldsL;
+
+	if ((now - StateTime_g) >= DEVICE_STATE_KEYFRAME_TIME)
 	{
-		configure_to_sta();
-		NTPClient_g.update();
-		DeviceStatusTimer_g.setExpirationTime(MQTT_HEARTBEAT_TIME);
-#ifdef ENABLE_STATUS_LED
-		StatusLed.setAnumation(AnimationType::Green);
-#endif // ENABLE_STATUS_LED
+		StateTime_g = now;
+		FieldsL = DEVICE_STATE_ALL;
 	}
 	else
 	{
-		configure_to_ap();
-#ifdef ENABLE_STATUS_LED
-		StatusLed.setAnumation(AnimationType::Blue);
-#endif // ENABLE_STATUS_LED
+		FieldsL = dev_state_diff(&LastState_g);
+
+		if (FieldsL == 0)
+		{
+			return;
+		}
 	}
 
-	DeviceStateTimer_g.setExpirationTime(1000);
-	configure_web_server();
+	LastState_g = DeviceState;
 
-#ifdef ENABLE_IR_INTERFACE
-	IRReceiver_g.enableIRIn();  // Start the receiver
-#endif // ENABLE_IR_INTERFACE
+	if (dev_state_to_json(StateBuff_g, sizeof(StateBuff_g), FieldsL) > 0)
+	{
+		const char* SnapshotL = StateBuff_g;
 
-#ifdef ENABLE_ARDUINO_OTA
-	configure_arduino_ota();
-#endif // ENABLE_ARDUINO_OTA
+		if (FieldsL != DEVICE_STATE_ALL)
+		{
+			SnapshotL = (dev_state_to_json(SnapshotBuff_g, sizeof(SnapshotBuff_g), DEVICE_STATE_ALL) > 0) ? SnapshotBuff_g : NULL;
+		}
 
-	if ((WiFi.getMode() == WIFI_STA) && WiFi.isConnected())
-	{
-		mqtt_begin();
+		AppWEBServer_g.sendDeviceState(StateBuff_g, SnapshotL);
 	}
 }
 
-void loop()
+#pragma endregion
+
+#pragma region Tasks
+
+/**
+ * @brief Task, sample the device status and publish the changes,
+ * all fields every MQTT_HEARTBEAT_TIME.
+ * 
+ * @param now Time of the scheduler pass [ms].
+ */
+void task_device_status(unsigned long now)
 {
-#ifdef ENABLE_RESQUE_BTN
-	update_rescue_procedure();
-#endif // ENABLE_RESQUE_BTN
+	PROFILE_BEGIN(ProfileStatus);
+
+	sample_device_status();
 
-	// 
-	AppWEBServer_g.update();
-	DeviceStateTimer_g.update();
-	if (DeviceStateTimer_g.expired())
+	bool KeyframeL = (now - StatusTime_g) >= MQTT_HEARTBEAT_TIME;
+	if (KeyframeL)
 	{
-		DeviceStateTimer_g.clear();
+		StatusTime_g = now;
+	}
 
-		AppWEBServer_g.sendDeviceStatus(dev_status_to_json());
+	publish_device_status(KeyframeL);
 
-		// Update animation.
-		AppWEBServer_g.sendDeviceState(dev_state_to_json());
+	// Below code will be removed after release.
+	DeviceState.BumpersAndWheelDrops++;
+	DeviceState.Wall = !DeviceState.Wall;
+	DeviceState.CliffLeft = !DeviceState.CliffLeft;
+	DeviceState.CliffFrontLeft = !DeviceState.CliffFrontLeft;
+	DeviceState.CliffFrontRight = !DeviceState.CliffFrontRight;
+	DeviceState.CliffRight = !DeviceState.CliffRight;
 
-		// Below code will be removed after release.
-		DeviceState.BumpersAndWheelDrops++;
-		DeviceState.Wall = !DeviceState.Wall;
-		DeviceState.CliffLeft = !DeviceState.CliffLeft;
-		DeviceState.CliffFrontLeft = !DeviceState.CliffFrontLeft;
-		DeviceState.CliffFrontRight = !DeviceState.CliffFrontRight;
-		DeviceState.CliffRight = !DeviceState.CliffRight;
+	if (DeviceState.BumpersAndWheelDrops > 15)
+	{
+		DeviceState.BumpersAndWheelDrops = 0;
+	}
 
-		if (DeviceState.BumpersAndWheelDrops > 15)
-		{
-			DeviceState.BumpersAndWheelDrops = 0;
-		}
+	PROFILE_END(ProfileStatus);
+}
 
-		//AppWEBServer_g.displayLog(dev_state_to_json());
-	}
+/**
+ * @brief Task, device state changes. The period is the rate cap.
+ * 
+ * @param now Time of the scheduler pass [ms].
+ */
+void task_device_state(unsigned long now)
+{
+	PROFILE_BEGIN(ProfileState);
+	publish_device_state(now);
+	PROFILE_END(ProfileState);
+}
+
+/**
+ * @brief Task, keep the transport layer up and move the queued messages.
+ * 
+ * @param now Time of the scheduler pass [ms].
+ */
+void task_network(unsigned long now)
+{
+	PROFILE_BEGIN(ProfileNetwork);
 
-	// If everything is OK with the transport layer.
-	if ((WiFi.getMode() == WIFI_STA) && WiFi.isConnected())
+	if (WiFiConnecting_g)
+	{
+		update_sta_connect();
+	}
+	else if ((WiFi.getMode() == WIFI_STA) && WiFi.isConnected())
 	{
+		// Back from WiFi outage.
+		if (WiFiConnTimer_g.down())
+		{
+			WiFiConnTimer_g.reset();
+		}
+
 		// Update date and time.
+		PROFILE_BEGIN(ProfileNtp);
 		NTPClient_g.update();
+		PROFILE_END(ProfileNtp);
 
 		// Reconnect MQTT if necessary.
 		if (!MQTTClient_g.connected())
 		{
+			PROFILE_BEGIN(ProfileMqtt);
 			mqtt_reconnect();
+			PROFILE_END(ProfileMqtt);
 		}
 		else
 		{
-			read_device_serial();
+			TelemetryBatch.update();
+			OfflineQueue.update();
+			publish_boot_profile();
 		}
+	}
+	else if (WiFi.getMode() == WIFI_STA)
+	{
+		// Reconnect WiFi if necessary.
+		wifi_reconnect();
+	}
 
-		// If heartbeat expired then run trough.
-		DeviceStatusTimer_g.update();
-		if (DeviceStatusTimer_g.expired())
-		{
-			DeviceStatusTimer_g.clear();
-			//DEBUGLOG("Time: %s\r\n", NTPClient_g.getFormattedTime().c_str());
-
-			DeviceStatus.Timestamp = NTPClient_g.getEpochTime(); // -DeviceConfiguration.NTPTimezone;
-#ifdef ESP32
-			DeviceStatus.Voltage = battery_voltage(PIN_BATT);
-#elif defined(ESP8266)
-			DeviceStatus.Voltage = 0.0F;
-#endif
-			DeviceStatus.RSSI = WiFi.RSSI();
-			DeviceStatus.SSID = NetworkConfiguration.SSID;
-			DeviceStatus.Flags = 0; // TODO: Flags
-			DeviceStatus.FreeHeap = ESP.getFreeHeap();
+	PROFILE_END(ProfileNetwork);
+}
 
-			// part of the flags. - MQTTClient_g.connected();
+#ifdef ENABLE_IR_INTERFACE
+/**
+ * @brief Task, poll the IR receiver.
+ * 
+ * @param now Time of the scheduler pass [ms].
+ */
+void task_ir_receiver(unsigned long now)
+{
+	PROFILE_BEGIN(ProfileIr);
 
-			if (MQTTClient_g.connected())
-			{
-				MQTTClient_g.publish(TOPIC_STAT, 0, true, dev_status_to_json().c_str());
-			}
-		}
+	if (!IRReceiver_g.decode(&IRResults_g))
+	{
+		PROFILE_END(ProfileIr);
+		return;
 	}
 
-#ifdef ENABLE_ARDUINO_OTA
-	ArduinoOTA.handle();
-#endif // ENABLE_ARDUINO_OTA
-
-#ifdef ENABLE_IR_INTERFACE
-	if (IRReceiver_g.decode(&IRResults_g))
+	AppWEBServer_g.displayIRCommand(IRResults_g.command);
+	IRReceiver_g.resume();  // Receive the next value
+	if (IRResults_g.command != 0)
 	{
-		AppWEBServer_g.displayIRCommand(IRResults_g.command);
-		IRReceiver_g.resume();  // Receive the next value
-		if (IRResults_g.command != 0)
-		{
 #ifdef ENABLE_DEVICE_CONTROL
-			if (IRResults_g.command == DeviceConfiguration.ActivationCode)
+		if (IRResults_g.command == DeviceConfiguration.ActivationCode)
+		{
+			if (CommandModule.getState() == StateType::Start)
 			{
-				if (CommandModule.getState() == StateType::Start)
-				{
-					CommandModule.setState(StateType::Stop);
-				}
-				else if (CommandModule.getState() == StateType::Stop)
-				{
-					CommandModule.setState(StateType::Restart);
-				}
-				else if (CommandModule.getState() == StateType::Restart)
-				{
-					CommandModule.setState(StateType::Start);
-				}
+				CommandModule.setState(StateType::Stop);
 			}
-			if (MQTTClient_g.connected())
+			else if (CommandModule.getState() == StateType::Stop)
 			{
-				MQTTClient_g.publish(TOPIC_IR, 2, true, String(IRResults_g.command).c_str());
+				CommandModule.setState(StateType::Restart);
 			}
-#endif // ENABLE_DEVICE_CONTROL
+			else if (CommandModule.getState() == StateType::Restart)
+			{
+				CommandModule.setState(StateType::Start);
+			}
+		}
+		if (MQTTClient_g.connected())
+		{
+			MQTTClient_g.publish(MqttTopics.get(TopicIR), 2, true, String(IRResults_g.command).c_str());
 		}
+#endif // ENABLE_DEVICE_CONTROL
 	}
+
+	PROFILE_END(ProfileIr);
+}
 #endif // ENABLE_IR_INTERFACE
 
 #ifdef ENABLE_STATUS_LED
+/**
+ * @brief Task, next status LED frame.
+ * 
+ * @param now Time of the scheduler pass [ms].
+ */
+void task_status_led(unsigned long now)
+{
+	PROFILE_BEGIN(ProfileLed);
 	StatusLed.update();
+	PROFILE_END(ProfileLed);
+}
+#endif // ENABLE_STATUS_LED
+
+#ifdef ENABLE_LOOP_PROFILER
+/**
+ * @brief Task, publish the loop profile.
+ * 
+ * @param now Time of the scheduler pass [ms].
+ */
+void task_publish_profile(unsigned long now)
+{
+	if (!MQTTClient_g.connected())
+	{
+		return;
+	}
+
+	size_t LengthL = LoopProfiler.toJson(ProfileBuff_g, sizeof(ProfileBuff_g));
+	if (LengthL == 0)
+	{
+		DEBUGLOG("Loop profile does not fit in the buffer.\r\n");
+		return;
+	}
+
+	MQTTClient_g.publish(MqttTopics.get(TopicProfile), 0, false, ProfileBuff_g, LengthL);
+}
+#endif // ENABLE_LOOP_PROFILER
+
+#pragma endregion
+
+#pragma region Boot
+
+/**
+ * @brief Deferred boot stage, local WEB server and mDNS.
+ * 
+ * @return true Done.
+ */
+bool boot_web_server()
+{
+	configure_web_server();
+
+	return true;
+}
+
+#ifdef ENABLE_IR_INTERFACE
+/**
+ * @brief Deferred boot stage, IR receiver.
+ * 
+ * @return true Done.
+ */
+bool boot_ir_receiver()
+{
+	IRReceiver_g.enableIRIn();
+	Scheduler.every("ir", IR_POLL_TIME, task_ir_receiver, PriorityNormal, IR_TASK_BUDGET);
+
+	return true;
+}
+#endif // ENABLE_IR_INTERFACE
+
+#ifdef ENABLE_ARDUINO_OTA
+/**
+ * @brief Deferred boot stage, Arduino OTA.
+ * 
+ * @return true Done.
+ * @return false Station is still connecting, try again.
+ */
+bool boot_arduino_ota()
+{
+	if (WiFiConnecting_g)
+	{
+		return false;
+	}
+
+	configure_arduino_ota();
+
+	return true;
+}
+#endif // ENABLE_ARDUINO_OTA
+
+/**
+ * @brief Publish the boot profile once, when all boot stages are done.
+ * 
+ */
+void publish_boot_profile()
+{
+	if (BootProfileSent_g || !BootSequencer.complete())
+	{
+		return;
+	}
+
+	char ProfileL[BOOT_PROFILE_BUFFER_SIZE];
+	size_t LengthL = BootSequencer.toJson(ProfileL, sizeof(ProfileL));
+
+	if (LengthL == 0)
+	{
+		DEBUGLOG("Boot profile does not fit in the buffer.\r\n");
+		BootProfileSent_g = true;
+		return;
+	}
+
+	DEBUGLOG("Boot profile: %s\r\n", ProfileL);
+
+	BootProfileSent_g = MQTTClient_g.publish(MqttTopics.get(TopicBoot), 1, true, ProfileL, LengthL) != 0;
+}
+
+#pragma endregion
+
+#pragma endregion
+
+void setup()
+{
+	// Setup debug port module.
+	setup_debug_port();
+
+	// Setup the relay.
+	pinMode(PIN_RELAY, OUTPUT);
+
+#ifdef ENABLE_RESCUE_BTN
+	config_rescue_procedure();
+#endif // ENABLE_RESCUE_BTN
+
+	// Turn ON the self power latch.
+	power_off();
+
+#ifdef ENABLE_STATUS_LED
+	// Setup the RGB led.
+	StatusLed.init(PIN_RGB_LED);
+	Scheduler.every("led", STATUS_LED_FRAME_TIME, task_status_led, PriorityLow);
+#endif // ENABLE_STATUS_LED
+
+	// Show flash state.
+	show_device_properties();
+
+	// Start the file system.
+	configure_file_system();
+
+	// Load network, device and MQTT configuration. Defaults if any error, old JSON files get imported.
+	load_configuration(&SPIFFS);
+	BootSequencer.mark(BootSequencer.milestone("config"));
+
+	// Bridge at the configured baudrate from the start.
+	COM_PORT.begin(DeviceConfiguration.PortBaudrate);
+
+	// Setup the serial ingest engine.
+	SerialIngest.init(&COM_PORT);
+	SerialIngest.setBaudrate(DeviceConfiguration.PortBaudrate);
+	SerialIngest.setFrameCb(on_device_frame);
+
+	// Setup the serial out queue.
+	SerialTxQueue.init(&COM_PORT);
+#ifdef ENABLE_SERIAL_FLOW_CONTROL
+	SerialTxQueue.setFlowCb(publish_serial_flow);
+#endif // ENABLE_SERIAL_FLOW_CONTROL
+
+	BootSequencer.mark(BootSequencer.milestone("uart"));
+
+	// Pick up the messages kept offline in the last run.
+	OfflineQueue.init(&SPIFFS);
+	OfflineQueue.setReplayCb(replay_offline_message);
+
+	// Periodic work runs from the scheduler, the serial bridge stays polled.
+	Scheduler.every("network", NETWORK_UPDATE_TIME, task_network, PriorityHigh, NETWORK_TASK_BUDGET);
+	Scheduler.every("state", DEVICE_STATE_MIN_INTERVAL, task_device_state, PriorityNormal, STATE_TASK_BUDGET);
+	Scheduler.every("status", DEVICE_STATUS_SAMPLE_TIME, task_device_status, PriorityNormal, STATUS_TASK_BUDGET);
+#ifdef ENABLE_LOOP_PROFILER
+	if (PROFILE_PUBLISH_TIME > 0)
+	{
+		Scheduler.every("profile", PROFILE_PUBLISH_TIME, task_publish_profile, PriorityLow);
+	}
+#endif // ENABLE_LOOP_PROFILER
+
+	// Local services come up one per loop tick.
+	BootWeb_g = BootSequencer.defer("web", boot_web_server);
+#ifdef ENABLE_IR_INTERFACE
+	BootSequencer.defer("ir", boot_ir_receiver);
+#endif // ENABLE_IR_INTERFACE
+#ifdef ENABLE_ARDUINO_OTA
+	BootSequencer.defer("ota", boot_arduino_ota);
+#endif // ENABLE_ARDUINO_OTA
+
+	// If no SSID and Password wer set the go to AP mode.
+	if (NetworkConfiguration.SSID != "" && NetworkConfiguration.Password != "")
+	{
+		// Marked from the loop and the MQTT callbacks.
+		BootWiFi_g = BootSequencer.milestone("wifi");
+		BootMqtt_g = BootSequencer.milestone("mqtt");
+		BootTelemetry_g = BootSequencer.milestone("telemetry");
+
+		// Both connect in the background.
+		configure_to_sta();
+		mqtt_begin();
+#ifdef ENABLE_STATUS_LED
+		StatusLed.setAnumation(AnimationType::Green);
 #endif // ENABLE_STATUS_LED
+	}
+	else
+	{
+		configure_to_ap();
+#ifdef ENABLE_STATUS_LED
+		StatusLed.setAnumation(AnimationType::Blue);
+#endif // ENABLE_STATUS_LED
+	}
+}
+
+void loop()
+{
+	PROFILE_BEGIN(ProfileLoop);
+
+#ifdef ENABLE_RESQUE_BTN
+	update_rescue_procedure();
+#endif // ENABLE_RESQUE_BTN
+
+	// Deferred boot stages.
+	PROFILE_BEGIN(ProfileBoot);
+	BootSequencer.update();
+	PROFILE_END(ProfileBoot);
+
+	if (BootSequencer.isDone(BootWeb_g))
+	{
+		PROFILE_BEGIN(ProfileWeb);
+		AppWEBServer_g.update();
+		PROFILE_END(ProfileWeb);
+	}
+
+	// Drain serial out queue to the device.
+	PROFILE_BEGIN(ProfileSerialOut);
+	SerialTxQueue.update();
+	PROFILE_END(ProfileSerialOut);
+
+	// Frames go to the console in every mode, on_device_frame() decides about the broker.
+	PROFILE_BEGIN(ProfileSerialIn);
+	SerialIngest.update();
+	PROFILE_END(ProfileSerialIn);
+
+#ifdef ENABLE_ARDUINO_OTA
+	PROFILE_BEGIN(ProfileOta);
+	ArduinoOTA.handle();
+	PROFILE_END(ProfileOta);
+#endif // ENABLE_ARDUINO_OTA
+
+	// Due periodic tasks, they profile themselves.
+	Scheduler.update();
+
+	PROFILE_END(ProfileLoop);
+
+	// Sleep to the next deadline only when the bridge has nothing to move.
+	if ((COM_PORT.available() == 0) && (SerialTxQueue.depth() == 0))
+	{
+		Scheduler.idle();
+	}
 }
@@ -0,0 +1,254 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "LoopProfiler.h"
+
+#ifdef ENABLE_LOOP_PROFILER
+
+#include "GeneralHelper.h"
+
+/** @brief Sections names, in order of ProfileSection. */
+static const char* const ProfileNames_g[ProfileCount] =
+{
+	"loop",
+	"boot",
+	"web",
+	"serout",
+	"serin",
+	"ota",
+	"network",
+	"ntp",
+	"mqtt",
+	"status",
+	"state",
+	"ir",
+	"led",
+};
+
+/** @brief Constructor.
+ *  @return LoopProfilerClass
+ */
+LoopProfilerClass::LoopProfilerClass()
+{
+	reset();
+}
+
+/** @brief Histogram bucket of a time.
+ *  @param time uint32_t, Time [us].
+ *  @return uint8_t, Bucket index.
+ */
+uint8_t LoopProfilerClass::bucket(uint32_t time)
+{
+	if (time < 2)
+	{
+		return (uint8_t)time;
+	}
+
+	// Two buckets per power of two, split by the bit below the top one.
+	uint8_t TopL = 31 - __builtin_clz(time);
+	uint8_t IndexL = (TopL * 2) + ((time >> (TopL - 1)) & 1);
+
+	return (IndexL < PROFILER_BUCKETS) ? IndexL : (PROFILER_BUCKETS - 1);
+}
+
+/** @brief Lowest time of a bucket.
+ *  @param index uint8_t, Bucket index.
+ *  @return uint32_t, Time [us].
+ */
+uint32_t LoopProfilerClass::bucketStart(uint8_t index)
+{
+	if (index < 2)
+	{
+		return index;
+	}
+
+	uint8_t TopL = index / 2;
+
+	return (1UL << TopL) + ((index & 1) ? (1UL << (TopL - 1)) : 0);
+}
+
+/** @brief Record a run of a section.
+ *  @param id uint8_t, Section.
+ *  @param time uint32_t, Run time [us].
+ *  @return Void.
+ */
+void LoopProfilerClass::record(uint8_t id, uint32_t time)
+{
+	if (id >= ProfileCount)
+	{
+		return;
+	}
+
+	ProfileStats_t* StatsL = &m_stats[id];
+
+	StatsL->Count++;
+	StatsL->Total += time;
+	if (time < StatsL->Min)
+	{
+		StatsL->Min = time;
+	}
+	if (time > StatsL->Max)
+	{
+		StatsL->Max = time;
+	}
+
+	uint8_t IndexL = bucket(time);
+	if (StatsL->Buckets[IndexL] == UINT16_MAX)
+	{
+		// Keep the shape, older runs weigh less.
+		for (uint8_t index = 0; index < PROFILER_BUCKETS; index++)
+		{
+			StatsL->Buckets[index] >>= 1;
+		}
+	}
+	StatsL->Buckets[IndexL]++;
+}
+
+/** @brief Clear all statistics.
+ *  @return Void.
+ */
+void LoopProfilerClass::reset()
+{
+	memset(m_stats, 0, sizeof(m_stats));
+
+	for (uint8_t index = 0; index < ProfileCount; index++)
+	{
+		m_stats[index].Min = UINT32_MAX;
+	}
+}
+
+/** @brief Get section statistics.
+ *  @param id uint8_t, Section.
+ *  @return const ProfileStats_t*, Statistics or NULL if out of range.
+ */
+const ProfileStats_t* LoopProfilerClass::get(uint8_t id)
+{
+	if (id >= ProfileCount)
+	{
+		return NULL;
+	}
+
+	return &m_stats[id];
+}
+
+/** @brief Section name.
+ *  @param id uint8_t, Section.
+ *  @return const char*, Name.
+ */
+const char* LoopProfilerClass::name(uint8_t id)
+{
+	if (id >= ProfileCount)
+	{
+		return "";
+	}
+
+	return ProfileNames_g[id];
+}
+
+/** @brief Average run time.
+ *  @param id uint8_t, Section.
+ *  @return uint32_t, Time [us].
+ */
+uint32_t LoopProfilerClass::average(uint8_t id)
+{
+	if ((id >= ProfileCount) || (m_stats[id].Count == 0))
+	{
+		return 0;
+	}
+
+	return (uint32_t)(m_stats[id].Total / m_stats[id].Count);
+}
+
+/** @brief Run time percentile, from the histogram.
+ *  @param id uint8_t, Section.
+ *  @param permille uint16_t, Percentile in 1/1000, 990 for p99.
+ *  @return uint32_t, Upper time of the bucket, at most the maximum [us].
+ */
+uint32_t LoopProfilerClass::percentile(uint8_t id, uint16_t permille)
+{
+	if ((id >= ProfileCount) || (m_stats[id].Count == 0))
+	{
+		return 0;
+	}
+
+	const ProfileStats_t* StatsL = &m_stats[id];
+
+	uint32_t TotalL = 0;
+	for (uint8_t index = 0; index < PROFILER_BUCKETS; index++)
+	{
+		TotalL += StatsL->Buckets[index];
+	}
+
+	// Runs at or below the percentile, rounded up.
+	uint32_t RankL = ((TotalL * permille) + 999) / 1000;
+	uint32_t SumL = 0;
+
+	for (uint8_t index = 0; index < (PROFILER_BUCKETS - 1); index++)
+	{
+		SumL += StatsL->Buckets[index];
+		if (SumL >= RankL)
+		{
+			uint32_t UpperL = bucketStart(index + 1) - 1;
+			return (UpperL < StatsL->Max) ? UpperL : StatsL->Max;
+		}
+	}
+
+	return StatsL->Max;
+}
+
+/** @brief Write the profile as JSON object of the sections that ran.
+ *  @param buffer char*, Target buffer.
+ *  @param size size_t, Buffer size.
+ *  @return size_t, Length or zero if it does not fit.
+ */
+size_t LoopProfilerClass::toJson(char* buffer, size_t size)
+{
+	size_t LengthL = 0;
+	bool StateL = buffer_append(buffer, size, &LengthL, "{");
+
+	for (uint8_t index = 0; index < ProfileCount; index++)
+	{
+		if (m_stats[index].Count == 0)
+		{
+			continue;
+		}
+
+		StateL &= buffer_append(buffer, size, &LengthL,
+			"%s\"%s\":{\"n\":%lu,\"min\":%lu,\"avg\":%lu,\"max\":%lu,\"p99\":%lu}",
+			(LengthL > 1) ? "," : "", ProfileNames_g[index],
+			(unsigned long)m_stats[index].Count, (unsigned long)m_stats[index].Min,
+			(unsigned long)average(index), (unsigned long)m_stats[index].Max,
+			(unsigned long)percentile(index, 990));
+	}
+
+	StateL &= buffer_append(buffer, size, &LengthL, "}");
+
+	return StateL ? LengthL : 0;
+}
+
+/* @brief Singleton loop profiler instance. */
+LoopProfilerClass LoopProfiler;
+
+#endif // ENABLE_LOOP_PROFILER
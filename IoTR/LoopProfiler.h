@@ -0,0 +1,190 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// LoopProfiler.h
+
+#ifndef _LOOPPROFILER_h
+#define _LOOPPROFILER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifdef ENABLE_LOOP_PROFILER
+
+/** @brief Start timing of a section. Pair it with PROFILE_END() in the same scope.
+ *  @param id ProfileSection, Section.
+ */
+#define PROFILE_BEGIN(id) unsigned long id##StartL = micros()
+
+/** @brief Stop timing of a section and record it.
+ *  @param id ProfileSection, Section.
+ */
+#define PROFILE_END(id) LoopProfiler.record(id, micros() - id##StartL)
+
+#else
+
+#define PROFILE_BEGIN(id)
+
+#define PROFILE_END(id)
+
+#endif // ENABLE_LOOP_PROFILER
+
+#ifndef PROFILER_BUCKETS
+/** @brief Count of the histogram buckets, two per power of two [us]. */
+#define PROFILER_BUCKETS 32
+#endif // !PROFILER_BUCKETS
+
+#ifndef PROFILER_BUFFER_SIZE
+/** @brief Size of the profile message. */
+#define PROFILER_BUFFER_SIZE 1152
+#endif // !PROFILER_BUFFER_SIZE
+
+#pragma endregion
+
+#ifdef ENABLE_LOOP_PROFILER
+
+#pragma region Structures
+
+/** @brief Profiled sections of the main loop. */
+enum ProfileSection : uint8_t
+{
+	ProfileLoop = 0, ///< Whole loop pass, without the idle time.
+	ProfileBoot, ///< Deferred boot stages.
+	ProfileWeb, ///< WEB server update.
+	ProfileSerialOut, ///< Serial out queue.
+	ProfileSerialIn, ///< Serial ingest.
+	ProfileOta, ///< Arduino OTA.
+	ProfileNetwork, ///< Network task.
+	ProfileNtp, ///< NTP update.
+	ProfileMqtt, ///< MQTT reconnect.
+	ProfileStatus, ///< Device status task.
+	ProfileState, ///< Device state task.
+	ProfileIr, ///< IR receiver task.
+	ProfileLed, ///< Status LED task.
+	ProfileCount, ///< Count of the sections.
+};
+
+/** @brief Execution time of a section. */
+typedef struct {
+	uint32_t Count; ///< Count of the runs.
+	uint64_t Total; ///< Time of all runs [us].
+	uint32_t Min; ///< Shortest run [us].
+	uint32_t Max; ///< Longest run [us].
+	uint16_t Buckets[PROFILER_BUCKETS]; ///< Histogram, halved when a bucket is full.
+} ProfileStats_t;
+
+#pragma endregion
+
+/** @brief Execution time profiler of the main loop sections.
+ *
+ *  Every section keeps min, max, average and a log scale histogram, so
+ *  the percentiles come at a fixed memory cost. Use the PROFILE_BEGIN()
+ *  and PROFILE_END() macros, they compile out with the profiler.
+ */
+class LoopProfilerClass
+{
+protected:
+
+	/** @brief Sections statistics. */
+	ProfileStats_t m_stats[ProfileCount];
+
+	/** @brief Histogram bucket of a time.
+	 *  @param time uint32_t, Time [us].
+	 *  @return uint8_t, Bucket index.
+	 */
+	static uint8_t bucket(uint32_t time);
+
+	/** @brief Lowest time of a bucket.
+	 *  @param index uint8_t, Bucket index.
+	 *  @return uint32_t, Time [us].
+	 */
+	static uint32_t bucketStart(uint8_t index);
+
+public:
+
+	/** @brief Constructor.
+	 *  @return LoopProfilerClass
+	 */
+	LoopProfilerClass();
+
+	/** @brief Record a run of a section.
+	 *  @param id uint8_t, Section.
+	 *  @param time uint32_t, Run time [us].
+	 *  @return Void.
+	 */
+	void record(uint8_t id, uint32_t time);
+
+	/** @brief Clear all statistics.
+	 *  @return Void.
+	 */
+	void reset();
+
+	/** @brief Get section statistics.
+	 *  @param id uint8_t, Section.
+	 *  @return const ProfileStats_t*, Statistics or NULL if out of range.
+	 */
+	const ProfileStats_t* get(uint8_t id);
+
+	/** @brief Section name.
+	 *  @param id uint8_t, Section.
+	 *  @return const char*, Name.
+	 */
+	const char* name(uint8_t id);
+
+	/** @brief Average run time.
+	 *  @param id uint8_t, Section.
+	 *  @return uint32_t, Time [us].
+	 */
+	uint32_t average(uint8_t id);
+
+	/** @brief Run time percentile, from the histogram.
+	 *  @param id uint8_t, Section.
+	 *  @param permille uint16_t, Percentile in 1/1000, 990 for p99.
+	 *  @return uint32_t, Upper time of the bucket, at most the maximum [us].
+	 */
+	uint32_t percentile(uint8_t id, uint16_t permille);
+
+	/** @brief Write the profile as JSON object of the sections that ran.
+	 *  @param buffer char*, Target buffer.
+	 *  @param size size_t, Buffer size.
+	 *  @return size_t, Length or zero if it does not fit.
+	 */
+	size_t toJson(char* buffer, size_t size);
+};
+
+/* @brief Singleton loop profiler instance. */
+extern LoopProfilerClass LoopProfiler;
+
+#endif // ENABLE_LOOP_PROFILER
+
+#endif
+
@@ -57,7 +57,7 @@ bool load_mqtt_configuration(FS* fileSystem, const char * path) {
 	file.readBytes(buf.get(), size);
 	file.close();
 
-	DynamicJsonDocument doc(256);
+	DynamicJsonDocument doc(512);
 	DeserializationError error = deserializeJson(doc, buf.get());
 
 	if (error) {
@@ -77,27 +77,62 @@ bool load_mqtt_configuration(FS* fileSystem, const char * path) {
 	MqttConfiguration.Password = doc["pass"].as<String>();
 	MqttConfiguration.Domain = doc["domain"].as<String>();
 	MqttConfiguration.Port = doc["port"].as<int>();
+	// Files saved before batching was added do not have these keys.
+	MqttConfiguration.Batch = doc["batch"] | DEFAULT_MQTT_BATCH;
+	MqttConfiguration.BatchSize = doc["batch_size"] | DEFAULT_MQTT_BATCH_SIZE;
+	MqttConfiguration.BatchInterval = doc["batch_interval"] | DEFAULT_MQTT_BATCH_INTERVAL;
+	MqttConfiguration.SerialQoS = mqtt_valid_qos(doc["serial_qos"] | DEFAULT_MQTT_SERIAL_QOS);
+	MqttConfiguration.SerialRetain = doc["serial_retain"] | DEFAULT_MQTT_SERIAL_RETAIN;
+	MqttConfiguration.StatusQoS = mqtt_valid_qos(doc["status_qos"] | DEFAULT_MQTT_STATUS_QOS);
+	MqttConfiguration.StatusRetain = doc["status_retain"] | DEFAULT_MQTT_STATUS_RETAIN;
+	MqttConfiguration.CommandQoS = mqtt_valid_qos(doc["command_qos"] | DEFAULT_MQTT_COMMAND_QOS);
+	MqttConfiguration.Encoding = mqtt_valid_encoding(doc["encoding"] | DEFAULT_MQTT_ENCODING);
 	return true;
 }
 
-/** @brief Save MQTT configuration.
+/** @brief Export MQTT configuration as JSON.
+ *  @param output Print, Destination of the JSON.
  *  @return boolean, Return true if successful.
  */
-bool save_mqtt_configuration(FS* fileSystem, const char* path) {
-#ifdef SHOW_FUNC_NAMES
-	DEBUGLOG("\r\n");
-	DEBUGLOG(__PRETTY_FUNCTION__);
-	DEBUGLOG("\r\n");
-#endif // SHOW_FUNC_NAMES
-
+bool save_mqtt_configuration(Print* output) {
 	//flag_config = false;
-	DynamicJsonDocument doc(256);
+	DynamicJsonDocument doc(512);
 
 	doc["auth"] = MqttConfiguration.Auth;
 	doc["user"] = MqttConfiguration.Username;
 	doc["pass"] = MqttConfiguration.Password;
 	doc["domain"] = MqttConfiguration.Domain;
 	doc["port"] = MqttConfiguration.Port;
+	doc["batch"] = MqttConfiguration.Batch;
+	doc["batch_size"] = MqttConfiguration.BatchSize;
+	doc["batch_interval"] = MqttConfiguration.BatchInterval;
+	doc["serial_qos"] = MqttConfiguration.SerialQoS;
+	doc["serial_retain"] = MqttConfiguration.SerialRetain;
+	doc["status_qos"] = MqttConfiguration.StatusQoS;
+	doc["status_retain"] = MqttConfiguration.StatusRetain;
+	doc["command_qos"] = MqttConfiguration.CommandQoS;
+	doc["encoding"] = MqttConfiguration.Encoding;
+
+#ifdef SHOW_CONFIG
+	String temp;
+	serializeJson(doc, temp);
+	DEBUGLOG("%s\r\n", temp.c_str());
+#endif // SHOW_CONFIG
+
+	serializeJson(doc, *output);
+
+	return true;
+}
+
+/** @brief Save MQTT configuration.
+ *  @return boolean, Return true if successful.
+ */
+bool save_mqtt_configuration(FS* fileSystem, const char* path) {
+#ifdef SHOW_FUNC_NAMES
+	DEBUGLOG("\r\n");
+	DEBUGLOG(__PRETTY_FUNCTION__);
+	DEBUGLOG("\r\n");
+#endif // SHOW_FUNC_NAMES
 
 	File file = fileSystem->open(path, "w");
 
@@ -107,13 +142,7 @@ bool save_mqtt_configuration(FS* fileSystem, const char* path) {
 		return false;
 	}
 
-#ifdef SHOW_CONFIG
-	String temp;
-	serializeJson(doc, temp);
-	DEBUGLOG("%s\r\n", temp.c_str());
-#endif // SHOW_CONFIG
-
-	serializeJson(doc, file);
+	save_mqtt_configuration(&file);
 	file.flush();
 	file.close();
 
@@ -135,7 +164,49 @@ bool set_default_mqtt_configuration() {
 	MqttConfiguration.Password = DEFAULT_MQTT_PASS;
 	MqttConfiguration.Domain = DEFAULT_MQTT_DOMAIN;
 	MqttConfiguration.Port = DEFUALT_MQTT_PORT;
-	
+	MqttConfiguration.Batch = DEFAULT_MQTT_BATCH;
+	MqttConfiguration.BatchSize = DEFAULT_MQTT_BATCH_SIZE;
+	MqttConfiguration.BatchInterval = DEFAULT_MQTT_BATCH_INTERVAL;
+	MqttConfiguration.SerialQoS = DEFAULT_MQTT_SERIAL_QOS;
+	MqttConfiguration.SerialRetain = DEFAULT_MQTT_SERIAL_RETAIN;
+	MqttConfiguration.StatusQoS = DEFAULT_MQTT_STATUS_QOS;
+	MqttConfiguration.StatusRetain = DEFAULT_MQTT_STATUS_RETAIN;
+	MqttConfiguration.CommandQoS = DEFAULT_MQTT_COMMAND_QOS;
+	MqttConfiguration.Encoding = DEFAULT_MQTT_ENCODING;
+
+}
+
+/** @brief Limit QoS to the valid levels.
+ *  @param qos int, Requested QoS.
+ *  @return uint8_t, QoS from 0 to 2.
+ */
+uint8_t mqtt_valid_qos(int qos) {
+
+	if (qos < 0)
+	{
+		return 0;
+	}
+
+	if (qos > 2)
+	{
+		return 2;
+	}
+
+	return (uint8_t)qos;
+}
+
+/** @brief Limit encoding to the known ones.
+ *  @param encoding int, Requested encoding.
+ *  @return uint8_t, Known encoding, JSON otherwise.
+ */
+uint8_t mqtt_valid_encoding(int encoding) {
+
+	if (encoding == MQTT_ENCODING_MSGPACK)
+	{
+		return MQTT_ENCODING_MSGPACK;
+	}
+
+	return MQTT_ENCODING_JSON;
 }
 
 
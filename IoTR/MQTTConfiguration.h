@@ -64,6 +64,15 @@ typedef struct {
 	String Domain = DEFAULT_MQTT_DOMAIN; ///< User name - WWW user name. Set default value.
 	String Username = DEFAULT_MQTT_USER; ///< User name - WWW user name. Set default value.
 	String Password = DEFAULT_MQTT_PASS; ///< Password - WWW password. Set default value.
+	bool Batch = DEFAULT_MQTT_BATCH; ///< Batch serial frames in one publish.
+	int BatchSize = DEFAULT_MQTT_BATCH_SIZE; ///< Byte budget of one batch payload.
+	int BatchInterval = DEFAULT_MQTT_BATCH_INTERVAL; ///< Batch flush interval [ms].
+	uint8_t SerialQoS = DEFAULT_MQTT_SERIAL_QOS; ///< QoS of the serial data publish.
+	bool SerialRetain = DEFAULT_MQTT_SERIAL_RETAIN; ///< Retain of the serial data publish.
+	uint8_t StatusQoS = DEFAULT_MQTT_STATUS_QOS; ///< QoS of the status publish.
+	bool StatusRetain = DEFAULT_MQTT_STATUS_RETAIN; ///< Retain of the status publish.
+	uint8_t CommandQoS = DEFAULT_MQTT_COMMAND_QOS; ///< QoS of the command subscriptions.
+	uint8_t Encoding = DEFAULT_MQTT_ENCODING; ///< Payload encoding of the status and serial data.
 
 } MqttConfiguration_t;
 
@@ -81,11 +90,29 @@ bool load_mqtt_configuration(FS* fileSystem, const char* path);
  */
 bool save_mqtt_configuration(FS* fileSystem, const char* path);
 
+/** @brief Export MQTT configuration as JSON.
+ *  @param output Print, Destination of the JSON.
+ *  @return boolean, Return true if successful.
+ */
+bool save_mqtt_configuration(Print* output);
+
 /** @brief Default configuration.
  *  @return Void
  */
 bool set_default_mqtt_configuration();
 
+/** @brief Limit QoS to the valid levels.
+ *  @param qos int, Requested QoS.
+ *  @return uint8_t, QoS from 0 to 2.
+ */
+uint8_t mqtt_valid_qos(int qos);
+
+/** @brief Limit encoding to the known ones.
+ *  @param encoding int, Requested encoding.
+ *  @return uint8_t, Known encoding, JSON otherwise.
+ */
+uint8_t mqtt_valid_encoding(int encoding);
+
 #pragma endregion
 
 /* @brief Singelton HTTP Authentication instance. */
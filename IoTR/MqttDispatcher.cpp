@@ -0,0 +1,134 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "MqttDispatcher.h"
+
+/** @brief Collect slice and call the handler when the message is whole.
+ *  @param id MqttTopicId, Topic identifier.
+ *  @param payload const char*, Payload slice.
+ *  @param length size_t, Slice length.
+ *  @param index size_t, Offset of the slice in the message.
+ *  @param total size_t, Message length.
+ *  @return Void.
+ */
+void MqttDispatcherClass::reassemble(MqttTopicId id, const char* payload, size_t length, size_t index, size_t total)
+{
+	// Single slice message, no copy needed.
+	if (index == 0 && length == total)
+	{
+		m_handlers[id].Handler(payload, length, 0, total);
+		return;
+	}
+
+	if (total > MQTT_REASSEMBLY_SIZE)
+	{
+		if (index == 0)
+		{
+			m_dropped++;
+			DEBUGLOG("Message too big for reassembly: %d\r\n", total);
+		}
+
+		return;
+	}
+
+	// First slice starts new message.
+	if (index == 0)
+	{
+		m_bufferTopic = id;
+		m_bufferLength = 0;
+	}
+
+	// Lost the start of the message.
+	if (m_bufferTopic != id || m_bufferLength != index)
+	{
+		m_bufferTopic = TopicCount;
+		return;
+	}
+
+	memcpy(m_buffer + index, payload, length);
+	m_bufferLength += length;
+
+	if (m_bufferLength == total)
+	{
+		m_bufferTopic = TopicCount;
+		m_handlers[id].Handler(m_buffer, total, 0, total);
+	}
+}
+
+/** @brief Register topic handler.
+ *  @param id MqttTopicId, Topic identifier.
+ *  @param handler MqttHandler_t, Handler callback, nullptr to remove.
+ *  @param reassemble bool, Deliver whole messages only.
+ *  @return Void.
+ */
+void MqttDispatcherClass::on(MqttTopicId id, MqttHandler_t handler, bool reassemble)
+{
+	if (id >= TopicCount)
+	{
+		return;
+	}
+
+	m_handlers[id].Handler = handler;
+	m_handlers[id].Reassemble = reassemble;
+}
+
+/** @brief Dispatch incoming message slice.
+ *  @param topic const char*, Full topic.
+ *  @param payload const char*, Payload slice.
+ *  @param length size_t, Slice length.
+ *  @param index size_t, Offset of the slice in the message.
+ *  @param total size_t, Message length.
+ *  @return Void.
+ */
+void MqttDispatcherClass::dispatch(const char* topic, const char* payload, size_t length, size_t index, size_t total)
+{
+	MqttTopicId IdL = MqttTopics.find(topic);
+
+	if (IdL == TopicCount || m_handlers[IdL].Handler == nullptr)
+	{
+		DEBUGLOG("Unhandled topic: %s\r\n", topic);
+		return;
+	}
+
+	if (m_handlers[IdL].Reassemble)
+	{
+		reassemble(IdL, payload, length, index, total);
+	}
+	else
+	{
+		m_handlers[IdL].Handler(payload, length, index, total);
+	}
+}
+
+/** @brief Count of messages dropped as too big for reassembly.
+ *  @return unsigned long, Dropped messages.
+ */
+unsigned long MqttDispatcherClass::getDropped()
+{
+	return m_dropped;
+}
+
+/* @brief Singleton MQTT dispatcher instance. */
+MqttDispatcherClass MqttDispatcher;
@@ -0,0 +1,134 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// MqttDispatcher.h
+
+#ifndef _MQTTDISPATCHER_h
+#define _MQTTDISPATCHER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#include "MqttTopics.h"
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef MQTT_REASSEMBLY_SIZE
+/** @brief Size of the shared buffer for handlers that want whole messages. */
+#define MQTT_REASSEMBLY_SIZE 512
+#endif // !MQTT_REASSEMBLY_SIZE
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Topic handler.
+ *  @param payload const char*, Payload slice, not zero terminated.
+ *  @param length size_t, Slice length.
+ *  @param index size_t, Offset of the slice in the message.
+ *  @param total size_t, Message length.
+ */
+typedef void(*MqttHandler_t)(const char* payload, size_t length, size_t index, size_t total);
+
+/** @brief Topic handler registration. */
+typedef struct {
+	MqttHandler_t Handler = nullptr; ///< Handler callback.
+	bool Reassemble = false; ///< Deliver whole messages only.
+} MqttHandlerEntry_t;
+
+#pragma endregion
+
+/** @brief Inbound MQTT dispatcher.
+ *
+ *  Handlers are indexed by topic identifier. By default they get the payload
+ *  slices as the client delivers them. Handlers that opt in get each message
+ *  once, reassembled in a shared buffer.
+ */
+class MqttDispatcherClass
+{
+protected:
+
+	/** @brief Handlers by topic identifier. */
+	MqttHandlerEntry_t m_handlers[TopicCount];
+
+	/** @brief Reassembly buffer. */
+	char m_buffer[MQTT_REASSEMBLY_SIZE];
+
+	/** @brief Topic of the message in the reassembly buffer. */
+	MqttTopicId m_bufferTopic = TopicCount;
+
+	/** @brief Bytes received in the reassembly buffer. */
+	size_t m_bufferLength = 0;
+
+	/** @brief Count of messages dropped as too big for reassembly. */
+	unsigned long m_dropped = 0;
+
+	/** @brief Collect slice and call the handler when the message is whole.
+	 *  @param id MqttTopicId, Topic identifier.
+	 *  @param payload const char*, Payload slice.
+	 *  @param length size_t, Slice length.
+	 *  @param index size_t, Offset of the slice in the message.
+	 *  @param total size_t, Message length.
+	 *  @return Void.
+	 */
+	void reassemble(MqttTopicId id, const char* payload, size_t length, size_t index, size_t total);
+
+public:
+
+	/** @brief Register topic handler.
+	 *  @param id MqttTopicId, Topic identifier.
+	 *  @param handler MqttHandler_t, Handler callback, nullptr to remove.
+	 *  @param reassemble bool, Deliver whole messages only.
+	 *  @return Void.
+	 */
+	void on(MqttTopicId id, MqttHandler_t handler, bool reassemble = false);
+
+	/** @brief Dispatch incoming message slice.
+	 *  @param topic const char*, Full topic.
+	 *  @param payload const char*, Payload slice.
+	 *  @param length size_t, Slice length.
+	 *  @param index size_t, Offset of the slice in the message.
+	 *  @param total size_t, Message length.
+	 *  @return Void.
+	 */
+	void dispatch(const char* topic, const char* payload, size_t length, size_t index, size_t total);
+
+	/** @brief Count of messages dropped as too big for reassembly.
+	 *  @return unsigned long, Dropped messages.
+	 */
+	unsigned long getDropped();
+};
+
+/* @brief Singleton MQTT dispatcher instance. */
+extern MqttDispatcherClass MqttDispatcher;
+
+#endif
@@ -0,0 +1,164 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "MqttTopics.h"
+
+/** @brief Topic suffixes in order of the identifiers. */
+static const char* const TOPIC_SUFFIXES[TopicCount] = {
+	TOPIC_SER_OUT,
+	TOPIC_SER_IN,
+	TOPIC_STAT,
+	TOPIC_UPDATE,
+	TOPIC_IR,
+	TOPIC_RELAY_IN,
+	TOPIC_RELAY_OUT,
+	TOPIC_BUTTON,
+	TOPIC_SER_FLOW,
+	TOPIC_BOOT,
+	TOPIC_PROFILE,
+};
+
+/** @brief Constructor.
+ *  @return MqttTopicsClass
+ */
+MqttTopicsClass::MqttTopicsClass()
+{
+	memset(m_hashTable, TopicCount, sizeof(m_hashTable));
+
+	// The suffixes are constant, so the table is filled once.
+	for (uint8_t id = 0; id < TopicCount; id++)
+	{
+		uint8_t SlotL = hash(TOPIC_SUFFIXES[id]) & (MQTT_TOPIC_HASH_SIZE - 1);
+
+		while (m_hashTable[SlotL] != TopicCount)
+		{
+			SlotL = (SlotL + 1) & (MQTT_TOPIC_HASH_SIZE - 1);
+		}
+
+		m_hashTable[SlotL] = id;
+		m_topics[id][0] = '\0';
+	}
+}
+
+/** @brief FNV-1a hash of a string.
+ *  @param text const char*, Zero terminated text.
+ *  @return uint32_t, Hash.
+ */
+uint32_t MqttTopicsClass::hash(const char* text)
+{
+	uint32_t HashL = 2166136261UL;
+
+	while (*text != '\0')
+	{
+		HashL ^= (uint8_t)*text++;
+		HashL *= 16777619UL;
+	}
+
+	return HashL;
+}
+
+/** @brief Build the full topics.
+ *  @param hostname const char*, Host name of the device.
+ *  @return Void.
+ */
+void MqttTopicsClass::build(const char* hostname)
+{
+#ifdef SHOW_FUNC_NAMES
+	DEBUGLOG("\r\n");
+	DEBUGLOG(__PRETTY_FUNCTION__);
+	DEBUGLOG("\r\n");
+#endif // SHOW_FUNC_NAMES
+
+	for (uint8_t id = 0; id < TopicCount; id++)
+	{
+		int LengthL = snprintf(m_topics[id], MQTT_TOPIC_MAX_SIZE, "%s%s%s", MQTT_TOPIC_BASE, hostname, TOPIC_SUFFIXES[id]);
+
+		if (LengthL >= MQTT_TOPIC_MAX_SIZE)
+		{
+			DEBUGLOG("Topic truncated: %s\r\n", m_topics[id]);
+		}
+	}
+
+	m_prefixLength = strlen(MQTT_TOPIC_BASE) + strlen(hostname);
+}
+
+/** @brief Get full topic.
+ *  @param id MqttTopicId, Topic identifier.
+ *  @return const char*, Full topic, empty if the identifier is out of range.
+ */
+const char* MqttTopicsClass::get(MqttTopicId id)
+{
+	if (id >= TopicCount)
+	{
+		return "";
+	}
+
+	return m_topics[id];
+}
+
+/** @brief Get topic suffix.
+ *  @param id MqttTopicId, Topic identifier.
+ *  @return const char*, Topic suffix, empty if the identifier is out of range.
+ */
+const char* MqttTopicsClass::suffix(MqttTopicId id)
+{
+	if (id >= TopicCount)
+	{
+		return "";
+	}
+
+	return TOPIC_SUFFIXES[id];
+}
+
+/** @brief Resolve full topic to identifier.
+ *  @param topic const char*, Full topic.
+ *  @return MqttTopicId, Topic identifier or TopicCount if unknown.
+ */
+MqttTopicId MqttTopicsClass::find(const char* topic)
+{
+	// All device topics share "base/hostname".
+	if (strncmp(topic, m_topics[0], m_prefixLength) != 0)
+	{
+		return TopicCount;
+	}
+
+	const char* SuffixL = topic + m_prefixLength;
+	uint8_t SlotL = hash(SuffixL) & (MQTT_TOPIC_HASH_SIZE - 1);
+
+	while (m_hashTable[SlotL] != TopicCount)
+	{
+		if (strcmp(SuffixL, TOPIC_SUFFIXES[m_hashTable[SlotL]]) == 0)
+		{
+			return (MqttTopicId)m_hashTable[SlotL];
+		}
+
+		SlotL = (SlotL + 1) & (MQTT_TOPIC_HASH_SIZE - 1);
+	}
+
+	return TopicCount;
+}
+
+/* @brief Singleton MQTT topics instance. */
+MqttTopicsClass MqttTopics;
@@ -0,0 +1,133 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// MqttTopics.h
+
+#ifndef _MQTTTOPICS_h
+#define _MQTTTOPICS_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef MQTT_TOPIC_MAX_SIZE
+/** @brief Maximum length of one full topic including the terminator. */
+#define MQTT_TOPIC_MAX_SIZE 80
+#endif // !MQTT_TOPIC_MAX_SIZE
+
+/** @brief Size of the suffix hash table. Must be power of two and bigger than the topics count. */
+#define MQTT_TOPIC_HASH_SIZE 16
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Topic identifiers. */
+enum MqttTopicId : uint8_t
+{
+	TopicSerialOut = 0, ///< Serial data to the device.
+	TopicSerialIn, ///< Serial data from the device.
+	TopicStatus, ///< Device status.
+	TopicUpdate, ///< Firmware update request.
+	TopicIR, ///< IR commands.
+	TopicRelayIn, ///< Power control request.
+	TopicRelayOut, ///< Power state.
+	TopicButton, ///< Button state.
+	TopicSerialFlow, ///< Serial out flow control.
+	TopicBoot, ///< Boot profile.
+	TopicProfile, ///< Loop profile.
+	TopicCount, ///< Count of the topics, also used as unknown topic.
+};
+
+#pragma endregion
+
+/** @brief Registry of the device MQTT topics.
+ *
+ *  Full topics are built once from the host name and kept in fixed storage.
+ *  Incoming topics are resolved to identifiers by prefix compare and suffix hash.
+ */
+class MqttTopicsClass
+{
+protected:
+
+	/** @brief Full topics storage. */
+	char m_topics[TopicCount][MQTT_TOPIC_MAX_SIZE];
+
+	/** @brief Length of the common prefix "base/hostname". */
+	size_t m_prefixLength = 0;
+
+	/** @brief Suffix hash table of topic identifiers. */
+	uint8_t m_hashTable[MQTT_TOPIC_HASH_SIZE];
+
+	/** @brief FNV-1a hash of a string.
+	 *  @param text const char*, Zero terminated text.
+	 *  @return uint32_t, Hash.
+	 */
+	static uint32_t hash(const char* text);
+
+public:
+
+	/** @brief Constructor.
+	 *  @return MqttTopicsClass
+	 */
+	MqttTopicsClass();
+
+	/** @brief Build the full topics.
+	 *  @param hostname const char*, Host name of the device.
+	 *  @return Void.
+	 */
+	void build(const char* hostname);
+
+	/** @brief Get full topic.
+	 *  @param id MqttTopicId, Topic identifier.
+	 *  @return const char*, Full topic, empty if the identifier is out of range.
+	 */
+	const char* get(MqttTopicId id);
+
+	/** @brief Get topic suffix.
+	 *  @param id MqttTopicId, Topic identifier.
+	 *  @return const char*, Topic suffix, empty if the identifier is out of range.
+	 */
+	static const char* suffix(MqttTopicId id);
+
+	/** @brief Resolve full topic to identifier.
+	 *  @param topic const char*, Full topic.
+	 *  @return MqttTopicId, Topic identifier or TopicCount if unknown.
+	 */
+	MqttTopicId find(const char* topic);
+};
+
+/* @brief Singleton MQTT topics instance. */
+extern MqttTopicsClass MqttTopics;
+
+#endif
@@ -0,0 +1,255 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "MsgPack.h"
+
+/** @brief Constructor.
+ *  @param buffer uint8_t*, Target buffer.
+ *  @param size size_t, Buffer size.
+ *  @return MsgPackWriter
+ */
+MsgPackWriter::MsgPackWriter(uint8_t* buffer, size_t size)
+{
+	m_buffer = buffer;
+	m_size = size;
+}
+
+/** @brief Write raw bytes.
+ *  @param data const uint8_t*, Data.
+ *  @param length size_t, Data length.
+ *  @return Void.
+ */
+void MsgPackWriter::write(const uint8_t* data, size_t length)
+{
+	if (m_overflow || length > m_size - m_length)
+	{
+		m_overflow = true;
+		return;
+	}
+
+	memcpy(m_buffer + m_length, data, length);
+	m_length += length;
+}
+
+/** @brief Write type byte and big endian value.
+ *  @param type uint8_t, Type byte.
+ *  @param value uint64_t, Value.
+ *  @param bytes uint8_t, Value size.
+ *  @return Void.
+ */
+void MsgPackWriter::writeTyped(uint8_t type, uint64_t value, uint8_t bytes)
+{
+	uint8_t DataL[9];
+
+	DataL[0] = type;
+	for (uint8_t index = 0; index < bytes; index++)
+	{
+		DataL[bytes - index] = (uint8_t)(value >> (8 * index));
+	}
+
+	write(DataL, bytes + 1);
+}
+
+/** @brief Write map header.
+ *  @param count uint16_t, Count of the key value pairs.
+ *  @return Void.
+ */
+void MsgPackWriter::writeMap(uint16_t count)
+{
+	if (count < 16)
+	{
+		uint8_t TypeL = 0x80 | count;
+		write(&TypeL, 1);
+	}
+	else
+	{
+		writeTyped(0xDE, count, 2);
+	}
+}
+
+/** @brief Write array header.
+ *  @param count uint16_t, Count of the items.
+ *  @return Void.
+ */
+void MsgPackWriter::writeArray(uint16_t count)
+{
+	if (count < 16)
+	{
+		uint8_t TypeL = 0x90 | count;
+		write(&TypeL, 1);
+	}
+	else
+	{
+		writeTyped(MSGPACK_ARRAY16, count, 2);
+	}
+}
+
+/** @brief Write string.
+ *  @param text const char*, Text, not zero terminated.
+ *  @param length size_t, Text length.
+ *  @return Void.
+ */
+void MsgPackWriter::writeString(const char* text, size_t length)
+{
+	if (length < 32)
+	{
+		uint8_t TypeL = 0xA0 | length;
+		write(&TypeL, 1);
+	}
+	else if (length < 256)
+	{
+		writeTyped(0xD9, length, 1);
+	}
+	else
+	{
+		writeTyped(0xDA, length, 2);
+	}
+
+	write((const uint8_t*)text, length);
+}
+
+/** @brief Write zero terminated string.
+ *  @param text const char*, Text.
+ *  @return Void.
+ */
+void MsgPackWriter::writeString(const char* text)
+{
+	writeString(text, strlen(text));
+}
+
+/** @brief Write unsigned integer in the smallest form.
+ *  @param value uint64_t, Value.
+ *  @return Void.
+ */
+void MsgPackWriter::writeUInt(uint64_t value)
+{
+	if (value < 128)
+	{
+		uint8_t TypeL = (uint8_t)value;
+		write(&TypeL, 1);
+	}
+	else if (value <= 0xFF)
+	{
+		writeTyped(0xCC, value, 1);
+	}
+	else if (value <= 0xFFFF)
+	{
+		writeTyped(0xCD, value, 2);
+	}
+	else if (value <= 0xFFFFFFFFULL)
+	{
+		writeTyped(0xCE, value, 4);
+	}
+	else
+	{
+		writeTyped(0xCF, value, 8);
+	}
+}
+
+/** @brief Write signed integer in the smallest form.
+ *  @param value int64_t, Value.
+ *  @return Void.
+ */
+void MsgPackWriter::writeInt(int64_t value)
+{
+	if (value >= 0)
+	{
+		writeUInt((uint64_t)value);
+	}
+	else if (value >= -32)
+	{
+		uint8_t TypeL = (uint8_t)(int8_t)value;
+		write(&TypeL, 1);
+	}
+	else if (value >= -128)
+	{
+		writeTyped(0xD0, (uint8_t)(int8_t)value, 1);
+	}
+	else if (value >= -32768)
+	{
+		writeTyped(0xD1, (uint16_t)(int16_t)value, 2);
+	}
+	else
+	{
+		writeTyped(0xD2, (uint32_t)(int32_t)value, 4);
+	}
+}
+
+/** @brief Write 32 bit float.
+ *  @param value float, Value.
+ *  @return Void.
+ */
+void MsgPackWriter::writeFloat(float value)
+{
+	uint32_t BitsL;
+
+	memcpy(&BitsL, &value, sizeof(BitsL));
+	writeTyped(0xCA, BitsL, 4);
+}
+
+/** @brief Write boolean.
+ *  @param value bool, Value.
+ *  @return Void.
+ */
+void MsgPackWriter::writeBool(bool value)
+{
+	uint8_t TypeL = value ? 0xC3 : 0xC2;
+	write(&TypeL, 1);
+}
+
+/** @brief Written bytes.
+ *  @return size_t, Length.
+ */
+size_t MsgPackWriter::length()
+{
+	return m_length;
+}
+
+/** @brief Buffer was too small.
+ *  @return bool, True on overflow.
+ */
+bool MsgPackWriter::overflow()
+{
+	return m_overflow;
+}
+
+/** @brief Size of string header.
+ *  @param length size_t, String length.
+ *  @return size_t, Header size.
+ */
+size_t MsgPackWriter::stringHeaderSize(size_t length)
+{
+	if (length < 32)
+	{
+		return 1;
+	}
+
+	if (length < 256)
+	{
+		return 2;
+	}
+
+	return 3;
+}
@@ -0,0 +1,154 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// MsgPack.h
+
+#ifndef _MSGPACK_h
+#define _MSGPACK_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Definitions
+
+/** @brief Array with 16 bit count, the count follows big endian. */
+#define MSGPACK_ARRAY16 0xDC
+
+/** @brief Size of array 16 header. */
+#define MSGPACK_ARRAY16_SIZE 3
+
+#pragma endregion
+
+/** @brief MessagePack writer.
+ *
+ *  Writes straight in a fixed buffer. When the buffer is too small the
+ *  writer stops and reports overflow, the content is not usable then.
+ */
+class MsgPackWriter
+{
+protected:
+
+	/** @brief Target buffer. */
+	uint8_t* m_buffer;
+
+	/** @brief Buffer size. */
+	size_t m_size;
+
+	/** @brief Written bytes. */
+	size_t m_length = 0;
+
+	/** @brief Buffer was too small. */
+	bool m_overflow = false;
+
+	/** @brief Write raw bytes.
+	 *  @param data const uint8_t*, Data.
+	 *  @param length size_t, Data length.
+	 *  @return Void.
+	 */
+	void write(const uint8_t* data, size_t length);
+
+	/** @brief Write type byte and big endian value.
+	 *  @param type uint8_t, Type byte.
+	 *  @param value uint64_t, Value.
+	 *  @param bytes uint8_t, Value size.
+	 *  @return Void.
+	 */
+	void writeTyped(uint8_t type, uint64_t value, uint8_t bytes);
+
+public:
+
+	/** @brief Constructor.
+	 *  @param buffer uint8_t*, Target buffer.
+	 *  @param size size_t, Buffer size.
+	 *  @return MsgPackWriter
+	 */
+	MsgPackWriter(uint8_t* buffer, size_t size);
+
+	/** @brief Write map header.
+	 *  @param count uint16_t, Count of the key value pairs.
+	 *  @return Void.
+	 */
+	void writeMap(uint16_t count);
+
+	/** @brief Write array header.
+	 *  @param count uint16_t, Count of the items.
+	 *  @return Void.
+	 */
+	void writeArray(uint16_t count);
+
+	/** @brief Write string.
+	 *  @param text const char*, Text, not zero terminated.
+	 *  @param length size_t, Text length.
+	 *  @return Void.
+	 */
+	void writeString(const char* text, size_t length);
+
+	/** @brief Write zero terminated string.
+	 *  @param text const char*, Text.
+	 *  @return Void.
+	 */
+	void writeString(const char* text);
+
+	/** @brief Write unsigned integer in the smallest form.
+	 *  @param value uint64_t, Value.
+	 *  @return Void.
+	 */
+	void writeUInt(uint64_t value);
+
+	/** @brief Write signed integer in the smallest form.
+	 *  @param value int64_t, Value.
+	 *  @return Void.
+	 */
+	void writeInt(int64_t value);
+
+	/** @brief Write 32 bit float.
+	 *  @param value float, Value.
+	 *  @return Void.
+	 */
+	void writeFloat(float value);
+
+	/** @brief Write boolean.
+	 *  @param value bool, Value.
+	 *  @return Void.
+	 */
+	void writeBool(bool value);
+
+	/** @brief Written bytes.
+	 *  @return size_t, Length.
+	 */
+	size_t length();
+
+	/** @brief Buffer was too small.
+	 *  @return bool, True on overflow.
+	 */
+	bool overflow();
+
+	/** @brief Size of string header.
+	 *  @param length size_t, String length.
+	 *  @return size_t, Header size.
+	 */
+	static size_t stringHeaderSize(size_t length);
+};
+
+#endif
@@ -89,17 +89,11 @@ bool load_network_configuration(FS* fileSystem, const char* path) {
 	return true;
 }
 
-/** @brief Save configuration.
- *  @param fileSystem FS, File system of the device.
+/** @brief Export configuration as JSON.
+ *  @param output Print, Destination of the JSON.
  *  @return boolean, Successful saving.
  */
-bool save_network_configuration(FS* fileSystem, const char* path) {
-#ifdef SHOW_FUNC_NAMES
-	DEBUGLOG("\r\n");
-	DEBUGLOG(__PRETTY_FUNCTION__);
-	DEBUGLOG("\r\n");
-#endif // SHOW_FUNC_NAMES
-
+bool save_network_configuration(Print* output) {
 	//flag_config = false;
 	DynamicJsonDocument doc(512);
 
@@ -134,6 +128,28 @@ bool save_network_configuration(FS* fileSystem, const char* path) {
 
 	doc["dhcp"] = NetworkConfiguration.DHCP;
 
+#ifdef SHOW_CONFIG
+	String temp;
+	serializeJson(doc, temp);
+	DEBUGLOG("%s\r\n", temp.c_str());
+#endif
+
+	serializeJson(doc, *output);
+
+	return true;
+}
+
+/** @brief Save configuration.
+ *  @param fileSystem FS, File system of the device.
+ *  @return boolean, Successful saving.
+ */
+bool save_network_configuration(FS* fileSystem, const char* path) {
+#ifdef SHOW_FUNC_NAMES
+	DEBUGLOG("\r\n");
+	DEBUGLOG(__PRETTY_FUNCTION__);
+	DEBUGLOG("\r\n");
+#endif // SHOW_FUNC_NAMES
+
 	File file = fileSystem->open(path, "w");
 	if (!file)
 	{
@@ -142,13 +158,7 @@ bool save_network_configuration(FS* fileSystem, const char* path) {
 		return false;
 	}
 
-#ifdef SHOW_CONFIG
-	String temp;
-	serializeJson(doc, temp);
-	DEBUGLOG("%s\r\n", temp.c_str());
-#endif
-
-	serializeJson(doc, file);
+	save_network_configuration(&file);
 	file.flush();
 	file.close();
 
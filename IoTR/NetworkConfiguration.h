@@ -88,6 +88,12 @@ bool load_network_configuration(FS* fileSystem, const char* path);
  */
 bool save_network_configuration(FS* fileSystem, const char* path);
 
+/** @brief Export configuration as JSON.
+ *  @param output Print, Destination of the JSON.
+ *  @return boolean, Successful saving.
+ */
+bool save_network_configuration(Print* output);
+
 /** @brief Default configuration.
  *  @return Void
  */
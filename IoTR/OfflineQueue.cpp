@@ -0,0 +1,453 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "OfflineQueue.h"
+
+/** @brief Calculate CRC8 (polynomial 0x07).
+ *  @param data const uint8_t*, Data.
+ *  @param length size_t, Data length.
+ *  @param crc uint8_t, CRC of the previous data, to continue it.
+ *  @return uint8_t, CRC.
+ */
+static uint8_t offline_crc8(const uint8_t* data, size_t length, uint8_t crc = 0)
+{
+	for (size_t index = 0; index < length; index++)
+	{
+		crc ^= data[index];
+		for (uint8_t bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+		}
+	}
+
+	return crc;
+}
+
+/** @brief Copy bytes in the RAM ring.
+ *  @param data const uint8_t*, Data.
+ *  @param length size_t, Data length.
+ *  @return Void.
+ */
+void OfflineQueueClass::ringWrite(const uint8_t* data, size_t length)
+{
+	size_t ChunkL = OFFLINE_QUEUE_RAM_SIZE - m_head;
+
+	if (ChunkL > length)
+	{
+		ChunkL = length;
+	}
+
+	memcpy(m_ring + m_head, data, ChunkL);
+	memcpy(m_ring, data + ChunkL, length - ChunkL);
+
+	m_head = (m_head + length) % OFFLINE_QUEUE_RAM_SIZE;
+	m_depth += length;
+}
+
+/** @brief Copy bytes from the RAM ring without removing them.
+ *  @param offset size_t, Offset from the read index.
+ *  @param data uint8_t*, Target.
+ *  @param length size_t, Data length.
+ *  @return Void.
+ */
+void OfflineQueueClass::ringPeek(size_t offset, uint8_t* data, size_t length)
+{
+	size_t StartL = (m_tail + offset) % OFFLINE_QUEUE_RAM_SIZE;
+	size_t ChunkL = OFFLINE_QUEUE_RAM_SIZE - StartL;
+
+	if (ChunkL > length)
+	{
+		ChunkL = length;
+	}
+
+	memcpy(data, m_ring + StartL, ChunkL);
+	memcpy(data + ChunkL, m_ring, length - ChunkL);
+}
+
+/** @brief Build record header.
+ *  @param header uint8_t*, Target, OFFLINE_RECORD_HEADER_SIZE bytes.
+ *  @param id MqttTopicId, Topic of the record.
+ *  @param data const char*, Payload.
+ *  @param length size_t, Payload length.
+ *  @return Void.
+ */
+void OfflineQueueClass::makeHeader(uint8_t* header, MqttTopicId id, const char* data, size_t length)
+{
+	header[0] = OFFLINE_RECORD_MAGIC;
+	header[1] = (uint8_t)(length & 0xFF);
+	header[2] = (uint8_t)(length >> 8);
+	header[3] = (uint8_t)id;
+
+	// The CRC covers the length, the topic and the payload.
+	header[4] = offline_crc8((const uint8_t*)data, length, offline_crc8(header + 1, 3));
+}
+
+/** @brief Read record header.
+ *  @param header const uint8_t*, Record header.
+ *  @param id MqttTopicId*, Topic of the record.
+ *  @param length size_t*, Payload length.
+ *  @return bool, False if the header is not valid.
+ */
+bool OfflineQueueClass::readHeader(const uint8_t* header, MqttTopicId* id, size_t* length)
+{
+	*length = header[1] | (header[2] << 8);
+	*id = (MqttTopicId)header[3];
+
+	// A log from a firmware with other topics is not valid either.
+	return (header[0] == OFFLINE_RECORD_MAGIC) && (*length <= OFFLINE_RECORD_MAX_SIZE) && (*id < TopicCount);
+}
+
+/** @brief Append record to the spill log.
+ *  @param header const uint8_t*, Record header.
+ *  @param data const char*, Payload.
+ *  @param length size_t, Payload length.
+ *  @return bool, True if written.
+ */
+bool OfflineQueueClass::fileAppend(const uint8_t* header, const char* data, size_t length)
+{
+	if (m_fileSystem == nullptr || m_fileBlocked)
+	{
+		return false;
+	}
+
+	if (m_fileWrite + OFFLINE_RECORD_HEADER_SIZE + length > OFFLINE_QUEUE_FILE_SIZE)
+	{
+		return false;
+	}
+
+	// One open per outage, the file system caches the small writes into pages.
+	if (!m_spillFile)
+	{
+		m_spillFile = m_fileSystem->open(OFFLINE_QUEUE_PATH, "a");
+		if (!m_spillFile)
+		{
+			DEBUGLOG("Failed to open spill log.\r\n");
+			return false;
+		}
+	}
+
+	size_t WrittenL = m_spillFile.write(header, OFFLINE_RECORD_HEADER_SIZE);
+	WrittenL += m_spillFile.write((const uint8_t*)data, length);
+
+	// Records after a torn one could not be found, so stop appending
+	// until the log is drained and removed.
+	if (WrittenL != OFFLINE_RECORD_HEADER_SIZE + length)
+	{
+		DEBUGLOG("Spill log is full.\r\n");
+		m_spillFile.close();
+		m_fileBlocked = true;
+		return false;
+	}
+
+	m_fileWrite += WrittenL;
+
+	return true;
+}
+
+/** @brief Close the spill log and remove it.
+ *  @return Void.
+ */
+void OfflineQueueClass::fileRemove()
+{
+	if (m_spillFile)
+	{
+		m_spillFile.close();
+	}
+
+	m_fileSystem->remove(OFFLINE_QUEUE_PATH);
+	m_fileRead = 0;
+	m_fileWrite = 0;
+	m_fileBlocked = false;
+}
+
+/** @brief Load the oldest record.
+ *  @param id MqttTopicId*, Topic of the record.
+ *  @param length size_t*, Payload length, payload is in m_record.
+ *  @param size size_t*, Size of the record in the queue.
+ *  @param fromFile bool*, Record is from the spill log.
+ *  @return bool, True if loaded.
+ */
+bool OfflineQueueClass::peek(MqttTopicId* id, size_t* length, size_t* size, bool* fromFile)
+{
+	uint8_t HeaderL[OFFLINE_RECORD_HEADER_SIZE];
+
+	if (m_depth > 0)
+	{
+		ringPeek(0, HeaderL, OFFLINE_RECORD_HEADER_SIZE);
+
+		// RAM records are written here, they are always valid.
+		readHeader(HeaderL, id, length);
+		*size = OFFLINE_RECORD_HEADER_SIZE + *length;
+		*fromFile = false;
+
+		ringPeek(OFFLINE_RECORD_HEADER_SIZE, (uint8_t*)m_record, *length);
+
+		return true;
+	}
+
+	if (m_fileRead >= m_fileWrite || m_fileSystem == nullptr)
+	{
+		return false;
+	}
+
+	// The reader has to see what is still in the cache of the appends.
+	if (m_spillFile)
+	{
+		m_spillFile.flush();
+	}
+
+	File file = m_fileSystem->open(OFFLINE_QUEUE_PATH, "r");
+	if (!file)
+	{
+		return false;
+	}
+
+	bool ValidL = file.seek(m_fileRead, SeekSet)
+		&& file.read(HeaderL, OFFLINE_RECORD_HEADER_SIZE) == OFFLINE_RECORD_HEADER_SIZE;
+
+	if (ValidL)
+	{
+		ValidL = readHeader(HeaderL, id, length);
+		*size = OFFLINE_RECORD_HEADER_SIZE + *length;
+		*fromFile = true;
+	}
+
+	if (ValidL)
+	{
+		ValidL = (file.read((uint8_t*)m_record, *length) == *length)
+			&& (offline_crc8((const uint8_t*)m_record, *length, offline_crc8(HeaderL + 1, 3)) == HeaderL[4]);
+	}
+
+	file.close();
+
+	if (!ValidL)
+	{
+		// Broken tail of the log, nothing after it can be trusted.
+		DEBUGLOG("Spill log is broken at %d.\r\n", m_fileRead);
+		m_fileRead = m_fileWrite;
+		m_count = 0;
+	}
+
+	return ValidL;
+}
+
+/** @brief Set the file system and pick up records left from the last run.
+ *  @param fileSystem FS*, File system of the spill log.
+ *  @return Void.
+ */
+void OfflineQueueClass::init(FS* fileSystem)
+{
+#ifdef SHOW_FUNC_NAMES
+	DEBUGLOG("\r\n");
+	DEBUGLOG(__PRETTY_FUNCTION__);
+	DEBUGLOG("\r\n");
+#endif // SHOW_FUNC_NAMES
+
+	m_fileSystem = fileSystem;
+	m_fileRead = 0;
+	m_fileWrite = 0;
+	m_fileBlocked = false;
+	m_replayTimer.setExpirationTime(OFFLINE_REPLAY_INTERVAL);
+
+	File file = m_fileSystem->open(OFFLINE_QUEUE_PATH, "r");
+	if (!file)
+	{
+		return;
+	}
+
+	// Count the whole records, up to a torn or foreign one.
+	uint8_t HeaderL[OFFLINE_RECORD_HEADER_SIZE];
+	MqttTopicId IdL;
+	size_t LengthL;
+	size_t SizeL = file.size();
+
+	while (m_fileWrite + OFFLINE_RECORD_HEADER_SIZE <= SizeL)
+	{
+		file.seek(m_fileWrite, SeekSet);
+		if (file.read(HeaderL, OFFLINE_RECORD_HEADER_SIZE) != OFFLINE_RECORD_HEADER_SIZE)
+		{
+			break;
+		}
+
+		if (!readHeader(HeaderL, &IdL, &LengthL)
+			|| (m_fileWrite + OFFLINE_RECORD_HEADER_SIZE + LengthL > SizeL))
+		{
+			break;
+		}
+
+		m_fileWrite += OFFLINE_RECORD_HEADER_SIZE + LengthL;
+		m_count++;
+	}
+
+	file.close();
+
+	// Appends would land after the bad bytes, where replay never gets.
+	// Stop them until the good records are drained and the log is removed.
+	if (m_fileWrite < SizeL)
+	{
+		DEBUGLOG("Spill log is broken at %d.\r\n", m_fileWrite);
+		m_fileBlocked = true;
+	}
+
+	DEBUGLOG("Spill log records: %d\r\n", m_count);
+}
+
+/** @brief Store message.
+ *  @param id MqttTopicId, Topic of the message.
+ *  @param data const char*, Payload.
+ *  @param length size_t, Payload length.
+ *  @return bool, True if stored.
+ */
+bool OfflineQueueClass::push(MqttTopicId id, const char* data, size_t length)
+{
+	if (length > OFFLINE_RECORD_MAX_SIZE)
+	{
+		m_dropped++;
+		return false;
+	}
+
+	uint8_t HeaderL[OFFLINE_RECORD_HEADER_SIZE];
+	makeHeader(HeaderL, id, data, length);
+
+	// Keep the order, once spilling everything goes to the log until it is drained.
+	bool SpillL = (m_fileRead < m_fileWrite) || m_fileBlocked
+		|| (OFFLINE_RECORD_HEADER_SIZE + length > OFFLINE_QUEUE_RAM_SIZE - m_depth);
+
+	if (SpillL)
+	{
+		if (!fileAppend(HeaderL, data, length))
+		{
+			m_dropped++;
+			return false;
+		}
+
+		m_spilled++;
+	}
+	else
+	{
+		ringWrite(HeaderL, OFFLINE_RECORD_HEADER_SIZE);
+		ringWrite((const uint8_t*)data, length);
+	}
+
+	m_count++;
+
+	return true;
+}
+
+/** @brief Replay stored messages, call it while connected.
+ *  @return Void.
+ */
+void OfflineQueueClass::update()
+{
+	if (m_callbackReplay == nullptr)
+	{
+		return;
+	}
+
+	if (m_count == 0 && m_fileWrite == 0 && !m_fileBlocked)
+	{
+		return;
+	}
+
+	m_replayTimer.update();
+	if (!m_replayTimer.expired())
+	{
+		return;
+	}
+	m_replayTimer.clear();
+
+	MqttTopicId IdL;
+	size_t LengthL;
+	size_t SizeL;
+	bool FromFileL;
+
+	for (uint8_t index = 0; index < OFFLINE_REPLAY_BURST; index++)
+	{
+		if (!peek(&IdL, &LengthL, &SizeL, &FromFileL))
+		{
+			break;
+		}
+
+		// Try again on the next burst.
+		if (!m_callbackReplay(IdL, m_record, LengthL))
+		{
+			break;
+		}
+
+		if (FromFileL)
+		{
+			m_fileRead += SizeL;
+		}
+		else
+		{
+			m_tail = (m_tail + SizeL) % OFFLINE_QUEUE_RAM_SIZE;
+			m_depth -= SizeL;
+		}
+
+		m_count--;
+	}
+
+	// Log is drained, start over.
+	if ((m_fileWrite > 0 || m_fileBlocked) && m_fileRead >= m_fileWrite)
+	{
+		fileRemove();
+	}
+}
+
+/** @brief Count of the stored messages.
+ *  @return unsigned long, Stored messages.
+ */
+unsigned long OfflineQueueClass::count()
+{
+	return m_count;
+}
+
+/** @brief Count of the dropped messages.
+ *  @return unsigned long, Dropped messages.
+ */
+unsigned long OfflineQueueClass::getDropped()
+{
+	return m_dropped;
+}
+
+/** @brief Count of the messages written to the spill log.
+ *  @return unsigned long, Spilled messages.
+ */
+unsigned long OfflineQueueClass::getSpilled()
+{
+	return m_spilled;
+}
+
+/** @brief Set callback that publishes replayed message.
+ *  @param callback bool(*)(MqttTopicId, const char*, size_t), Returns false if not published.
+ *  @return Void.
+ */
+void OfflineQueueClass::setReplayCb(bool(*callback)(MqttTopicId id, const char* payload, size_t length))
+{
+	m_callbackReplay = callback;
+}
+
+/* @brief Singleton offline queue instance. */
+OfflineQueueClass OfflineQueue;
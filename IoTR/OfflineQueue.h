@@ -0,0 +1,244 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// OfflineQueue.h
+
+#ifndef _OFFLINEQUEUE_h
+#define _OFFLINEQUEUE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#include "FxTimer.h"
+
+#include "MqttTopics.h"
+
+#include <FS.h>
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef OFFLINE_QUEUE_PATH
+/** @brief Spill log file. */
+#define OFFLINE_QUEUE_PATH "/offline.log"
+#endif // !OFFLINE_QUEUE_PATH
+
+#ifndef OFFLINE_QUEUE_RAM_SIZE
+/** @brief Size of the RAM queue. */
+#define OFFLINE_QUEUE_RAM_SIZE 4096
+#endif // !OFFLINE_QUEUE_RAM_SIZE
+
+#ifndef OFFLINE_QUEUE_FILE_SIZE
+/** @brief Maximum size of the spill log. */
+#define OFFLINE_QUEUE_FILE_SIZE 65536UL
+#endif // !OFFLINE_QUEUE_FILE_SIZE
+
+#ifndef OFFLINE_RECORD_MAX_SIZE
+/** @brief Maximum payload of one record. */
+#define OFFLINE_RECORD_MAX_SIZE 512
+#endif // !OFFLINE_RECORD_MAX_SIZE
+
+/** @brief Record header size: magic (1), length (2), topic identifier (1) and CRC8 (1). */
+#define OFFLINE_RECORD_HEADER_SIZE 5
+
+/** @brief First byte of every record, a torn or foreign header does not start with it. */
+#define OFFLINE_RECORD_MAGIC 0xA5
+
+#ifndef OFFLINE_REPLAY_INTERVAL
+/** @brief Time between replay bursts [ms]. */
+#define OFFLINE_REPLAY_INTERVAL 50
+#endif // !OFFLINE_REPLAY_INTERVAL
+
+#ifndef OFFLINE_REPLAY_BURST
+/** @brief Records replayed per burst. */
+#define OFFLINE_REPLAY_BURST 4
+#endif // !OFFLINE_REPLAY_BURST
+
+#pragma endregion
+
+/** @brief Offline store and forward queue.
+ *
+ *  Keeps messages that could not be published. Records go to RAM first and
+ *  to the spill log when RAM is full. While the log has records, new records
+ *  are appended to it too, so RAM always holds the oldest ones. After
+ *  reconnect the records are replayed in order, a few per interval, so the
+ *  live traffic still gets through. Payloads carry their own timestamps.
+ */
+class OfflineQueueClass
+{
+protected:
+
+	/** @brief File system of the spill log. */
+	FS* m_fileSystem = nullptr;
+
+	/** @brief RAM ring buffer. */
+	uint8_t m_ring[OFFLINE_QUEUE_RAM_SIZE];
+
+	/** @brief RAM write index. */
+	size_t m_head = 0;
+
+	/** @brief RAM read index. */
+	size_t m_tail = 0;
+
+	/** @brief RAM queued bytes. */
+	size_t m_depth = 0;
+
+	/** @brief Spill log read offset. */
+	size_t m_fileRead = 0;
+
+	/** @brief Spill log size. */
+	size_t m_fileWrite = 0;
+
+	/** @brief Spill log, kept open for appends while spilling. */
+	File m_spillFile;
+
+	/** @brief Appends to the spill log are stopped until it is drained. */
+	bool m_fileBlocked = false;
+
+	/** @brief Queued records. */
+	unsigned long m_count = 0;
+
+	/** @brief Count of the dropped records. */
+	unsigned long m_dropped = 0;
+
+	/** @brief Count of the records written to the spill log. */
+	unsigned long m_spilled = 0;
+
+	/** @brief Record that is replayed. */
+	char m_record[OFFLINE_RECORD_MAX_SIZE];
+
+	/** @brief Replay throttle timer. */
+	FxTimer m_replayTimer;
+
+	/** @brief Callback that publishes replayed record. */
+	bool(*m_callbackReplay)(MqttTopicId id, const char* payload, size_t length) = nullptr;
+
+	/** @brief Copy bytes in the RAM ring.
+	 *  @param data const uint8_t*, Data.
+	 *  @param length size_t, Data length.
+	 *  @return Void.
+	 */
+	void ringWrite(const uint8_t* data, size_t length);
+
+	/** @brief Copy bytes from the RAM ring without removing them.
+	 *  @param offset size_t, Offset from the read index.
+	 *  @param data uint8_t*, Target.
+	 *  @param length size_t, Data length.
+	 *  @return Void.
+	 */
+	void ringPeek(size_t offset, uint8_t* data, size_t length);
+
+	/** @brief Build record header.
+	 *  @param header uint8_t*, Target, OFFLINE_RECORD_HEADER_SIZE bytes.
+	 *  @param id MqttTopicId, Topic of the record.
+	 *  @param data const char*, Payload.
+	 *  @param length size_t, Payload length.
+	 *  @return Void.
+	 */
+	static void makeHeader(uint8_t* header, MqttTopicId id, const char* data, size_t length);
+
+	/** @brief Read record header.
+	 *  @param header const uint8_t*, Record header.
+	 *  @param id MqttTopicId*, Topic of the record.
+	 *  @param length size_t*, Payload length.
+	 *  @return bool, False if the header is not valid.
+	 */
+	static bool readHeader(const uint8_t* header, MqttTopicId* id, size_t* length);
+
+	/** @brief Append record to the spill log.
+	 *  @param header const uint8_t*, Record header.
+	 *  @param data const char*, Payload.
+	 *  @param length size_t, Payload length.
+	 *  @return bool, True if written.
+	 */
+	bool fileAppend(const uint8_t* header, const char* data, size_t length);
+
+	/** @brief Close the spill log and remove it.
+	 *  @return Void.
+	 */
+	void fileRemove();
+
+	/** @brief Load the oldest record.
+	 *  @param id MqttTopicId*, Topic of the record.
+	 *  @param length size_t*, Payload length, payload is in m_record.
+	 *  @param size size_t*, Size of the record in the queue.
+	 *  @param fromFile bool*, Record is from the spill log.
+	 *  @return bool, True if loaded.
+	 */
+	bool peek(MqttTopicId* id, size_t* length, size_t* size, bool* fromFile);
+
+public:
+
+	/** @brief Set the file system and pick up records left from the last run.
+	 *  @param fileSystem FS*, File system of the spill log.
+	 *  @return Void.
+	 */
+	void init(FS* fileSystem);
+
+	/** @brief Store message.
+	 *  @param id MqttTopicId, Topic of the message.
+	 *  @param data const char*, Payload.
+	 *  @param length size_t, Payload length.
+	 *  @return bool, True if stored.
+	 */
+	bool push(MqttTopicId id, const char* data, size_t length);
+
+	/** @brief Replay stored messages, call it while connected.
+	 *  @return Void.
+	 */
+	void update();
+
+	/** @brief Count of the stored messages.
+	 *  @return unsigned long, Stored messages.
+	 */
+	unsigned long count();
+
+	/** @brief Count of the dropped messages.
+	 *  @return unsigned long, Dropped messages.
+	 */
+	unsigned long getDropped();
+
+	/** @brief Count of the messages written to the spill log.
+	 *  @return unsigned long, Spilled messages.
+	 */
+	unsigned long getSpilled();
+
+	/** @brief Set callback that publishes replayed message.
+	 *  @param callback bool(*)(MqttTopicId, const char*, size_t), Returns false if not published.
+	 *  @return Void.
+	 */
+	void setReplayCb(bool(*callback)(MqttTopicId id, const char* payload, size_t length));
+};
+
+/* @brief Singleton offline queue instance. */
+extern OfflineQueueClass OfflineQueue;
+
+#endif
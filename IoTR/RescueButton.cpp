@@ -30,11 +30,11 @@ void update_rescue_procedure()
 			DEBUGLOG("-===RESCUE===-\r\n");
 			// Clear device.
 			set_default_device_config();
-			save_device_config(&SPIFFS, CONFIG_DEVICE);
 
 			// Clear network.
 			set_default_network_configuration();
-			save_network_configuration(&SPIFFS, CONFIG_NET);
+
+			save_configuration(&SPIFFS);
 
 			// TODO: Set the LED to yellow.
 
@@ -21,6 +21,7 @@
 #include "FxTimer.h"
 #include "NetworkConfiguration.h"
 #include "DeviceConfiguration.h"
+#include "ConfigStore.h"
 
 #ifndef RESCUE_DEVICE_TIME
 #define RESCUE_DEVICE_TIME 5000
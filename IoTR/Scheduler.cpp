@@ -0,0 +1,358 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "Scheduler.h"
+
+/** @brief Compare the deadlines of two tasks, wrap safe.
+ *  @param a uint8_t, Task identifier.
+ *  @param b uint8_t, Task identifier.
+ *  @return bool, True if a is before b.
+ */
+bool SchedulerClass::before(uint8_t a, uint8_t b)
+{
+	long DiffL = (long)(m_tasks[a].Deadline - m_tasks[b].Deadline);
+	if (DiffL != 0)
+	{
+		return DiffL < 0;
+	}
+
+	return m_tasks[a].Priority < m_tasks[b].Priority;
+}
+
+/** @brief Push task to the heap.
+ *  @param id uint8_t, Task identifier.
+ *  @return Void.
+ */
+void SchedulerClass::push(uint8_t id)
+{
+	uint8_t IndexL = m_heapCount++;
+	m_heap[IndexL] = id;
+	m_tasks[id].Queued = true;
+
+	// Sift up.
+	while (IndexL > 0)
+	{
+		uint8_t ParentL = (IndexL - 1) / 2;
+		if (!before(m_heap[IndexL], m_heap[ParentL]))
+		{
+			break;
+		}
+
+		uint8_t SwapL = m_heap[ParentL];
+		m_heap[ParentL] = m_heap[IndexL];
+		m_heap[IndexL] = SwapL;
+		IndexL = ParentL;
+	}
+}
+
+/** @brief Pop the earliest task from the heap.
+ *  @return uint8_t, Task identifier.
+ */
+uint8_t SchedulerClass::pop()
+{
+	uint8_t IdL = m_heap[0];
+	m_heap[0] = m_heap[--m_heapCount];
+	m_tasks[IdL].Queued = false;
+
+	// Sift down.
+	uint8_t IndexL = 0;
+	for (;;)
+	{
+		uint8_t LeftL = 2 * IndexL + 1;
+		uint8_t RightL = LeftL + 1;
+		uint8_t FirstL = IndexL;
+
+		if ((LeftL < m_heapCount) && before(m_heap[LeftL], m_heap[FirstL]))
+		{
+			FirstL = LeftL;
+		}
+		if ((RightL < m_heapCount) && before(m_heap[RightL], m_heap[FirstL]))
+		{
+			FirstL = RightL;
+		}
+		if (FirstL == IndexL)
+		{
+			break;
+		}
+
+		uint8_t SwapL = m_heap[FirstL];
+		m_heap[FirstL] = m_heap[IndexL];
+		m_heap[IndexL] = SwapL;
+		IndexL = FirstL;
+	}
+
+	return IdL;
+}
+
+/** @brief Remove task from the heap, if it is there.
+ *  @param id uint8_t, Task identifier.
+ *  @return Void.
+ */
+void SchedulerClass::unlink(uint8_t id)
+{
+	// Due tasks are out of the heap while the pass runs them.
+	if (!m_tasks[id].Queued)
+	{
+		return;
+	}
+
+	m_tasks[id].Queued = false;
+
+	// The heap is small, rebuild it without the task.
+	uint8_t CountL = m_heapCount;
+	uint8_t ItemsL[SCHEDULER_MAX_TASKS];
+	memcpy(ItemsL, m_heap, CountL);
+
+	m_heapCount = 0;
+	for (uint8_t index = 0; index < CountL; index++)
+	{
+		if (ItemsL[index] != id)
+		{
+			push(ItemsL[index]);
+		}
+	}
+}
+
+/** @brief Add task.
+ *  @param name const char*, Name.
+ *  @param delay unsigned long, Time to the first run [ms].
+ *  @param period unsigned long, Period [ms], zero for one-shot.
+ *  @param run Work.
+ *  @param priority uint8_t, Priority.
+ *  @param budget unsigned long, Allowed run time [us].
+ *  @return uint8_t, Identifier or SCHEDULER_NO_TASK if the table is full.
+ */
+uint8_t SchedulerClass::add(const char* name, unsigned long delay, unsigned long period, void(*run)(unsigned long now), uint8_t priority, unsigned long budget)
+{
+	if (m_count >= SCHEDULER_MAX_TASKS)
+	{
+		DEBUGLOG("Scheduler tasks limit: %s\r\n", name);
+		return SCHEDULER_NO_TASK;
+	}
+
+	SchedulerTask_t* TaskL = &m_tasks[m_count];
+	memset(TaskL, 0, sizeof(SchedulerTask_t));
+	TaskL->Name = name;
+	TaskL->Run = run;
+	TaskL->Period = period;
+	TaskL->Priority = priority;
+	TaskL->Budget = budget;
+
+	restart(m_count, delay);
+
+	return m_count++;
+}
+
+/** @brief Add periodic task. The first run is at once.
+ *  @param name const char*, Name.
+ *  @param period unsigned long, Period [ms].
+ *  @param run Work.
+ *  @param priority uint8_t, Priority.
+ *  @param budget unsigned long, Allowed run time [us], zero for no limit.
+ *  @return uint8_t, Identifier or SCHEDULER_NO_TASK if the table is full.
+ */
+uint8_t SchedulerClass::every(const char* name, unsigned long period, void(*run)(unsigned long now), uint8_t priority, unsigned long budget)
+{
+	return add(name, 0, period, run, priority, budget);
+}
+
+/** @brief Add one-shot task.
+ *  @param name const char*, Name.
+ *  @param delay unsigned long, Time to the run [ms].
+ *  @param run Work.
+ *  @param priority uint8_t, Priority.
+ *  @param budget unsigned long, Allowed run time [us], zero for no limit.
+ *  @return uint8_t, Identifier or SCHEDULER_NO_TASK if the table is full.
+ */
+uint8_t SchedulerClass::after(const char* name, unsigned long delay, void(*run)(unsigned long now), uint8_t priority, unsigned long budget)
+{
+	return add(name, delay, 0, run, priority, budget);
+}
+
+/** @brief Schedule the task again, one-shot tasks can be reused this way.
+ *  @param id uint8_t, Task identifier.
+ *  @param delay unsigned long, Time to the next run [ms].
+ *  @return Void.
+ */
+void SchedulerClass::restart(uint8_t id, unsigned long delay)
+{
+	if (id >= SCHEDULER_MAX_TASKS)
+	{
+		return;
+	}
+
+	unlink(id);
+
+	m_tasks[id].Deadline = millis() + delay;
+	m_tasks[id].Active = true;
+	push(id);
+}
+
+/** @brief Stop the task.
+ *  @param id uint8_t, Task identifier.
+ *  @return Void.
+ */
+void SchedulerClass::cancel(uint8_t id)
+{
+	if ((id >= m_count) || !m_tasks[id].Active)
+	{
+		return;
+	}
+
+	m_tasks[id].Active = false;
+	unlink(id);
+}
+
+/** @brief Run the due tasks. Call it from the main loop.
+ *  @return Void.
+ */
+void SchedulerClass::update()
+{
+	// One time for the whole pass.
+	unsigned long NowL = millis();
+
+	// Take the due tasks out of the heap, they are put back after they run.
+	uint8_t DueL[SCHEDULER_MAX_TASKS];
+	uint8_t DueCountL = 0;
+
+	while ((m_heapCount > 0) && ((long)(NowL - m_tasks[m_heap[0]].Deadline) >= 0))
+	{
+		uint8_t IdL = pop();
+
+		// Priority order, so a late low priority task does not go first.
+		uint8_t IndexL = DueCountL++;
+		while ((IndexL > 0) && (m_tasks[DueL[IndexL - 1]].Priority > m_tasks[IdL].Priority))
+		{
+			DueL[IndexL] = DueL[IndexL - 1];
+			IndexL--;
+		}
+		DueL[IndexL] = IdL;
+	}
+
+	for (uint8_t index = 0; index < DueCountL; index++)
+	{
+		SchedulerTask_t* TaskL = &m_tasks[DueL[index]];
+
+		// Cancelled or restarted by a task that ran before it in this pass.
+		if (!TaskL->Active || TaskL->Queued)
+		{
+			continue;
+		}
+
+		// One-shot tasks are done before they run, so they can restart themselves.
+		if (TaskL->Period == 0)
+		{
+			TaskL->Active = false;
+		}
+
+		unsigned long StartL = micros();
+		TaskL->Run(NowL);
+		unsigned long TimeL = micros() - StartL;
+
+		TaskL->Runs++;
+		TaskL->TotalTime += TimeL;
+		if ((TaskL->Budget > 0) && (TimeL > TaskL->Budget))
+		{
+			TaskL->Overruns++;
+		}
+		if (TimeL > TaskL->MaxTime)
+		{
+			TaskL->MaxTime = TimeL;
+			if ((TaskL->Budget > 0) && (TimeL > TaskL->Budget))
+			{
+				DEBUGLOG("Task %s over budget: %lu us\r\n", TaskL->Name, TimeL);
+			}
+		}
+
+		// Not again if the task was cancelled or restarted by its run.
+		if ((TaskL->Period > 0) && TaskL->Active && !TaskL->Queued)
+		{
+			// Keep the rate, but do not run a burst to catch up.
+			TaskL->Deadline += TaskL->Period;
+			if ((long)(NowL - TaskL->Deadline) >= 0)
+			{
+				TaskL->Deadline = NowL + TaskL->Period;
+			}
+			push(DueL[index]);
+		}
+	}
+}
+
+/** @brief Time to the next deadline.
+ *  @return unsigned long, Time [ms], zero if a task is due.
+ */
+unsigned long SchedulerClass::nextDeadline()
+{
+	if (m_heapCount == 0)
+	{
+		return SCHEDULER_MAX_IDLE;
+	}
+
+	long LeftL = (long)(m_tasks[m_heap[0]].Deadline - millis());
+
+	return (LeftL > 0) ? (unsigned long)LeftL : 0;
+}
+
+/** @brief Sleep until the next deadline, at most SCHEDULER_MAX_IDLE.
+ *  @return Void.
+ */
+void SchedulerClass::idle()
+{
+	unsigned long SleepL = nextDeadline();
+
+	if (SleepL == 0)
+	{
+		// Let the network stack run anyway.
+		yield();
+		return;
+	}
+
+	delay(min(SleepL, SCHEDULER_MAX_IDLE));
+}
+
+/** @brief Get task and its accounting.
+ *  @param id uint8_t, Task identifier.
+ *  @return const SchedulerTask_t*, Task or NULL if out of range.
+ */
+const SchedulerTask_t* SchedulerClass::get(uint8_t id)
+{
+	if (id >= m_count)
+	{
+		return NULL;
+	}
+
+	return &m_tasks[id];
+}
+
+/** @brief Count of the tasks.
+ *  @return uint8_t, Count.
+ */
+uint8_t SchedulerClass::count()
+{
+	return m_count;
+}
+
+/* @brief Singleton scheduler instance. */
+SchedulerClass Scheduler;
@@ -0,0 +1,210 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// Scheduler.h
+
+#ifndef _SCHEDULER_h
+#define _SCHEDULER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef SCHEDULER_MAX_TASKS
+/** @brief Maximum count of the tasks. */
+#define SCHEDULER_MAX_TASKS 12
+#endif // !SCHEDULER_MAX_TASKS
+
+#ifndef SCHEDULER_MAX_IDLE
+/** @brief Longest sleep between two loop passes [ms], the polled work waits no longer. */
+#define SCHEDULER_MAX_IDLE 1UL
+#endif // !SCHEDULER_MAX_IDLE
+
+/** @brief Invalid task identifier. */
+#define SCHEDULER_NO_TASK 0xFF
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Task priorities, due tasks run from the highest. */
+enum TaskPriority : uint8_t
+{
+	PriorityHigh = 0, ///< Bridging and connectivity.
+	PriorityNormal, ///< Telemetry.
+	PriorityLow, ///< Indication.
+};
+
+/** @brief Scheduled task. */
+typedef struct {
+	const char* Name; ///< Name for the logs.
+	void(*Run)(unsigned long now); ///< Work, gets the time of the pass [ms].
+	unsigned long Period; ///< Period [ms], zero for one-shot.
+	unsigned long Deadline; ///< Next run [ms].
+	uint8_t Priority; ///< Priority, TaskPriority.
+	bool Active; ///< Task is scheduled.
+	bool Queued; ///< Task is in the heap.
+	unsigned long Budget; ///< Allowed run time [us], zero for no limit.
+	unsigned long Runs; ///< Count of the runs.
+	unsigned long TotalTime; ///< Run time of all runs [us].
+	unsigned long MaxTime; ///< Longest run [us].
+	unsigned long Overruns; ///< Runs longer than the budget.
+} SchedulerTask_t;
+
+#pragma endregion
+
+/** @brief Cooperative task scheduler.
+ *
+ *  Deadlines are kept in a min-heap, so a pass only looks at the due
+ *  tasks. Due tasks run in priority order and their run time is
+ *  accounted against the budget. Work that has to be polled every pass,
+ *  like the serial bridge, stays in loop().
+ */
+class SchedulerClass
+{
+protected:
+
+	/** @brief Tasks storage. */
+	SchedulerTask_t m_tasks[SCHEDULER_MAX_TASKS];
+
+	/** @brief Count of the tasks. */
+	uint8_t m_count = 0;
+
+	/** @brief Heap of the active task identifiers, earliest deadline first. */
+	uint8_t m_heap[SCHEDULER_MAX_TASKS];
+
+	/** @brief Count of the heap items. */
+	uint8_t m_heapCount = 0;
+
+	/** @brief Compare the deadlines of two tasks, wrap safe.
+	 *  @param a uint8_t, Task identifier.
+	 *  @param b uint8_t, Task identifier.
+	 *  @return bool, True if a is before b.
+	 */
+	bool before(uint8_t a, uint8_t b);
+
+	/** @brief Push task to the heap.
+	 *  @param id uint8_t, Task identifier.
+	 *  @return Void.
+	 */
+	void push(uint8_t id);
+
+	/** @brief Pop the earliest task from the heap.
+	 *  @return uint8_t, Task identifier.
+	 */
+	uint8_t pop();
+
+	/** @brief Remove task from the heap, if it is there.
+	 *  @param id uint8_t, Task identifier.
+	 *  @return Void.
+	 */
+	void unlink(uint8_t id);
+
+	/** @brief Add task.
+	 *  @param name const char*, Name.
+	 *  @param delay unsigned long, Time to the first run [ms].
+	 *  @param period unsigned long, Period [ms], zero for one-shot.
+	 *  @param run Work.
+	 *  @param priority uint8_t, Priority.
+	 *  @param budget unsigned long, Allowed run time [us].
+	 *  @return uint8_t, Identifier or SCHEDULER_NO_TASK if the table is full.
+	 */
+	uint8_t add(const char* name, unsigned long delay, unsigned long period, void(*run)(unsigned long now), uint8_t priority, unsigned long budget);
+
+public:
+
+	/** @brief Add periodic task. The first run is at once.
+	 *  @param name const char*, Name.
+	 *  @param period unsigned long, Period [ms].
+	 *  @param run Work.
+	 *  @param priority uint8_t, Priority.
+	 *  @param budget unsigned long, Allowed run time [us], zero for no limit.
+	 *  @return uint8_t, Identifier or SCHEDULER_NO_TASK if the table is full.
+	 */
+	uint8_t every(const char* name, unsigned long period, void(*run)(unsigned long now), uint8_t priority = PriorityNormal, unsigned long budget = 0);
+
+	/** @brief Add one-shot task.
+	 *  @param name const char*, Name.
+	 *  @param delay unsigned long, Time to the run [ms].
+	 *  @param run Work.
+	 *  @param priority uint8_t, Priority.
+	 *  @param budget unsigned long, Allowed run time [us], zero for no limit.
+	 *  @return uint8_t, Identifier or SCHEDULER_NO_TASK if the table is full.
+	 */
+	uint8_t after(const char* name, unsigned long delay, void(*run)(unsigned long now), uint8_t priority = PriorityNormal, unsigned long budget = 0);
+
+	/** @brief Schedule the task again, one-shot tasks can be reused this way.
+	 *  @param id uint8_t, Task identifier.
+	 *  @param delay unsigned long, Time to the next run [ms].
+	 *  @return Void.
+	 */
+	void restart(uint8_t id, unsigned long delay);
+
+	/** @brief Stop the task.
+	 *  @param id uint8_t, Task identifier.
+	 *  @return Void.
+	 */
+	void cancel(uint8_t id);
+
+	/** @brief Run the due tasks. Call it from the main loop.
+	 *  @return Void.
+	 */
+	void update();
+
+	/** @brief Time to the next deadline.
+	 *  @return unsigned long, Time [ms], zero if a task is due.
+	 */
+	unsigned long nextDeadline();
+
+	/** @brief Sleep until the next deadline, at most SCHEDULER_MAX_IDLE.
+	 *  @return Void.
+	 */
+	void idle();
+
+	/** @brief Get task and its accounting.
+	 *  @param id uint8_t, Task identifier.
+	 *  @return const SchedulerTask_t*, Task or NULL if out of range.
+	 */
+	const SchedulerTask_t* get(uint8_t id);
+
+	/** @brief Count of the tasks.
+	 *  @return uint8_t, Count.
+	 */
+	uint8_t count();
+};
+
+/* @brief Singleton scheduler instance. */
+extern SchedulerClass Scheduler;
+
+#endif
+
@@ -0,0 +1,223 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "SerialIngest.h"
+
+/** @brief Move the available bytes from the port to the ring.
+ *  @return size_t, Count of the moved bytes.
+ */
+size_t SerialIngestClass::drain()
+{
+	size_t MovedL = 0;
+	size_t ChunkL = 0;
+	int AvailableL = m_port->available();
+
+	// Two passes at most, the second one after the write index wraps.
+	for (uint8_t pass = 0; (pass < 2) && (AvailableL > 0); pass++)
+	{
+		if (m_head >= m_tail)
+		{
+			ChunkL = SERIAL_INGEST_RING_SIZE - m_head;
+			if (m_tail == 0)
+			{
+				ChunkL--;
+			}
+		}
+		else
+		{
+			ChunkL = m_tail - m_head - 1;
+		}
+
+		if (ChunkL == 0)
+		{
+			break;
+		}
+
+		if (ChunkL > (size_t)AvailableL)
+		{
+			ChunkL = (size_t)AvailableL;
+		}
+
+		// Only what is already received is requested, so this does not wait.
+		ChunkL = m_port->readBytes((char*)&m_ring[m_head], ChunkL);
+		m_head = (m_head + ChunkL) % SERIAL_INGEST_RING_SIZE;
+		MovedL += ChunkL;
+		AvailableL -= ChunkL;
+	}
+
+	return MovedL;
+}
+
+/** @brief Pass the bytes from the ring to the frame buffer.
+ *  @return Void.
+ */
+void SerialIngestClass::assemble()
+{
+	uint8_t SymbolL;
+
+	while (m_tail != m_head)
+	{
+		SymbolL = m_ring[m_tail];
+		m_tail = (m_tail + 1) % SERIAL_INGEST_RING_SIZE;
+
+		if ((m_delimiter != SERIAL_FRAME_NO_DELIMITER) && (SymbolL == (uint8_t)m_delimiter))
+		{
+			emit();
+			continue;
+		}
+
+		m_frame[m_frameLength++] = (char)SymbolL;
+
+		if (m_frameLength >= SERIAL_FRAME_MAX_SIZE)
+		{
+			emit();
+		}
+	}
+}
+
+/** @brief Hand the frame to the callback and start a new one.
+ *  @return Void.
+ */
+void SerialIngestClass::emit()
+{
+	if (m_frameLength == 0)
+	{
+		return;
+	}
+
+	if (m_callbackFrame != nullptr)
+	{
+		m_callbackFrame(m_frame, m_frameLength);
+	}
+
+	m_frameLength = 0;
+}
+
+/** @brief Initialize the engine.
+ *  @param port Stream, Source port.
+ *  @return Void.
+ */
+void SerialIngestClass::init(Stream* port)
+{
+#ifdef SHOW_FUNC_NAMES
+	DEBUGLOG("\r\n");
+	DEBUGLOG(__PRETTY_FUNCTION__);
+	DEBUGLOG("\r\n");
+#endif // SHOW_FUNC_NAMES
+
+	m_port = port;
+	clear();
+}
+
+/** @brief Drain the port and emit the complete frames. Call it every loop pass.
+ *  @return Void.
+ */
+void SerialIngestClass::update()
+{
+	if (m_port == nullptr)
+	{
+		return;
+	}
+
+	if (drain() > 0)
+	{
+		m_lastByteTime = micros();
+		assemble();
+	}
+	else if ((m_frameLength > 0) && ((micros() - m_lastByteTime) >= m_idleGap))
+	{
+		// The line is silent long enough, close the frame.
+		emit();
+	}
+}
+
+/** @brief Emit the pending frame regardless of the framing rules.
+ *  @return Void.
+ */
+void SerialIngestClass::flush()
+{
+	assemble();
+	emit();
+}
+
+/** @brief Drop all buffered bytes.
+ *  @return Void.
+ */
+void SerialIngestClass::clear()
+{
+	m_head = 0;
+	m_tail = 0;
+	m_frameLength = 0;
+}
+
+/** @brief Set frame delimiter.
+ *  @param delimiter int, Delimiter character or SERIAL_FRAME_NO_DELIMITER.
+ *  @return Void.
+ */
+void SerialIngestClass::setDelimiter(int delimiter)
+{
+	m_delimiter = delimiter;
+}
+
+/** @brief Set idle gap that closes a frame.
+ *  @param time unsigned long, Time in microseconds.
+ *  @return Void.
+ */
+void SerialIngestClass::setIdleGap(unsigned long time)
+{
+	m_idleGap = time;
+}
+
+/** @brief Calculate the idle gap from the port baud rate.
+ *  @param baudrate unsigned long, Port baud rate.
+ *  @return Void.
+ */
+void SerialIngestClass::setBaudrate(unsigned long baudrate)
+{
+	if (baudrate == 0)
+	{
+		return;
+	}
+
+	// 10 bits per character: start, 8 data, stop.
+	m_idleGap = (SERIAL_FRAME_IDLE_CHARS * 10UL * 1000000UL) / baudrate;
+
+	if (m_idleGap < DEFAULT_SERIAL_FRAME_IDLE_GAP)
+	{
+		m_idleGap = DEFAULT_SERIAL_FRAME_IDLE_GAP;
+	}
+}
+
+/** @brief Set callback for complete frame.
+ *  @param callback, Callback function.
+ *  @return Void.
+ */
+void SerialIngestClass::setFrameCb(void(*callback)(const char* data, size_t length))
+{
+	m_callbackFrame = callback;
+}
+
+/* @brief Singleton serial ingest instance. */
+SerialIngestClass SerialIngest;
@@ -0,0 +1,169 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// SerialIngest.h
+
+#ifndef _SERIALINGEST_h
+#define _SERIALINGEST_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef SERIAL_INGEST_RING_SIZE
+/** @brief Size of the serial ingest ring buffer. */
+#define SERIAL_INGEST_RING_SIZE 1024
+#endif // !SERIAL_INGEST_RING_SIZE
+
+#ifndef SERIAL_FRAME_MAX_SIZE
+/** @brief Maximum length of one serial frame. */
+#define SERIAL_FRAME_MAX_SIZE 256
+#endif // !SERIAL_FRAME_MAX_SIZE
+
+#ifndef SERIAL_FRAME_IDLE_CHARS
+/** @brief Silence on the line, in characters, that closes a frame. */
+#define SERIAL_FRAME_IDLE_CHARS 4
+#endif // !SERIAL_FRAME_IDLE_CHARS
+
+/** @brief Disable delimiter framing. */
+#define SERIAL_FRAME_NO_DELIMITER -1
+
+#pragma endregion
+
+/** @brief Non-blocking serial ingest engine.
+ *
+ *  Drains the port in bulk into a ring buffer on every call of update()
+ *  and cuts the stream into frames by delimiter, by idle gap or when
+ *  the frame buffer is full. Never waits for incoming bytes.
+ */
+class SerialIngestClass
+{
+protected:
+
+	/** @brief Source port. */
+	Stream* m_port = nullptr;
+
+	/** @brief Ring buffer. */
+	uint8_t m_ring[SERIAL_INGEST_RING_SIZE];
+
+	/** @brief Ring write index. */
+	size_t m_head = 0;
+
+	/** @brief Ring read index. */
+	size_t m_tail = 0;
+
+	/** @brief Frame under construction. */
+	char m_frame[SERIAL_FRAME_MAX_SIZE];
+
+	/** @brief Length of the frame under construction. */
+	size_t m_frameLength = 0;
+
+	/** @brief Frame delimiter, SERIAL_FRAME_NO_DELIMITER to disable. */
+	int m_delimiter = DEFAULT_SERIAL_FRAME_DELIMITER;
+
+	/** @brief Idle gap that closes a frame [us]. */
+	unsigned long m_idleGap = DEFAULT_SERIAL_FRAME_IDLE_GAP;
+
+	/** @brief Time of the last received byte [us]. */
+	unsigned long m_lastByteTime = 0;
+
+	/** @brief Callback when frame is complete. */
+	void(*m_callbackFrame)(const char* data, size_t length) = nullptr;
+
+	/** @brief Move the available bytes from the port to the ring.
+	 *  @return size_t, Count of the moved bytes.
+	 */
+	size_t drain();
+
+	/** @brief Pass the bytes from the ring to the frame buffer.
+	 *  @return Void.
+	 */
+	void assemble();
+
+	/** @brief Hand the frame to the callback and start a new one.
+	 *  @return Void.
+	 */
+	void emit();
+
+public:
+
+	/** @brief Initialize the engine.
+	 *  @param port Stream, Source port.
+	 *  @return Void.
+	 */
+	void init(Stream* port);
+
+	/** @brief Drain the port and emit the complete frames. Call it every loop pass.
+	 *  @return Void.
+	 */
+	void update();
+
+	/** @brief Emit the pending frame regardless of the framing rules.
+	 *  @return Void.
+	 */
+	void flush();
+
+	/** @brief Drop all buffered bytes.
+	 *  @return Void.
+	 */
+	void clear();
+
+	/** @brief Set frame delimiter.
+	 *  @param delimiter int, Delimiter character or SERIAL_FRAME_NO_DELIMITER.
+	 *  @return Void.
+	 */
+	void setDelimiter(int delimiter);
+
+	/** @brief Set idle gap that closes a frame.
+	 *  @param time unsigned long, Time in microseconds.
+	 *  @return Void.
+	 */
+	void setIdleGap(unsigned long time);
+
+	/** @brief Calculate the idle gap from the port baud rate.
+	 *  @param baudrate unsigned long, Port baud rate.
+	 *  @return Void.
+	 */
+	void setBaudrate(unsigned long baudrate);
+
+	/** @brief Set callback for complete frame.
+	 *  @param callback, Callback function.
+	 *  @return Void.
+	 */
+	void setFrameCb(void(*callback)(const char* data, size_t length));
+};
+
+/* @brief Singleton serial ingest instance. */
+extern SerialIngestClass SerialIngest;
+
+#endif
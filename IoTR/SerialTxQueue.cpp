@@ -0,0 +1,232 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "SerialTxQueue.h"
+
+/** @brief Call the flow control callback when a watermark is crossed.
+ *  @return Void.
+ */
+void SerialTxQueueClass::checkWatermarks()
+{
+	enter();
+
+	bool PausedL = m_paused;
+
+	if (!m_paused && m_depth >= SERIAL_TX_HIGH_WATERMARK)
+	{
+		PausedL = true;
+	}
+	else if (m_paused && m_depth <= SERIAL_TX_LOW_WATERMARK)
+	{
+		PausedL = false;
+	}
+
+	bool ChangedL = (PausedL != m_paused);
+	m_paused = PausedL;
+
+	leave();
+
+	// The callback publishes, so it runs outside of the critical section.
+	if (ChangedL && (m_callbackFlow != nullptr))
+	{
+		m_callbackFlow(PausedL);
+	}
+}
+
+/** @brief Set the target port.
+ *  @param port HardwareSerial*, Target port.
+ *  @return Void.
+ */
+void SerialTxQueueClass::init(HardwareSerial* port)
+{
+#ifdef SHOW_FUNC_NAMES
+	DEBUGLOG("\r\n");
+	DEBUGLOG(__PRETTY_FUNCTION__);
+	DEBUGLOG("\r\n");
+#endif // SHOW_FUNC_NAMES
+
+	m_port = port;
+	clear();
+}
+
+/** @brief Drain the queue in the port without blocking.
+ *  @return Void.
+ */
+void SerialTxQueueClass::update()
+{
+	if (m_port == nullptr)
+	{
+		return;
+	}
+
+	// Only the loop moves the read index, so the queued bytes stay put while they are written.
+	enter();
+	size_t TailL = m_tail;
+	size_t DepthL = m_depth;
+	leave();
+
+	if (DepthL == 0)
+	{
+		return;
+	}
+
+	int FreeL = m_port->availableForWrite();
+
+	// At most two writes, the ring may wrap.
+	while (FreeL > 0 && DepthL > 0)
+	{
+		size_t ChunkL = SERIAL_TX_QUEUE_SIZE - TailL;
+
+		if (ChunkL > DepthL)
+		{
+			ChunkL = DepthL;
+		}
+
+		if (ChunkL > (size_t)FreeL)
+		{
+			ChunkL = FreeL;
+		}
+
+		ChunkL = m_port->write(m_ring + TailL, ChunkL);
+
+		if (ChunkL == 0)
+		{
+			break;
+		}
+
+		TailL = (TailL + ChunkL) % SERIAL_TX_QUEUE_SIZE;
+		DepthL -= ChunkL;
+		FreeL -= ChunkL;
+
+		enter();
+		m_tail = TailL;
+		m_depth -= ChunkL;
+		leave();
+	}
+
+	checkWatermarks();
+}
+
+/** @brief Queue data for transmit. Data that does not fit is dropped as whole.
+ *  @param data const uint8_t*, Data.
+ *  @param length size_t, Data length.
+ *  @return bool, True if queued.
+ */
+bool SerialTxQueueClass::push(const uint8_t* data, size_t length)
+{
+	enter();
+
+	// Partial command is worse than no command.
+	if (length > SERIAL_TX_QUEUE_SIZE - m_depth)
+	{
+		m_dropped += length;
+		m_dropFlag = true;
+		leave();
+		return false;
+	}
+
+	size_t ChunkL = SERIAL_TX_QUEUE_SIZE - m_head;
+
+	if (ChunkL > length)
+	{
+		ChunkL = length;
+	}
+
+	// The loop does not read the free part of the ring, the copy is short enough for the section.
+	memcpy(m_ring + m_head, data, ChunkL);
+	memcpy(m_ring, data + ChunkL, length - ChunkL);
+
+	m_head = (m_head + length) % SERIAL_TX_QUEUE_SIZE;
+	m_depth += length;
+
+	leave();
+
+	checkWatermarks();
+
+	return true;
+}
+
+/** @brief Drop the queued data. Call it from the loop only.
+ *  @return Void.
+ */
+void SerialTxQueueClass::clear()
+{
+	enter();
+	m_head = 0;
+	m_tail = 0;
+	m_depth = 0;
+	leave();
+
+	checkWatermarks();
+}
+
+/** @brief Count of the queued bytes.
+ *  @return size_t, Queue depth.
+ */
+size_t SerialTxQueueClass::depth()
+{
+	return m_depth;
+}
+
+/** @brief Count of the dropped bytes.
+ *  @return unsigned long, Dropped bytes.
+ */
+unsigned long SerialTxQueueClass::getDropped()
+{
+	return m_dropped;
+}
+
+/** @brief Bytes were dropped since the last call.
+ *  @return bool, True if there were drops.
+ */
+bool SerialTxQueueClass::takeDropFlag()
+{
+	enter();
+	bool FlagL = m_dropFlag;
+	m_dropFlag = false;
+	leave();
+
+	return FlagL;
+}
+
+/** @brief Sender is asked to pause.
+ *  @return bool, True if paused.
+ */
+bool SerialTxQueueClass::paused()
+{
+	return m_paused;
+}
+
+/** @brief Set callback on flow control change.
+ *  @param callback void(*)(bool), Callback receiving the paused state.
+ *  @return Void.
+ */
+void SerialTxQueueClass::setFlowCb(void(*callback)(bool paused))
+{
+	m_callbackFlow = callback;
+}
+
+/* @brief Singleton serial transmit queue instance. */
+SerialTxQueueClass SerialTxQueue;
@@ -0,0 +1,187 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// SerialTxQueue.h
+
+#ifndef _SERIALTXQUEUE_h
+#define _SERIALTXQUEUE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef SERIAL_TX_QUEUE_SIZE
+/** @brief Size of the transmit queue. */
+#define SERIAL_TX_QUEUE_SIZE 2048
+#endif // !SERIAL_TX_QUEUE_SIZE
+
+#ifndef SERIAL_TX_HIGH_WATERMARK
+/** @brief Queue depth that pauses the sender. */
+#define SERIAL_TX_HIGH_WATERMARK (SERIAL_TX_QUEUE_SIZE * 3 / 4)
+#endif // !SERIAL_TX_HIGH_WATERMARK
+
+#ifndef SERIAL_TX_LOW_WATERMARK
+/** @brief Queue depth that resumes the sender. */
+#define SERIAL_TX_LOW_WATERMARK (SERIAL_TX_QUEUE_SIZE / 4)
+#endif // !SERIAL_TX_LOW_WATERMARK
+
+#pragma endregion
+
+/** @brief Serial transmit queue.
+ *
+ *  Network callbacks only copy data in the queue. The queue is drained from
+ *  the main loop with bulk writes of what the UART can take without blocking.
+ *  The indexes are shared between the two contexts and change only in a
+ *  critical section, the port write and the callbacks run outside of it.
+ */
+class SerialTxQueueClass
+{
+protected:
+
+	/** @brief Target port. */
+	HardwareSerial* m_port = nullptr;
+
+	/** @brief Ring buffer. */
+	uint8_t m_ring[SERIAL_TX_QUEUE_SIZE];
+
+	/** @brief Write index. */
+	size_t m_head = 0;
+
+	/** @brief Read index. */
+	size_t m_tail = 0;
+
+	/** @brief Count of the queued bytes. */
+	size_t m_depth = 0;
+
+	/** @brief Count of the dropped bytes. */
+	unsigned long m_dropped = 0;
+
+	/** @brief Bytes were dropped since the last check. */
+	bool m_dropFlag = false;
+
+	/** @brief Sender is asked to pause. */
+	bool m_paused = false;
+
+	/** @brief Callback on flow control change. */
+	void(*m_callbackFlow)(bool paused) = nullptr;
+
+#ifdef ESP32
+	/** @brief Guard of the indexes, AsyncTCP runs in its own task. */
+	portMUX_TYPE m_mux = portMUX_INITIALIZER_UNLOCKED;
+#endif // ESP32
+
+	/** @brief Enter the critical section.
+	 *  @return Void.
+	 */
+	inline void enter()
+	{
+#ifdef ESP32
+		portENTER_CRITICAL(&m_mux);
+#else
+		noInterrupts();
+#endif // ESP32
+	}
+
+	/** @brief Leave the critical section.
+	 *  @return Void.
+	 */
+	inline void leave()
+	{
+#ifdef ESP32
+		portEXIT_CRITICAL(&m_mux);
+#else
+		interrupts();
+#endif // ESP32
+	}
+
+	/** @brief Call the flow control callback when a watermark is crossed.
+	 *  @return Void.
+	 */
+	void checkWatermarks();
+
+public:
+
+	/** @brief Set the target port.
+	 *  @param port HardwareSerial*, Target port.
+	 *  @return Void.
+	 */
+	void init(HardwareSerial* port);
+
+	/** @brief Drain the queue in the port without blocking.
+	 *  @return Void.
+	 */
+	void update();
+
+	/** @brief Queue data for transmit. Data that does not fit is dropped as whole.
+	 *  @param data const uint8_t*, Data.
+	 *  @param length size_t, Data length.
+	 *  @return bool, True if queued.
+	 */
+	bool push(const uint8_t* data, size_t length);
+
+	/** @brief Drop the queued data. Call it from the loop only.
+	 *  @return Void.
+	 */
+	void clear();
+
+	/** @brief Count of the queued bytes.
+	 *  @return size_t, Queue depth.
+	 */
+	size_t depth();
+
+	/** @brief Count of the dropped bytes.
+	 *  @return unsigned long, Dropped bytes.
+	 */
+	unsigned long getDropped();
+
+	/** @brief Bytes were dropped since the last call.
+	 *  @return bool, True if there were drops.
+	 */
+	bool takeDropFlag();
+
+	/** @brief Sender is asked to pause.
+	 *  @return bool, True if paused.
+	 */
+	bool paused();
+
+	/** @brief Set callback on flow control change.
+	 *  @param callback void(*)(bool), Callback receiving the paused state.
+	 *  @return Void.
+	 */
+	void setFlowCb(void(*callback)(bool paused));
+};
+
+/* @brief Singleton serial transmit queue instance. */
+extern SerialTxQueueClass SerialTxQueue;
+
+#endif
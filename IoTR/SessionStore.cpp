@@ -0,0 +1,248 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "SessionStore.h"
+
+#ifdef ESP32
+#include <esp_system.h>
+#endif
+
+/** @brief Constructor.
+ *  @return SessionStoreClass
+ */
+SessionStoreClass::SessionStoreClass()
+{
+	for (uint8_t index = 0; index < SESSION_MAX_COUNT; index++)
+	{
+		m_sessions[index].Token[0] = '\0';
+		m_sessions[index].LastSeen = 0;
+	}
+}
+
+/** @brief Check if the slot holds a live session.
+ *  @param session Session_t*, Slot.
+ *  @param now unsigned long, Current time [ms].
+ *  @return bool, True if used and not expired.
+ */
+bool SessionStoreClass::isAlive(const Session_t* session, unsigned long now)
+{
+	if (session->Token[0] == '\0')
+	{
+		return false;
+	}
+
+	return (now - session->LastSeen) <= (ALIVE_TIME * 1000UL);
+}
+
+/** @brief Compare the token with the slot in constant time.
+ *  @param session Session_t*, Slot.
+ *  @param token const char*, Token of SESSION_TOKEN_LENGTH characters.
+ *  @return bool, True if equal.
+ */
+bool SessionStoreClass::tokenEquals(const Session_t* session, const char* token)
+{
+	// Every byte is compared, the time does not tell where it differs.
+	uint8_t DiffL = 0;
+	for (uint8_t index = 0; index < SESSION_TOKEN_LENGTH; index++)
+	{
+		DiffL |= (uint8_t)(session->Token[index] ^ token[index]);
+	}
+
+	// Free slots are empty strings and never match a full token.
+	DiffL |= (uint8_t)(session->Token[0] == '\0');
+
+	return DiffL == 0;
+}
+
+/** @brief Fill the buffer with random hex characters.
+ *  @param token char*, Buffer of SESSION_TOKEN_LENGTH + 1 bytes.
+ *  @return Void.
+ */
+void SessionStoreClass::generate(char* token)
+{
+	static const char HexL[] = "0123456789abcdef";
+
+	uint32_t RandomL = 0;
+	for (uint8_t index = 0; index < SESSION_TOKEN_BYTES; index++)
+	{
+		if ((index % 4) == 0)
+		{
+			// Hardware RNG, it is random enough while the radio is on.
+#ifdef ESP32
+			RandomL = esp_random();
+#elif defined(ESP8266)
+			RandomL = RANDOM_REG32;
+#endif
+		}
+
+		token[index * 2] = HexL[(RandomL >> 4) & 0x0F];
+		token[index * 2 + 1] = HexL[RandomL & 0x0F];
+		RandomL >>= 8;
+	}
+
+	token[SESSION_TOKEN_LENGTH] = '\0';
+}
+
+/** @brief Open new session.
+ *  @return const char*, Token of the session.
+ */
+const char* SessionStoreClass::create()
+{
+	unsigned long NowL = millis();
+
+	// Take a free or expired slot, else drop the least recently used.
+	Session_t* SessionL = &m_sessions[0];
+	for (uint8_t index = 0; index < SESSION_MAX_COUNT; index++)
+	{
+		if (!isAlive(&m_sessions[index], NowL))
+		{
+			SessionL = &m_sessions[index];
+			break;
+		}
+
+		if ((NowL - m_sessions[index].LastSeen) > (NowL - SessionL->LastSeen))
+		{
+			SessionL = &m_sessions[index];
+		}
+	}
+
+	generate(SessionL->Token);
+	SessionL->LastSeen = NowL;
+
+	return SessionL->Token;
+}
+
+/** @brief Validate the token and refresh its session.
+ *  @param token const char*, Token from the cookie.
+ *  @return bool, True if the session is alive.
+ */
+bool SessionStoreClass::validate(const char* token)
+{
+	if (strlen(token) != SESSION_TOKEN_LENGTH)
+	{
+		return false;
+	}
+
+	unsigned long NowL = millis();
+	Session_t* SessionL = nullptr;
+
+	// Walk all slots, so the time does not tell which one matched.
+	for (uint8_t index = 0; index < SESSION_MAX_COUNT; index++)
+	{
+		if (tokenEquals(&m_sessions[index], token))
+		{
+			SessionL = &m_sessions[index];
+		}
+	}
+
+	if (SessionL == nullptr)
+	{
+		return false;
+	}
+
+	if (!isAlive(SessionL, NowL))
+	{
+		SessionL->Token[0] = '\0';
+		return false;
+	}
+
+	SessionL->LastSeen = NowL;
+
+	return true;
+}
+
+/** @brief Close the session of the token.
+ *  @param token const char*, Token from the cookie.
+ *  @return Void.
+ */
+void SessionStoreClass::remove(const char* token)
+{
+	if (strlen(token) != SESSION_TOKEN_LENGTH)
+	{
+		return;
+	}
+
+	for (uint8_t index = 0; index < SESSION_MAX_COUNT; index++)
+	{
+		if (tokenEquals(&m_sessions[index], token))
+		{
+			m_sessions[index].Token[0] = '\0';
+		}
+	}
+}
+
+/** @brief Find a cookie value in a Cookie header.
+ *  @param header const char*, Content of the Cookie header.
+ *  @param name const char*, Name of the cookie.
+ *  @param value char*, Output buffer.
+ *  @param size size_t, Size of the output buffer.
+ *  @return bool, True if the cookie was found and fits.
+ */
+bool SessionStoreClass::parseCookie(const char* header, const char* name, char* value, size_t size)
+{
+	size_t NameLengthL = strlen(name);
+	const char* PairL = header;
+
+	// Pairs are "name=value" separated by "; ".
+	while (*PairL != '\0')
+	{
+		while (*PairL == ' ' || *PairL == ';')
+		{
+			PairL++;
+		}
+
+		const char* EndL = strchr(PairL, ';');
+		if (EndL == nullptr)
+		{
+			EndL = PairL + strlen(PairL);
+		}
+
+		if ((strncmp(PairL, name, NameLengthL) == 0) && (PairL[NameLengthL] == '='))
+		{
+			const char* ValueL = PairL + NameLengthL + 1;
+			size_t LengthL = EndL - ValueL;
+
+			// Trailing spaces are not part of the value.
+			while ((LengthL > 0) && (ValueL[LengthL - 1] == ' '))
+			{
+				LengthL--;
+			}
+
+			if (LengthL >= size)
+			{
+				return false;
+			}
+
+			memcpy(value, ValueL, LengthL);
+			value[LengthL] = '\0';
+
+			return true;
+		}
+
+		PairL = EndL;
+	}
+
+	return false;
+}
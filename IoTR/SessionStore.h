@@ -0,0 +1,140 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// SessionStore.h
+
+#ifndef _SESSIONSTORE_h
+#define _SESSIONSTORE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef SESSION_MAX_COUNT
+/** @brief Maximum count of the simultaneous sessions, the least recently used is dropped above it. */
+#define SESSION_MAX_COUNT 4
+#endif // !SESSION_MAX_COUNT
+
+#ifndef SESSION_TOKEN_BYTES
+/** @brief Random bytes of the token, it is sent as hex. */
+#define SESSION_TOKEN_BYTES 16
+#endif // !SESSION_TOKEN_BYTES
+
+/** @brief Length of the token text. */
+#define SESSION_TOKEN_LENGTH (SESSION_TOKEN_BYTES * 2)
+
+#ifndef SESSION_COOKIE_NAME
+/** @brief Name of the session cookie. */
+#define SESSION_COOKIE_NAME "IOTRSESSION"
+#endif // !SESSION_COOKIE_NAME
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Session slot. */
+typedef struct {
+	char Token[SESSION_TOKEN_LENGTH + 1]; ///< Hex token, empty when the slot is free.
+	unsigned long LastSeen; ///< Time of the last valid request [ms].
+} Session_t;
+
+#pragma endregion
+
+/** @brief Fixed size table of the logged in sessions.
+ *
+ *  Every login gets its own random token, so several operators stay
+ *  logged in at once. Sessions expire after ALIVE_TIME without a request.
+ */
+class SessionStoreClass
+{
+protected:
+
+	/** @brief Sessions storage. */
+	Session_t m_sessions[SESSION_MAX_COUNT];
+
+	/** @brief Check if the slot holds a live session.
+	 *  @param session Session_t*, Slot.
+	 *  @param now unsigned long, Current time [ms].
+	 *  @return bool, True if used and not expired.
+	 */
+	bool isAlive(const Session_t* session, unsigned long now);
+
+	/** @brief Compare the token with the slot in constant time.
+	 *  @param session Session_t*, Slot.
+	 *  @param token const char*, Token of SESSION_TOKEN_LENGTH characters.
+	 *  @return bool, True if equal.
+	 */
+	static bool tokenEquals(const Session_t* session, const char* token);
+
+	/** @brief Fill the buffer with random hex characters.
+	 *  @param token char*, Buffer of SESSION_TOKEN_LENGTH + 1 bytes.
+	 *  @return Void.
+	 */
+	static void generate(char* token);
+
+public:
+
+	/** @brief Constructor.
+	 *  @return SessionStoreClass
+	 */
+	SessionStoreClass();
+
+	/** @brief Open new session.
+	 *  @return const char*, Token of the session.
+	 */
+	const char* create();
+
+	/** @brief Validate the token and refresh its session.
+	 *  @param token const char*, Token from the cookie.
+	 *  @return bool, True if the session is alive.
+	 */
+	bool validate(const char* token);
+
+	/** @brief Close the session of the token.
+	 *  @param token const char*, Token from the cookie.
+	 *  @return Void.
+	 */
+	void remove(const char* token);
+
+	/** @brief Find a cookie value in a Cookie header.
+	 *  @param header const char*, Content of the Cookie header.
+	 *  @param name const char*, Name of the cookie.
+	 *  @param value char*, Output buffer.
+	 *  @param size size_t, Size of the output buffer.
+	 *  @return bool, True if the cookie was found and fits.
+	 */
+	static bool parseCookie(const char* header, const char* name, char* value, size_t size);
+};
+
+#endif
+
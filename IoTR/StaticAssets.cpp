@@ -0,0 +1,69 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "StaticAssets.h"
+
+#ifdef USE_PROGMEM_FS
+
+/** @brief Assets table generated by the pager, sorted by path. */
+static const StaticAsset_t StaticAssets_g[BZF_ASSETS_COUNT] = {
+	BZF_ASSETS_TABLE
+};
+
+#endif // USE_PROGMEM_FS
+
+/** @brief Find static asset by path.
+ *  @param path const char*, Request path.
+ *  @return const StaticAsset_t*, Asset or NULL if not found.
+ */
+const StaticAsset_t* find_static_asset(const char* path)
+{
+#ifdef USE_PROGMEM_FS
+	int LowL = 0;
+	int HighL = BZF_ASSETS_COUNT - 1;
+
+	while (LowL <= HighL)
+	{
+		int MiddleL = (LowL + HighL) / 2;
+		int CompareL = strcmp(path, StaticAssets_g[MiddleL].Path);
+
+		if (CompareL == 0)
+		{
+			return &StaticAssets_g[MiddleL];
+		}
+
+		if (CompareL < 0)
+		{
+			HighL = MiddleL - 1;
+		}
+		else
+		{
+			LowL = MiddleL + 1;
+		}
+	}
+#endif // USE_PROGMEM_FS
+
+	return NULL;
+}
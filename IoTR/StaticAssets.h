@@ -0,0 +1,66 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// StaticAssets.h
+
+#ifndef _STATICASSETS_h
+#define _STATICASSETS_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#ifdef USE_PROGMEM_FS
+#include "pages\bzf_assets.h"
+#endif // USE_PROGMEM_FS
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Compressed static asset stored in PROGMEM. */
+typedef struct {
+	const char* Path; ///< Request path.
+	const char* MimeType; ///< Content type.
+	const uint8_t* Data; ///< Gzip content in PROGMEM.
+	size_t Size; ///< Content size.
+	uint32_t Hash; ///< Content hash.
+} StaticAsset_t;
+
+#pragma endregion
+
+#pragma region Prototypes
+
+/** @brief Find static asset by path.
+ *  @param path const char*, Request path.
+ *  @return const StaticAsset_t*, Asset or NULL if not found.
+ */
+const StaticAsset_t* find_static_asset(const char* path);
+
+#pragma endregion
+
+#endif
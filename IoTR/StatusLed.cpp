@@ -32,56 +32,50 @@ void StatusLedClass::init(uint8_t pin) {
 	DEBUGLOG("\r\n");
 #endif // SHOW_FUNC_NAMES
 
-	m_animationTimer = FxTimer();
-	m_animationTimer.setExpirationTime(50);
-
 	m_pixels = Adafruit_NeoPixel(1, pin, NEO_RGB + NEO_KHZ800);
 	m_pixels.begin();
 
 }
 
+/** @brief Show the next animation frame. Call it every STATUS_LED_FRAME_TIME.
+ *  @return Void.
+ */
 void StatusLedClass::update()
 {
 	static uint8_t FadeValueL = 0;
 	static bool FadeDirectionL = false;
 
-	m_animationTimer.update();
-	if (m_animationTimer.expired())
+	if (FadeDirectionL == false)
 	{
-		m_animationTimer.clear();
-
-		if (FadeDirectionL == false)
-		{
-			FadeValueL++;
-			if (FadeValueL > 33)
-			{
-				FadeDirectionL = true;
-			}
-		}
-		else
-		{
-			FadeValueL--;
-			if (FadeValueL < 1)
-			{
-				FadeDirectionL = false;
-			}
-		}
-
-		if (m_animationType == AnimationType::Red)
-		{
-			m_pixels.setPixelColor(0, m_pixels.Color(FadeValueL, 0, 0));
-		}
-		else if (m_animationType == AnimationType::Green)
+		FadeValueL++;
+		if (FadeValueL > 33)
 		{
-			m_pixels.setPixelColor(0, m_pixels.Color(0, FadeValueL, 0));
+			FadeDirectionL = true;
 		}
-		else if (m_animationType == AnimationType::Blue)
+	}
+	else
+	{
+		FadeValueL--;
+		if (FadeValueL < 1)
 		{
-			m_pixels.setPixelColor(0, m_pixels.Color(0, 0, FadeValueL));
+			FadeDirectionL = false;
 		}
+	}
 
-		m_pixels.show();
+	if (m_animationType == AnimationType::Red)
+	{
+		m_pixels.setPixelColor(0, m_pixels.Color(FadeValueL, 0, 0));
 	}
+	else if (m_animationType == AnimationType::Green)
+	{
+		m_pixels.setPixelColor(0, m_pixels.Color(0, FadeValueL, 0));
+	}
+	else if (m_animationType == AnimationType::Blue)
+	{
+		m_pixels.setPixelColor(0, m_pixels.Color(0, 0, FadeValueL));
+	}
+
+	m_pixels.show();
 }
 
 void StatusLedClass::setAnumation(int animationType) {
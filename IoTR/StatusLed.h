@@ -38,10 +38,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <Adafruit_NeoPixel.h>
 
-#include "FxTimer.h"
-
 #pragma endregion
 
+#ifndef STATUS_LED_FRAME_TIME
+/** @brief Animation frame time [ms]. */
+#define STATUS_LED_FRAME_TIME 50UL
+#endif // !STATUS_LED_FRAME_TIME
+
 /** @brief Frame indexes byte. */
 enum AnimationType : int
 {
@@ -54,7 +57,6 @@ class StatusLedClass
 {
  protected:
 	 Adafruit_NeoPixel m_pixels;
-	 FxTimer m_animationTimer;
 	 int m_animationType;
 
  public:
@@ -0,0 +1,201 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "TelemetryBatch.h"
+
+/** @brief Set byte budget of one payload, pending batch is flushed on change.
+ *  @param budget size_t, Budget in bytes, clamped to MQTT_BATCH_MIN_SIZE and MQTT_BATCH_MAX_SIZE.
+ *  @return Void.
+ */
+void TelemetryBatchClass::setBudget(size_t budget)
+{
+	if (budget < MQTT_BATCH_MIN_SIZE)
+	{
+		budget = MQTT_BATCH_MIN_SIZE;
+	}
+
+	if (budget > MQTT_BATCH_MAX_SIZE)
+	{
+		budget = MQTT_BATCH_MAX_SIZE;
+	}
+
+	if (budget == m_budget)
+	{
+		return;
+	}
+
+	// Apply the new budget to the next payload.
+	flush();
+	m_budget = budget;
+}
+
+/** @brief Set flush interval.
+ *  @param interval unsigned long, Interval in milliseconds.
+ *  @return Void.
+ */
+void TelemetryBatchClass::setInterval(unsigned long interval)
+{
+	m_flushTimer.setExpirationTime(interval);
+}
+
+/** @brief Set encoding of the frames, pending batch is flushed on change.
+ *  @param encoding uint8_t, MQTT_ENCODING_JSON or MQTT_ENCODING_MSGPACK.
+ *  @return Void.
+ */
+void TelemetryBatchClass::setEncoding(uint8_t encoding)
+{
+	if (encoding == m_encoding)
+	{
+		return;
+	}
+
+	flush();
+	m_encoding = encoding;
+}
+
+/** @brief Set callback for flushed payload.
+ *  @param callback, Callback function.
+ *  @return Void.
+ */
+void TelemetryBatchClass::setFlushCb(void(*callback)(const char* payload, size_t length))
+{
+	m_callbackFlush = callback;
+}
+
+/** @brief Add serialized frame to the batch.
+ *  @param item const char*, Serialized frame.
+ *  @param length size_t, Length of the frame.
+ *  @return Void.
+ */
+void TelemetryBatchClass::append(const char* item, size_t length)
+{
+	// JSON needs separator and closing bracket, MessagePack the array header.
+	size_t OverheadL = (m_encoding == MQTT_ENCODING_MSGPACK) ? MSGPACK_ARRAY16_SIZE : 2;
+
+	if ((m_length + length + OverheadL) > m_budget)
+	{
+		flush();
+	}
+
+	// Larger than the whole budget, it can not be batched.
+	if ((length + OverheadL) > m_budget)
+	{
+		DEBUGLOG("Frame does not fit in the batch.\r\n");
+		return;
+	}
+
+	if (m_count == 0)
+	{
+		if (m_encoding == MQTT_ENCODING_MSGPACK)
+		{
+			// The count is filled on flush.
+			m_buffer[m_length++] = (char)MSGPACK_ARRAY16;
+			m_buffer[m_length++] = 0;
+			m_buffer[m_length++] = 0;
+		}
+		else
+		{
+			m_buffer[m_length++] = '[';
+		}
+
+		// The interval is measured from the first frame of the batch.
+		m_flushTimer.updateLastTime();
+		m_flushTimer.clear();
+	}
+	else if (m_encoding == MQTT_ENCODING_JSON)
+	{
+		m_buffer[m_length++] = ',';
+	}
+
+	memcpy(&m_buffer[m_length], item, length);
+	m_length += length;
+	m_count++;
+}
+
+/** @brief Flush the batch if the interval expired. Call it every loop pass.
+ *  @return Void.
+ */
+void TelemetryBatchClass::update()
+{
+	if (m_count == 0)
+	{
+		return;
+	}
+
+	m_flushTimer.update();
+	if (m_flushTimer.expired())
+	{
+		m_flushTimer.clear();
+		flush();
+	}
+}
+
+/** @brief Flush the batch now.
+ *  @return Void.
+ */
+void TelemetryBatchClass::flush()
+{
+	if (m_count == 0)
+	{
+		return;
+	}
+
+	if (m_encoding == MQTT_ENCODING_MSGPACK)
+	{
+		m_buffer[1] = (char)(m_count >> 8);
+		m_buffer[2] = (char)(m_count & 0xFF);
+	}
+	else
+	{
+		m_buffer[m_length++] = ']';
+	}
+
+	if (m_callbackFlush != nullptr)
+	{
+		m_callbackFlush(m_buffer, m_length);
+	}
+
+	clear();
+}
+
+/** @brief Drop the batch without flushing.
+ *  @return Void.
+ */
+void TelemetryBatchClass::clear()
+{
+	m_length = 0;
+	m_count = 0;
+}
+
+/** @brief Count of the frames waiting in the batch.
+ *  @return uint16_t, Frames count.
+ */
+uint16_t TelemetryBatchClass::count()
+{
+	return m_count;
+}
+
+/* @brief Singleton telemetry batch instance. */
+TelemetryBatchClass TelemetryBatch;
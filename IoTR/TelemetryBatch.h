@@ -0,0 +1,148 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// TelemetryBatch.h
+
+#ifndef _TELEMETRYBATCH_h
+#define _TELEMETRYBATCH_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#include "FxTimer.h"
+
+#include "FramePool.h"
+
+#include "MsgPack.h"
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef MQTT_BATCH_MAX_SIZE
+/** @brief Size of the batch buffer, upper limit of the byte budget. */
+#define MQTT_BATCH_MAX_SIZE 2048
+#endif // !MQTT_BATCH_MAX_SIZE
+
+/** @brief Lower limit of the byte budget, one full frame and the array framing. */
+#define MQTT_BATCH_MIN_SIZE (SERIAL_FRAME_PAYLOAD_SIZE + MSGPACK_ARRAY16_SIZE)
+
+#pragma endregion
+
+/** @brief Telemetry batch.
+ *
+ *  Joins serialized frames in one JSON or MessagePack array payload, the
+ *  frames must be in the same encoding. The payload is flushed
+ *  when the next frame does not fit in the byte budget or when the flush
+ *  interval since the first frame of the batch expires.
+ */
+class TelemetryBatchClass
+{
+protected:
+
+	/** @brief Payload buffer. */
+	char m_buffer[MQTT_BATCH_MAX_SIZE];
+
+	/** @brief Payload length. */
+	size_t m_length = 0;
+
+	/** @brief Count of the frames in the payload. */
+	uint16_t m_count = 0;
+
+	/** @brief Byte budget of one payload. */
+	size_t m_budget = MQTT_BATCH_MAX_SIZE;
+
+	/** @brief Payload encoding. */
+	uint8_t m_encoding = MQTT_ENCODING_JSON;
+
+	/** @brief Flush interval timer. */
+	FxTimer m_flushTimer;
+
+	/** @brief Callback when the payload is flushed. */
+	void(*m_callbackFlush)(const char* payload, size_t length) = nullptr;
+
+public:
+
+	/** @brief Set byte budget of one payload, pending batch is flushed on change.
+	 *  @param budget size_t, Budget in bytes, clamped to MQTT_BATCH_MIN_SIZE and MQTT_BATCH_MAX_SIZE.
+	 *  @return Void.
+	 */
+	void setBudget(size_t budget);
+
+	/** @brief Set flush interval.
+	 *  @param interval unsigned long, Interval in milliseconds.
+	 *  @return Void.
+	 */
+	void setInterval(unsigned long interval);
+
+	/** @brief Set encoding of the frames, pending batch is flushed on change.
+	 *  @param encoding uint8_t, MQTT_ENCODING_JSON or MQTT_ENCODING_MSGPACK.
+	 *  @return Void.
+	 */
+	void setEncoding(uint8_t encoding);
+
+	/** @brief Set callback for flushed payload.
+	 *  @param callback, Callback function.
+	 *  @return Void.
+	 */
+	void setFlushCb(void(*callback)(const char* payload, size_t length));
+
+	/** @brief Add serialized frame to the batch.
+	 *  @param item const char*, Serialized frame.
+	 *  @param length size_t, Length of the frame.
+	 *  @return Void.
+	 */
+	void append(const char* item, size_t length);
+
+	/** @brief Flush the batch if the interval expired. Call it every loop pass.
+	 *  @return Void.
+	 */
+	void update();
+
+	/** @brief Flush the batch now.
+	 *  @return Void.
+	 */
+	void flush();
+
+	/** @brief Drop the batch without flushing.
+	 *  @return Void.
+	 */
+	void clear();
+
+	/** @brief Count of the frames waiting in the batch.
+	 *  @return uint16_t, Frames count.
+	 */
+	uint16_t count();
+};
+
+/* @brief Singleton telemetry batch instance. */
+extern TelemetryBatchClass TelemetryBatch;
+
+#endif
@@ -37,6 +37,59 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 /* @brief Singleton base WEB server instance. */
 //WEBServer LocalWEBServer(WEB_SERVER_PORT);
 
+/* @brief Settings page fields, also the general configuration API. */
+static const ConfigField_t DeviceFields_g[] = {
+	CONFIG_TEXT("user", DeviceConfiguration.Username, 0, "input"),
+	CONFIG_TEXT("password", DeviceConfiguration.Password, CONFIG_KEEP_EMPTY | CONFIG_HIDDEN, "input"),
+	CONFIG_INT("baudrate", DeviceConfiguration.PortBaudrate, 300, 2000000, "select"),
+	CONFIG_TEXT("ntp-domain", DeviceConfiguration.NTPDomain, 0, "input"),
+	CONFIG_SCALED("ntp-tz", DeviceConfiguration.NTPTimezone, -12, 14, SECS_IN_HOUR, "select"),
+	CONFIG_INT("acativation-code", DeviceConfiguration.ActivationCode, 0, INT_MAX, "input"),
+};
+
+/* @brief Network page fields, also the network configuration API. */
+static const ConfigField_t NetworkFields_g[] = {
+	CONFIG_TEXT("hostname", NetworkConfiguration.Hostname, 0, "input"),
+	CONFIG_TEXT("ssid", NetworkConfiguration.SSID, 0, "input"),
+	CONFIG_TEXT("password", NetworkConfiguration.Password, CONFIG_KEEP_EMPTY | CONFIG_HIDDEN, "input"),
+	CONFIG_OCTET("ip_0", NetworkConfiguration.IP, 0),
+	CONFIG_OCTET("ip_1", NetworkConfiguration.IP, 1),
+	CONFIG_OCTET("ip_2", NetworkConfiguration.IP, 2),
+	CONFIG_OCTET("ip_3", NetworkConfiguration.IP, 3),
+	CONFIG_OCTET("nm_0", NetworkConfiguration.NetMask, 0),
+	CONFIG_OCTET("nm_1", NetworkConfiguration.NetMask, 1),
+	CONFIG_OCTET("nm_2", NetworkConfiguration.NetMask, 2),
+	CONFIG_OCTET("nm_3", NetworkConfiguration.NetMask, 3),
+	CONFIG_OCTET("gw_0", NetworkConfiguration.Gateway, 0),
+	CONFIG_OCTET("gw_1", NetworkConfiguration.Gateway, 1),
+	CONFIG_OCTET("gw_2", NetworkConfiguration.Gateway, 2),
+	CONFIG_OCTET("gw_3", NetworkConfiguration.Gateway, 3),
+	CONFIG_OCTET("dns_0", NetworkConfiguration.DNS, 0),
+	CONFIG_OCTET("dns_1", NetworkConfiguration.DNS, 1),
+	CONFIG_OCTET("dns_2", NetworkConfiguration.DNS, 2),
+	CONFIG_OCTET("dns_3", NetworkConfiguration.DNS, 3),
+	// The box is in the static network form, pageSendNetwork() clears it when that form is posted.
+	CONFIG_FLAG("dhcp", NetworkConfiguration.DHCP, CONFIG_KEEP_EMPTY),
+};
+
+/* @brief MQTT page fields, also the MQTT configuration API. */
+static const ConfigField_t MqttFields_g[] = {
+	CONFIG_FLAG("auth", MqttConfiguration.Auth, 0),
+	CONFIG_TEXT("user", MqttConfiguration.Username, CONFIG_KEEP_EMPTY, "input"),
+	CONFIG_TEXT("pass", MqttConfiguration.Password, CONFIG_KEEP_EMPTY | CONFIG_HIDDEN, "input"),
+	CONFIG_TEXT("domain", MqttConfiguration.Domain, 0, "input"),
+	CONFIG_INT("port", MqttConfiguration.Port, 1, 65535, "input"),
+	CONFIG_FLAG("batch", MqttConfiguration.Batch, 0),
+	CONFIG_INT("batch_size", MqttConfiguration.BatchSize, MQTT_BATCH_MIN_SIZE, MQTT_BATCH_MAX_SIZE, "input"),
+	CONFIG_INT("batch_interval", MqttConfiguration.BatchInterval, 0, 60000, "input"),
+	CONFIG_BYTE("serial_qos", MqttConfiguration.SerialQoS, 0, 2, "select"),
+	CONFIG_FLAG("serial_retain", MqttConfiguration.SerialRetain, 0),
+	CONFIG_BYTE("status_qos", MqttConfiguration.StatusQoS, 0, 2, "select"),
+	CONFIG_FLAG("status_retain", MqttConfiguration.StatusRetain, 0),
+	CONFIG_BYTE("command_qos", MqttConfiguration.CommandQoS, 0, 2, "select"),
+	CONFIG_BYTE("encoding", MqttConfiguration.Encoding, MQTT_ENCODING_JSON, MQTT_ENCODING_MSGPACK, "select"),
+};
+
 #pragma endregion
 
 #pragma region Public Methods
@@ -59,6 +112,7 @@ void WEBServer::begin(FS* fs) {
 #endif // SHOW_FUNC_NAMES
 
 	m_fileSystem = fs;
+	m_fileCache.init(fs);
 	
 	// Initialize the routs.
 	this->initRouts();
@@ -69,20 +123,8 @@ void WEBServer::begin(FS* fs) {
 	MDNS.begin(NetworkConfiguration.Hostname.c_str());
 	MDNS.addService("http", "tcp", WEB_SERVER_PORT);
 
-	// Generate cookie.
-	m_Cookie = genSession();
-
-#ifdef SHOW_CONFIG
-	DEBUGLOG("New cookie: %s\r\n", m_Cookie.c_str());
-#endif // !SHOW_CONFIG
-
 	// Configure and start Web server
 	AsyncWebServer::begin();
-
-	// Task to run periodic things every second.
-	m_eventUpdater.attach(1.0f, &WEBServer::eventUpdateHandler, static_cast<void*>(this));
-
-	clearAliveTime();
 }
 
 /**
@@ -91,6 +133,18 @@ void WEBServer::begin(FS* fs) {
  */
 void WEBServer::update()
 {
+	m_eventFanout.update();
+
+	// Free the closed console clients.
+	m_console.cleanupClients();
+
+	WiFiScanCache.update();
+
+	if (WiFiScanCache.takeChanged())
+	{
+		sendScannedNetworks();
+	}
+
 #ifdef ESP32
 
 #elif defined(ESP8266)
@@ -120,9 +174,11 @@ void WEBServer::displayIRCommand(uint32_t command) {
 }
 
 /** @brief Updates the header data.
+ *  @param data, const char* Changed status fields.
+ *  @param snapshot, const char* All status fields, for clients that missed a change.
  *  @return Void.
  */
-void WEBServer::sendDeviceStatus(String data) {
+void WEBServer::sendDeviceStatus(const char* data, const char* snapshot) {
 /*
 #ifdef SHOW_FUNC_NAMES
 	DEBUGLOG("\r\n");
@@ -131,11 +187,8 @@ void WEBServer::sendDeviceStatus(String data) {
 #endif // SHOW_FUNC_NAMES
 */
 
-	// Check does have someone connected.
-	if (m_webSocketEvents.count() > 0)
-	{
-		m_webSocketEvents.send(data.c_str(), ESS_DEV_STATUS);
-	}
+	// Kept as the latest also without clients, new clients get the snapshot first.
+	m_eventFanout.publish(ESS_DEV_STATUS, data, snapshot);
 }
 
 /** @brief Set reboot process function. Part of the API.
@@ -152,10 +205,143 @@ void WEBServer::setCbReboot(void(*callback)(void)) {
 	m_callbackReboot = callback;
 }
 
+/** @brief Send serial data to the console clients.
+ *  @param data, const char* Data.
+ *  @param length, size_t Data length.
+ *  @return Void.
+ */
+void WEBServer::sendConsole(const char* data, size_t length) {
+
+	if (m_console.count() == 0)
+	{
+		return;
+	}
+
+	// A client that is behind loses data for itself only.
+	uint8_t ConnectedL = 0;
+	uint8_t ReadyL = 0;
+	for (AsyncWebSocketClient* ClientL : m_console.getClients())
+	{
+		if (ClientL->status() != WS_CONNECTED)
+		{
+			continue;
+		}
+
+		ConnectedL++;
+		if (!ClientL->queueIsFull())
+		{
+			ReadyL++;
+		}
+	}
+
+	if (ReadyL < ConnectedL)
+	{
+		DEBUGLOG("Console is busy, dropped %u bytes for %u clients.\r\n", length, ConnectedL - ReadyL);
+	}
+
+	if (ReadyL == 0)
+	{
+		return;
+	}
+
+	// One buffer for all clients when nobody is behind.
+	// The library frees shared buffers in the *All calls only.
+	if (ReadyL == ConnectedL)
+	{
+		AsyncWebSocketMessageBuffer* BufferL = m_console.makeBuffer(length + 1);
+		if (BufferL == NULL)
+		{
+			return;
+		}
+
+		uint8_t* FrameL = BufferL->get();
+		FrameL[0] = CONSOLE_FRAME_DATA;
+		memcpy(FrameL + 1, data, length);
+
+		m_console.binaryAll(BufferL);
+		return;
+	}
+
+	// Ready clients copy the frame, so it is built on the stack,
+	// in parts if the data is longer than a serial frame.
+	uint8_t FrameL[SERIAL_FRAME_MAX_SIZE + 1];
+	FrameL[0] = CONSOLE_FRAME_DATA;
+
+	for (size_t offset = 0; offset < length; offset += SERIAL_FRAME_MAX_SIZE)
+	{
+		size_t PartL = min(length - offset, (size_t)SERIAL_FRAME_MAX_SIZE);
+		memcpy(FrameL + 1, data + offset, PartL);
+
+		for (AsyncWebSocketClient* ClientL : m_console.getClients())
+		{
+			if ((ClientL->status() == WS_CONNECTED) && !ClientL->queueIsFull())
+			{
+				ClientL->binary(FrameL, PartL + 1);
+			}
+		}
+	}
+}
+
+/** @brief Set console input function. Called from the network context.
+ *  @param callback, Input function.
+ *  @return Void.
+ */
+void WEBServer::setCbConsoleInput(void(*callback)(const uint8_t* data, size_t length)) {
+#ifdef SHOW_FUNC_NAMES
+	DEBUGLOG("\r\n");
+	DEBUGLOG(__PRETTY_FUNCTION__);
+	DEBUGLOG("\r\n");
+#endif // SHOW_FUNC_NAMES
+
+	m_callbackConsoleInput = callback;
+}
+
 #pragma endregion
 
 #pragma region Protected Methods
 
+/** @brief Console events handler.
+ *  @param client, AsyncWebSocketClient Client.
+ *  @param type, AwsEventType Event type.
+ *  @param arg, void* Request on connect, frame info on data.
+ *  @param data, uint8_t* Frame data.
+ *  @param length, size_t Data length.
+ *  @return Void.
+ */
+void WEBServer::onConsoleEvent(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t length) {
+
+	if (type == WS_EVT_CONNECT)
+	{
+		DEBUGLOG("Console client connected from %s\r\n", client->remoteIP().toString().c_str());
+		return;
+	}
+
+	if (type != WS_EVT_DATA)
+	{
+		return;
+	}
+
+	AwsFrameInfo* InfoL = static_cast<AwsFrameInfo*>(arg);
+
+	// Frames are small, fragmented ones are not used by the page.
+	if ((InfoL->opcode != WS_BINARY) || !InfoL->final || (InfoL->index != 0) || (InfoL->len != length) || (length == 0))
+	{
+		return;
+	}
+
+	if (data[0] == CONSOLE_FRAME_PING)
+	{
+		data[0] = CONSOLE_FRAME_PONG;
+		client->binary(data, length);
+		return;
+	}
+
+	if ((data[0] == CONSOLE_FRAME_DATA) && (m_callbackConsoleInput != nullptr))
+	{
+		m_callbackConsoleInput(data + 1, length - 1);
+	}
+}
+
 /** @brief Initialize the routs.
  *  @return Void.
  */
@@ -339,18 +525,12 @@ void WEBServer::initRouts() {
 
 	// /logout
 	on(ROUT_PAGE_LOGOUT, HTTP_GET, [this](AsyncWebServerRequest* request) {
-		if (this->isLoggedin(request))
-		{
-			this->goToLogin(request);
-		}
+		this->logout(request);
 	});
 
 	// /logout
 	on(ROUT_PAGE_LOGOUT, HTTP_POST, [this](AsyncWebServerRequest* request) {
-		if (this->isLoggedin(request))
-		{
-			this->goToLogin(request);
-		}
+		this->logout(request);
 	});
 
 #pragma endregion
@@ -370,8 +550,6 @@ void WEBServer::initRouts() {
 		{
 			request->send(404, MIME_TYPE_PLAIN_TEXT, "FileNotFound");
 		}
-
-		clearAliveTime();
 	});
 
 	// /dashboard
@@ -381,8 +559,6 @@ void WEBServer::initRouts() {
 			this->goToLogin(request);
 			return;
 		}
-
-		clearAliveTime();
 	});
 
 #pragma endregion
@@ -402,8 +578,6 @@ void WEBServer::initRouts() {
 		{
 			request->send(404, MIME_TYPE_PLAIN_TEXT, "FileNotFound");
 		}
-
-		clearAliveTime();
 	});
 
 	// /dashboard
@@ -413,8 +587,6 @@ void WEBServer::initRouts() {
 			this->goToLogin(request);
 			return;
 		}
-
-		clearAliveTime();
 	});
 
 #pragma endregion
@@ -433,8 +605,6 @@ void WEBServer::initRouts() {
 		{
 			request->send(404, MIME_TYPE_PLAIN_TEXT, "FileNotFound");
 		}
-
-		clearAliveTime();
 	});
 
 	// /settings
@@ -446,8 +616,6 @@ void WEBServer::initRouts() {
 		}
 
 		this->pageSendSettings(request);
-
-		clearAliveTime();
 	});
 
 #pragma endregion
@@ -466,8 +634,6 @@ void WEBServer::initRouts() {
 		{
 			request->send(404, MIME_TYPE_PLAIN_TEXT, "FileNotFound");
 		}
-
-		clearAliveTime();
 	});
 
 	// /network
@@ -479,8 +645,6 @@ void WEBServer::initRouts() {
 		}
 
 		this->pageSendNetwork(request);
-
-		clearAliveTime();
 	});
 
 #pragma endregion
@@ -499,8 +663,6 @@ void WEBServer::initRouts() {
 		{
 			request->send(404, MIME_TYPE_PLAIN_TEXT, "FileNotFound");
 		}
-
-		clearAliveTime();
 	});
 
 	// /mqtt
@@ -512,8 +674,6 @@ void WEBServer::initRouts() {
 		}
 
 		this->pageSendMqtt(request);
-
-		clearAliveTime();
 	});
 
 #pragma endregion
@@ -532,8 +692,6 @@ void WEBServer::initRouts() {
 		{
 			request->send(404, MIME_TYPE_PLAIN_TEXT, "FileNotFound");
 		}
-
-		clearAliveTime();
 		});
 
 #pragma endregion
@@ -556,8 +714,6 @@ void WEBServer::initRouts() {
 		}
 
 		this->apiSendGeneralConfig(request);
-
-		clearAliveTime();
 	});
 
 	// Network values: IP, GW, DNS, MASK, ... .
@@ -569,8 +725,6 @@ void WEBServer::initRouts() {
 		}
 
 		this->apiSendNetConfig(request);
-
-		clearAliveTime();
 	});
 
 	// Connection state values: connection state.
@@ -582,8 +736,6 @@ void WEBServer::initRouts() {
 		}
 
 		this->apiSendConnState(request);
-
-		clearAliveTime();
 	});
 
 	// Information values: SSID, IP, GW, DNS, Mask, MAC, ... .
@@ -595,8 +747,6 @@ void WEBServer::initRouts() {
 		}
 
 		this->apiSendConnInfo(request);
-
-		clearAliveTime();
 	});
 
 	// Scans WiFi networks.
@@ -608,8 +758,6 @@ void WEBServer::initRouts() {
 		}
 
 		this->apiSendScannedNetworks(request);
-
-		clearAliveTime();
 	});
 	
 	// HTTP authentication.
@@ -621,8 +769,6 @@ void WEBServer::initRouts() {
 		}
 
 		this->apiSendAuthCfg(request);
-
-		clearAliveTime();
 	});
 
 	// MQTT params.
@@ -634,9 +780,20 @@ void WEBServer::initRouts() {
 		}
 
 		this->apiSendMqttCfg(request);
+	});
+
+#ifdef ENABLE_LOOP_PROFILER
+	// Execution times of the loop sections.
+	on(ROUT_API_PROFILE, [this](AsyncWebServerRequest* request) {
+		if (!this->isLoggedin(request))
+		{
+			this->goToLogin(request);
+			return;
+		}
 
-		clearAliveTime();
+		this->apiSendProfile(request);
 	});
+#endif // ENABLE_LOOP_PROFILER
 
 	// Reboot the controller.
 	on(ROUT_API_REBOOT, [this](AsyncWebServerRequest* request) {
@@ -705,22 +862,23 @@ void WEBServer::initRouts() {
 #pragma region Event conect API
 
 	// On event client connected.
-	m_webSocketEvents.onConnect([](AsyncEventSourceClient* client) {
-#ifdef SHOW_FUNC_NAMES
-		DEBUGLOG("\r\n");
-		DEBUGLOG(__PRETTY_FUNCTION__);
-		DEBUGLOG("\r\n");
-#endif // SHOW_FUNC_NAMES
-
-		//m_webSocketEvents.setAuthentication("admin", "admin");
-		//m_webSocketEvents.setAuthentication(DeviceConfiguration.Username.c_str(), DeviceConfiguration.Password.c_str());
-
-		DEBUGLOG("Event source client connected from %s\r\n", client->client()->remoteIP().toString().c_str());
-	});
+	//m_webSocketEvents.setAuthentication("admin", "admin");
+	//m_webSocketEvents.setAuthentication(DeviceConfiguration.Username.c_str(), DeviceConfiguration.Password.c_str());
+	m_eventFanout.attach(&m_webSocketEvents);
 
 	// Add the handler.
 	this->addHandler(&m_webSocketEvents);
 
+	// Serial console, same session as the pages.
+	// The filter sees the request headers, the socket events do not.
+	m_console.setFilter([this](AsyncWebServerRequest* request) {
+		return this->isLoggedin(request);
+	});
+	m_console.onEvent([this](AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t length) {
+		this->onConsoleEvent(client, type, arg, data, length);
+	});
+	this->addHandler(&m_console);
+
 #pragma endregion
 
 #pragma region Configuration files API
@@ -766,6 +924,71 @@ void WEBServer::initRouts() {
 		// delete response; // Free up memory!
 	});
 
+	on(CONFIG_STORE_SLOT_A, HTTP_GET, [this](AsyncWebServerRequest *request) {
+		if (!this->isLoggedin(request))
+		{
+			this->goToLogin(request);
+			return;
+		}
+
+		AsyncWebServerResponse *response = request->beginResponse(403, MIME_TYPE_PLAIN_TEXT, "Forbidden");
+		response->addHeader("Connection", "close");
+		request->send(response);
+		// delete response; // Free up memory!
+	});
+
+	on(CONFIG_STORE_SLOT_B, HTTP_GET, [this](AsyncWebServerRequest *request) {
+		if (!this->isLoggedin(request))
+		{
+			this->goToLogin(request);
+			return;
+		}
+
+		AsyncWebServerResponse *response = request->beginResponse(403, MIME_TYPE_PLAIN_TEXT, "Forbidden");
+		response->addHeader("Connection", "close");
+		request->send(response);
+		// delete response; // Free up memory!
+	});
+
+#else
+
+	// The files are imported to the binary record at boot, export them from memory.
+	on(CONFIG_DEVICE, HTTP_GET, [this](AsyncWebServerRequest *request) {
+		if (!this->isLoggedin(request))
+		{
+			this->goToLogin(request);
+			return;
+		}
+
+		AsyncResponseStream* response = request->beginResponseStream("application/json");
+		save_device_config(response);
+		request->send(response);
+	});
+
+	on(CONFIG_NET, HTTP_GET, [this](AsyncWebServerRequest *request) {
+		if (!this->isLoggedin(request))
+		{
+			this->goToLogin(request);
+			return;
+		}
+
+		AsyncResponseStream* response = request->beginResponseStream("application/json");
+		save_network_configuration(response);
+		request->send(response);
+	});
+
+	on(CONFIG_MQTT, HTTP_GET, [this](AsyncWebServerRequest *request) {
+		if (!this->isLoggedin(request))
+		{
+			this->goToLogin(request);
+			return;
+		}
+
+		AsyncResponseStream* response = request->beginResponseStream("application/json");
+		save_mqtt_configuration(response);
+		request->send(response);
+	});
+
 #endif // SHOW_CONFIG
 
 #pragma endregion
@@ -820,6 +1043,8 @@ void WEBServer::handleFileList(AsyncWebServerRequest *request) {
 		show &= ((entry_name != CONFIG_DEVICE));
 		show &= ((entry_name != CONFIG_MQTT));
 		show &= ((entry_name != CONFIG_NET));
+		show &= ((entry_name != CONFIG_STORE_SLOT_A));
+		show &= ((entry_name != CONFIG_STORE_SLOT_B));
 #endif // SHOW_CONFIG
 
 		if(show)
@@ -890,6 +1115,8 @@ void WEBServer::handleFileList(AsyncWebServerRequest *request) {
 		show &= ((entry_name != CONFIG_DEVICE));
 		show &= ((entry_name != CONFIG_MQTT));
 		show &= ((entry_name != CONFIG_NET));
+		show &= ((entry_name != CONFIG_STORE_SLOT_A));
+		show &= ((entry_name != CONFIG_STORE_SLOT_B));
 #endif // SHOW_CONFIG
 
 		if(show)
@@ -952,6 +1179,7 @@ void WEBServer::handleFileCreate(AsyncWebServerRequest *request) {
 	}
 
 	File file = m_fileSystem->open(path, "w");
+	m_fileCache.clear();
 	if (file)
 	{
 		file.close();
@@ -1000,6 +1228,7 @@ void WEBServer::handleFileDelete(AsyncWebServerRequest *request) {
 	}
 
 	m_fileSystem->remove(path);
+	m_fileCache.clear();
 	request->send(200, MIME_TYPE_PLAIN_TEXT, "");
 	path = String(); // Remove? Useless statement?
 }
@@ -1065,6 +1294,7 @@ void WEBServer::handleFileUpload(
 		{
 			fsUploadFile.close();
 		}
+		m_fileCache.clear();
 		DEBUGLOG("Handle file upload size: %u\r\n", fileSize);
 		fileSize = 0;
 	}
@@ -1093,115 +1323,47 @@ bool WEBServer::handleFileRead(String path, AsyncWebServerRequest* request) {
 	// Check PROGMEM for this file.
 #ifdef USE_PROGMEM_FS
 
-	bool PROGMEMFileL = false;
-
-	// HTML
-#ifdef _BZF_LOGIN_H
-	if (path == BZF_LOGIN_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_LOGIN_MT, bzf_login, BZF_LOGIN_SIZE);
-	}
-#endif // _BZF_LOGIN_H
-#ifdef _BZF_DASHBOARD_H
-	else if (path == BZF_DASHBOARD_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_DASHBOARD_MT, bzf_dashboard, BZF_DASHBOARD_SIZE);
-	}
-#endif //_BZF_DASHBOARD_H
-#ifdef _BZF_APP_H
-	else if (path == BZF_APP_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_APP_MT, bzf_app, BZF_APP_SIZE);
-	}
-#endif //_BZF_APP_H
-#ifdef _BZF_SETTINGS_H
-	else if (path == BZF_SETTINGS_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_SETTINGS_MT, bzf_settings, BZF_SETTINGS_SIZE);
-	}
-#endif // _BZF_SETTINGS_H
-#ifdef _BZF_NETWORK_H
-	else if (path == BZF_NETWORK_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_NETWORK_MT, bzf_network, BZF_NETWORK_SIZE);
-	}
-#endif // _BZF_NETWORK_H
-#ifdef _BZF_HELP_H
-	else if (path == BZF_HELP_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_HELP_MT, bzf_help, BZF_HELP_SIZE);
-	}
-#endif // _BZF_HELP_H
-#ifdef _BZF_MQTT_H
-	else if (path == BZF_MQTT_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_MQTT_MT, bzf_mqtt, BZF_MQTT_SIZE);
-	}
-#endif // _BZF_MQTT_H
-	// CSS
-	else if (path == BZF_RESET_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_RESET_MT, bzf_reset, BZF_RESET_SIZE);
-	}
-	else if (path == BZF_STYLE_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_STYLE_MT, bzf_style, BZF_STYLE_SIZE);
-	}
-	// JS
-	else if (path == BZF_MICROAJAX_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_MICROAJAX_MT, bzf_microajax, BZF_MICROAJAX_SIZE);
-	}
-	else if (path == BZF_DEV_STATUS_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_DEV_STATUS_MT, bzf_dev_status, BZF_DEV_STATUS_SIZE);
-	}
-	// Icon
-	else if (path == BZF_FAVICON_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_FAVICON_MT, bzf_favicon, BZF_FAVICON_SIZE);
-	}
-	// Logo
-	else if (path == BZF_LOGO_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_LOGO_MT, bzf_logo, BZF_LOGO_SIZE);
-	}
-	// Logo White
-	else if (path == BZF_LOGO_WHITE_PATH)
-	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_LOGO_WHITE_MT, bzf_logo_white, BZF_LOGO_WHITE_SIZE);
-	}
+	const StaticAsset_t* AssetL = find_static_asset(path.c_str());
 
-#ifdef ENABLE_EDITOR
-	// Editor
-	else if (path == BZF_EDIT_PATH)
+#ifndef ENABLE_EDITOR
+	// Editor page is served only with the editor.
+	if ((AssetL != NULL) && (AssetL->Data == bzf_edit))
 	{
-		PROGMEMFileL = true;
-		response = request->beginResponse_P(200, BZF_EDIT_MT, bzf_edit, BZF_EDIT_SIZE);
+		AssetL = NULL;
 	}
-#endif
+#endif // !ENABLE_EDITOR
 
-	if (PROGMEMFileL)
+	if (AssetL != NULL)
 	{
 		FileFoundL = true;
-		response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-		response->addHeader("Pragma", "no-cache");
-		response->addHeader("Expires", "0");
-		response->addHeader("Content-Encoding", "gzip");
+
+		// Strong validator from the content hash.
+		char ETagL[11];
+		snprintf(ETagL, sizeof(ETagL), "\"%08lx\"", (unsigned long)AssetL->Hash);
+
+		AsyncWebHeader* IfNoneMatchL = request->getHeader("If-None-Match");
+		if ((IfNoneMatchL != NULL) && (IfNoneMatchL->value().indexOf(ETagL) >= 0))
+		{
+			response = request->beginResponse(304);
+		}
+		else
+		{
+			response = request->beginResponse_P(200, AssetL->MimeType, AssetL->Data, AssetL->Size);
+			response->addHeader("Content-Encoding", "gzip");
+		}
+
+		// The URLs are not versioned, so pages, scripts and styles are revalidated
+		// on every load to follow a firmware update. Only images are kept.
+		if (strncmp(AssetL->MimeType, "image/", 6) == 0)
+		{
+			response->addHeader("Cache-Control", String("public, max-age=") + STATIC_ASSET_MAX_AGE);
+		}
+		else
+		{
+			response->addHeader("Cache-Control", "no-cache");
+		}
+
+		response->addHeader("ETag", ETagL);
 		request->send(response);
 	}
 
@@ -1210,18 +1372,33 @@ bool WEBServer::handleFileRead(String path, AsyncWebServerRequest* request) {
 	// Check SPIFFS for this file.
 	if (!FileFoundL)
 	{
-		String contentType = getContentType(path, request);
-		String pathWithGz = path + ".gz";
-		if (m_fileSystem->exists(pathWithGz) || m_fileSystem->exists(path))
+		const FileMeta_t* MetaL = m_fileCache.get(path.c_str());
+		File FileL;
+
+		if (MetaL->Exists)
 		{
-			if (m_fileSystem->exists(pathWithGz))
+			FileL = m_fileSystem->open(MetaL->Gzip ? path + ".gz" : path, "r");
+
+			// Changed outside of the server, reload on next hit.
+			if (!FileL)
+			{
+				m_fileCache.clear();
+			}
+		}
+
+		if (FileL)
+		{
+			String contentType = request->hasArg("download") ? "application/octet-stream" : MetaL->MimeType;
+
+			if (MetaL->Gzip)
 			{
 				path += ".gz";
 			}
 
 			DEBUGLOG("Content type: %s\r\n", contentType.c_str());
 
-			response = request->beginResponse(*m_fileSystem, path, contentType);
+			// Opened file is passed, so the response does not look it up again.
+			response = request->beginResponse(FileL, path, contentType);
 			response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
 			response->addHeader("Pragma", "no-cache");
 			response->addHeader("Expires", "0");
@@ -1285,7 +1462,7 @@ void WEBServer::pageSendLogin(AsyncWebServerRequest* request) {
 			AsyncWebServerResponse* response = request->beginResponse(301);
 			response->addHeader("Location", ROUT_PAGE_DASHBOARD);
 			response->addHeader("Cache-Control", "no-cache");
-			response->addHeader("Set-Cookie", m_Cookie);
+			response->addHeader("Set-Cookie", String(SESSION_COOKIE_NAME "=") + m_sessions.create() + "; Path=/; HttpOnly; SameSite=Strict");
 			request->send(response);
 			// delete response; // Free up memory!
 			return;
@@ -1312,70 +1489,16 @@ void WEBServer::pageSendSettings(AsyncWebServerRequest* request) {
 
 	if (request->args() > 0)  // Save Settings
 	{
-		for (uint8_t index = 0; index < request->args(); index++)
-		{
-			DEBUGLOG("Arg %s: %s\r\n", request->argName(index).c_str(), urlDecode(request->arg(index)).c_str());
-
-#pragma region Authentication
-
-			// HTTP Authentication.
-			if (request->argName(index) == "user") {
-				DeviceConfiguration.Username = urlDecode(request->arg(index));
-				continue;
-			}
-
-			if (request->argName(index) == "password") {
-				// Prevent empty password field.
-				String pass = urlDecode(request->arg(index));
-				if (pass != "")
-				{
-					DeviceConfiguration.Password = pass;
-					continue;
-				}
-			}
-
-#pragma endregion
-
-#pragma region Device
-
-			if (request->argName(index) == "baudrate") {
-				DeviceConfiguration.PortBaudrate = urlDecode(request->arg(index)).toInt();
-				continue;
-			}
-
-			
-			if (request->argName(index) == "acativation-code") {
-				DeviceConfiguration.ActivationCode = urlDecode(request->arg(index)).toInt();
-				continue;
-			}
-
-#pragma endregion
-
-#pragma region NTP
-
-			if (request->argName(index) == "ntp-domain") {
-				DeviceConfiguration.NTPDomain = urlDecode(request->arg(index));
-				continue;
-			}
-
-
-			if (request->argName(index) == "ntp-tz") {
-				DeviceConfiguration.NTPTimezone = urlDecode(request->arg(index)).toInt() * SECS_IN_HOUR;
-				DEBUGLOG("TZ: %d\r\n", DeviceConfiguration.NTPTimezone);
-				continue;
-			}
-
-#pragma endregion
-
-		}
+		bindFields(request, DeviceFields_g, sizeof(DeviceFields_g) / sizeof(DeviceFields_g[0]));
 
 		// Save configuration.
-		save_device_config(m_fileSystem, CONFIG_DEVICE);
+		save_configuration(m_fileSystem);
 
 		// Apply settings to the hardware!
 		COM_PORT.end();
 		COM_PORT.begin(DeviceConfiguration.PortBaudrate);
 		COM_PORT.flush();
+		SerialIngest.setBaudrate(DeviceConfiguration.PortBaudrate);
 	}
 
 	if (!this->handleFileRead("/settings.html", request))
@@ -1398,150 +1521,16 @@ void WEBServer::pageSendNetwork(AsyncWebServerRequest* request) {
 
 	if (request->args() > 0)  // Save Settings
 	{
-		for (uint8_t index = 0; index < request->args(); index++)
+		// Unchecked box is not posted, the addresses tell the static network form.
+		if (request->hasArg("ip_0"))
 		{
-			DEBUGLOG("Arg %s: %s\r\n", request->argName(index).c_str(), urlDecode(request->arg(index)).c_str());
-
-#pragma region Network
-
-			// https://www.guidgenerator.com/online-guid-generator.aspx
-			if (request->argName(index) == "hostname") {
-				NetworkConfiguration.Hostname = urlDecode(request->arg(index));
-				continue;
-			}
-
-			// SSID
-			if (request->argName(index) == "ssid") {
-				NetworkConfiguration.SSID = urlDecode(request->arg(index));
-				continue;
-			}
-
-			// Password
-			if (request->argName(index) == "password") {
-				String pass = urlDecode(request->arg(index));
-				if (pass != "")
-				{
-					NetworkConfiguration.Password = pass;
-				}
-				continue;
-			}
-
-			// IP
-			if (request->argName(index) == "ip_0") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.IP[0] = request->arg(index).toInt();
-				}
-				continue;
-			}
-			if (request->argName(index) == "ip_1") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.IP[1] = request->arg(index).toInt();
-				}
-				continue;
-			}
-			if (request->argName(index) == "ip_2") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.IP[2] = request->arg(index).toInt();
-				}
-				continue;
-			}
-			if (request->argName(index) == "ip_3") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.IP[3] = request->arg(index).toInt();
-				}
-				continue;
-			}
-
-			// Net mask
-			if (request->argName(index) == "nm_0") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.NetMask[0] = request->arg(index).toInt();
-				}
-				continue;
-			}
-			if (request->argName(index) == "nm_1") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.NetMask[1] = request->arg(index).toInt();
-				}
-				continue;
-			}
-			if (request->argName(index) == "nm_2") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.NetMask[2] = request->arg(index).toInt();
-				}
-				continue;
-			}
-			if (request->argName(index) == "nm_3") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.NetMask[3] = request->arg(index).toInt();
-				}
-				continue;
-			}
-
-			// Gateway
-			if (request->argName(index) == "gw_0") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.Gateway[0] = request->arg(index).toInt();
-				}
-				continue;
-			}
-			if (request->argName(index) == "gw_1") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.Gateway[1] = request->arg(index).toInt();
-				}
-				continue;
-			}
-			if (request->argName(index) == "gw_2") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.Gateway[2] = request->arg(index).toInt();
-				}
-				continue;
-			}
-			if (request->argName(index) == "gw_3") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.Gateway[3] = request->arg(index).toInt();
-				}
-				continue;
-			}
-
-			// DNS
-			if (request->argName(index) == "dns_0") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.DNS[0] = request->arg(index).toInt();
-				}
-				continue;
-			}
-			if (request->argName(index) == "dns_1") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.DNS[1] = request->arg(index).toInt();
-				}
-				continue;
-			}
-			if (request->argName(index) == "dns_2") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.DNS[2] = request->arg(index).toInt();
-				}
-				continue;
-			}
-			if (request->argName(index) == "dns_3") {
-				if (check_octet_range(request->arg(index))) {
-					NetworkConfiguration.DNS[3] = request->arg(index).toInt();
-				}
-				continue;
-			}
-
-			// DHCP
-			if (request->argName(index) == "dhcp") {
-				NetworkConfiguration.DHCP = true;
-				continue;
-			}
-
-#pragma endregion
-
+			NetworkConfiguration.DHCP = false;
 		}
 
+		bindFields(request, NetworkFields_g, sizeof(NetworkFields_g) / sizeof(NetworkFields_g[0]));
+
 		// Save device configuration.
-		save_network_configuration(m_fileSystem, CONFIG_NET);
+		save_configuration(m_fileSystem);
 	}
 
 	if (!this->handleFileRead("/network.html", request))
@@ -1564,60 +1553,237 @@ void WEBServer::pageSendMqtt(AsyncWebServerRequest* request) {
 
 	if (request->args() > 0)  // Save Settings
 	{
-		for (uint8_t index = 0; index < request->args(); index++)
+		bindFields(request, MqttFields_g, sizeof(MqttFields_g) / sizeof(MqttFields_g[0]));
+
+		save_configuration(m_fileSystem);
+	}
+
+	if (!this->handleFileRead("/mqtt.html", request))
+	{
+		request->send(404, MIME_TYPE_PLAIN_TEXT, "FileNotFound");
+		return;
+	}
+}
+
+/** @brief Bind the posted arguments to configuration fields.
+ *  @param request, AsyncWebServerRequest request object.
+ *  @param fields, const ConfigField_t* Fields table.
+ *  @param count, size_t Count of the fields.
+ *  @return Void.
+ */
+void WEBServer::bindFields(AsyncWebServerRequest* request, const ConfigField_t* fields, size_t count) {
+
+	// Unchecked boxes are not posted.
+	config_clear_flags(fields, count);
+
+	for (uint8_t index = 0; index < request->args(); index++)
+	{
+		String ValueL = urlDecode(request->arg(index));
+
+		DEBUGLOG("Arg %s: %s\r\n", request->argName(index).c_str(), ValueL.c_str());
+
+		if (!config_bind(fields, count, request->argName(index).c_str(), ValueL))
 		{
-			DEBUGLOG("Arg %s: %s\r\n", request->argName(index).c_str(), urlDecode(request->arg(index)).c_str());
+			DEBUGLOG("Arg %s is not valid.\r\n", request->argName(index).c_str());
+		}
+	}
+}
 
-			// Domain
-			if (request->argName(index) == "domain") {
-				MqttConfiguration.Domain = urlDecode(request->arg(index));
-				continue;
-			}
+/** @brief Send fields as streamed response. The format is selected by "format=json" argument.
+ *  @param request, AsyncWebServerRequest request object.
+ *  @param source, ApiFieldSource_t Fields source.
+ *  @param list, bool Source groups are list items.
+ *  @return Void.
+ */
+void WEBServer::sendFields(AsyncWebServerRequest* request, ApiFieldSource_t source, bool list) {
 
-			// Port
-			if (request->argName(index) == "port") {
-				MqttConfiguration.Port = urlDecode(request->arg(index)).toInt();
-				continue;
-			}
+	uint8_t FormatL = ApiFormatLegacy;
 
-			// Authentication
-			if (request->argName(index) == "auth") {
-				MqttConfiguration.Auth = (bool)urlDecode(request->arg(index));
-				continue;
-			}
+	if (list)
+	{
+		FormatL = ApiFormatArray;
+	}
+	else if (request->hasArg("format") && (request->arg("format") == "json"))
+	{
+		FormatL = ApiFormatObject;
+	}
 
-			// Password
-			if (request->argName(index) == "pass") {
-				// Prevent empty password field.
-				String pass = urlDecode(request->arg(index));
-				if (pass != "")
-				{
-					MqttConfiguration.Password = pass;
-					continue;
-				}
-			}
+	// The stream is freed together with the response.
+	std::shared_ptr<ApiStream> StreamL = std::make_shared<ApiStream>(source, FormatL);
 
-			// User
-			if (request->argName(index) == "user") {
-				String user = urlDecode(request->arg(index));
-				if (user != "")
-				{
-					MqttConfiguration.Username = user;
-					continue;
-				}
-				continue;
-			}
+	AsyncWebServerResponse* response = request->beginChunkedResponse(ApiStream::contentType(FormatL),
+		[StreamL](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+			return StreamL->read(buffer, maxLen);
+		});
+	response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+	response->addHeader("Pragma", "no-cache");
+	response->addHeader("Expires", "0");
+
+	request->send(response);
+}
 
+/** @brief General configuration fields source.
+ *  @param stream, ApiStream Target stream.
+ *  @param index, size_t Group index.
+ *  @return bool, False when there are no more groups.
+ */
+bool WEBServer::fieldsGeneralConfig(ApiStream& stream, size_t index) {
+
+	if (index == 0)
+	{
+		ConfigStoreStats_t StatsL = config_store_stats();
+
+		stream.field("userversion", (long)ESP_FW_VERSION, "div");
+		stream.field("cfgwrites", (long)StatsL.Sequence, "div");
+		stream.field("cfgskipped", (long)StatsL.Skipped, "div");
+		return true;
+	}
+
+	return config_write_field(stream, DeviceFields_g, sizeof(DeviceFields_g) / sizeof(DeviceFields_g[0]), index - 1);
+}
+
+/** @brief Network configuration fields source.
+ *  @param stream, ApiStream Target stream.
+ *  @param index, size_t Group index.
+ *  @return bool, False when there are no more groups.
+ */
+bool WEBServer::fieldsNetConfig(ApiStream& stream, size_t index) {
+
+	return config_write_field(stream, NetworkFields_g, sizeof(NetworkFields_g) / sizeof(NetworkFields_g[0]), index);
+}
+
+/** @brief MQTT configuration fields source.
+ *  @param stream, ApiStream Target stream.
+ *  @param index, size_t Group index.
+ *  @return bool, False when there are no more groups.
+ */
+bool WEBServer::fieldsMqttConfig(ApiStream& stream, size_t index) {
+
+	return config_write_field(stream, MqttFields_g, sizeof(MqttFields_g) / sizeof(MqttFields_g[0]), index);
+}
+
+/** @brief Connection information fields source.
+ *  @param stream, ApiStream Target stream.
+ *  @param index, size_t Group index.
+ *  @return bool, False when there are no more groups.
+ */
+bool WEBServer::fieldsConnInfo(ApiStream& stream, size_t index) {
+
+	if (index > 0)
+	{
+		return false;
+	}
+
+	stream.field("x_ssid", NetworkConfiguration.SSID.c_str(), "div");
+	stream.field("x_ip", WiFi.localIP(), "div");
+	stream.field("x_netmask", WiFi.subnetMask(), "div");
+	stream.field("x_gateway", WiFi.gatewayIP(), "div");
+	stream.field("x_dns", WiFi.dnsIP(), "div");
+	stream.field("x_mac", WiFi.macAddress().c_str(), "div");
+	stream.field("x_rssi", (long)WiFi.RSSI(), "div");
+
+	return true;
+}
+
+/** @brief Scanned networks fields source, one group per network.
+ *  @param stream, ApiStream Target stream.
+ *  @param index, size_t Group index.
+ *  @return bool, False when there are no more groups.
+ */
+bool WEBServer::fieldsScannedNetworks(ApiStream& stream, size_t index) {
+
+	const ScannedNetwork_t* NetworkL = WiFiScanCache.get(index);
+
+	if (NetworkL == NULL)
+	{
+		return false;
+	}
+
+	char BSSIDL[18];
+	snprintf(BSSIDL, sizeof(BSSIDL), "%02X:%02X:%02X:%02X:%02X:%02X",
+		NetworkL->BSSID[0], NetworkL->BSSID[1], NetworkL->BSSID[2],
+		NetworkL->BSSID[3], NetworkL->BSSID[4], NetworkL->BSSID[5]);
+
+	stream.field("rssi", (long)NetworkL->RSSI, "");
+	stream.field("ssid", NetworkL->SSID, "");
+	stream.field("bssid", BSSIDL, "");
+	stream.field("channel", (long)NetworkL->Channel, "");
+	stream.field("secure", (long)NetworkL->Security, "");
+	stream.flag("hidden", NetworkL->Hidden, "");
+
+	return true;
+}
+
+#ifdef ENABLE_LOOP_PROFILER
+/** @brief Loop profile fields source, one group per section, then one per scheduler task.
+ *  @param stream, ApiStream Target stream.
+ *  @param index, size_t Group index.
+ *  @return bool, False when there are no more groups.
+ */
+bool WEBServer::fieldsProfile(ApiStream& stream, size_t index) {
+
+	// The scheduler tasks follow the sections, with their budget accounting.
+	if (index >= ProfileCount)
+	{
+		const SchedulerTask_t* TaskL = Scheduler.get(index - ProfileCount);
+
+		if (TaskL == NULL)
+		{
+			return false;
 		}
 
-		save_mqtt_configuration(m_fileSystem, CONFIG_MQTT);
+		stream.field("task", TaskL->Name, "");
+		stream.field("n", (long)TaskL->Runs, "");
+		stream.field("avg", (long)((TaskL->Runs > 0) ? (TaskL->TotalTime / TaskL->Runs) : 0), "");
+		stream.field("max", (long)TaskL->MaxTime, "");
+		stream.field("budget", (long)TaskL->Budget, "");
+		stream.field("over", (long)TaskL->Overruns, "");
+
+		return true;
 	}
 
-	if (!this->handleFileRead("/mqtt.html", request))
+	const ProfileStats_t* StatsL = LoopProfiler.get(index);
+
+	if (StatsL == NULL)
 	{
-		request->send(404, MIME_TYPE_PLAIN_TEXT, "FileNotFound");
-		return;
+		return false;
 	}
+
+	// Min is not set before the first run.
+	stream.field("name", LoopProfiler.name(index), "");
+	stream.field("n", (long)StatsL->Count, "");
+	stream.field("min", (long)((StatsL->Count > 0) ? StatsL->Min : 0), "");
+	stream.field("avg", (long)LoopProfiler.average(index), "");
+	stream.field("max", (long)StatsL->Max, "");
+	stream.field("p99", (long)LoopProfiler.percentile(index, 990), "");
+
+	return true;
+}
+#endif // ENABLE_LOOP_PROFILER
+
+/** @brief Push the cached networks to the event clients.
+ *  @return Void.
+ */
+void WEBServer::sendScannedNetworks() {
+#ifdef SHOW_FUNC_NAMES
+	DEBUGLOG("\r\n");
+	DEBUGLOG(__PRETTY_FUNCTION__);
+	DEBUGLOG("\r\n");
+#endif // SHOW_FUNC_NAMES
+
+	// Same JSON as the scan API, built from the same source.
+	ApiStream StreamL(fieldsScannedNetworks, ApiFormatArray);
+	String DataL = "";
+	uint8_t BufferL[128];
+	size_t LengthL;
+
+	while ((LengthL = StreamL.read(BufferL, sizeof(BufferL) - 1)) > 0)
+	{
+		BufferL[LengthL] = '\0';
+		DataL += (const char*)BufferL;
+	}
+
+	m_eventFanout.publish(ESS_WIFI_SCAN, DataL.c_str());
 }
 
 /** @brief Send general configuration values. Part of the API.
@@ -1631,14 +1797,7 @@ void WEBServer::apiSendGeneralConfig(AsyncWebServerRequest* request) {
 	DEBUGLOG("\r\n");
 #endif // SHOW_FUNC_NAMES
 
-	String values = "";
-	values += "userversion|" + String(ESP_FW_VERSION) + "|div\n";
-	values += "baudrate|" + String(DeviceConfiguration.PortBaudrate) + "|select\n";
-	values += "ntp-domain|" + (String)DeviceConfiguration.NTPDomain + "|input\n";
-	values += "ntp-tz|" + String(DeviceConfiguration.NTPTimezone / SECS_IN_HOUR) + "|select\n";
-	values += "acativation-code|" + String(DeviceConfiguration.ActivationCode) + "|input\n";
-
-	request->send(200, MIME_TYPE_PLAIN_TEXT, values);
+	sendFields(request, fieldsGeneralConfig);
 }
 
 /** @brief Send network configuration values. Part of the API.
@@ -1652,30 +1811,7 @@ void WEBServer::apiSendNetConfig(AsyncWebServerRequest* request) {
 	DEBUGLOG("\r\n");
 #endif // SHOW_FUNC_NAMES
 
-	String values = "";
-
-	values += "hostname|" + NetworkConfiguration.Hostname + "|input\n";
-	values += "ssid|" + NetworkConfiguration.SSID + "|input\n";
-	values += "ip_0|" + (String)NetworkConfiguration.IP[0] + "|input\n";
-	values += "ip_1|" + (String)NetworkConfiguration.IP[1] + "|input\n";
-	values += "ip_2|" + (String)NetworkConfiguration.IP[2] + "|input\n";
-	values += "ip_3|" + (String)NetworkConfiguration.IP[3] + "|input\n";
-	values += "nm_0|" + (String)NetworkConfiguration.NetMask[0] + "|input\n";
-	values += "nm_1|" + (String)NetworkConfiguration.NetMask[1] + "|input\n";
-	values += "nm_2|" + (String)NetworkConfiguration.NetMask[2] + "|input\n";
-	values += "nm_3|" + (String)NetworkConfiguration.NetMask[3] + "|input\n";
-	values += "gw_0|" + (String)NetworkConfiguration.Gateway[0] + "|input\n";
-	values += "gw_1|" + (String)NetworkConfiguration.Gateway[1] + "|input\n";
-	values += "gw_2|" + (String)NetworkConfiguration.Gateway[2] + "|input\n";
-	values += "gw_3|" + (String)NetworkConfiguration.Gateway[3] + "|input\n";
-	values += "dns_0|" + (String)NetworkConfiguration.DNS[0] + "|input\n";
-	values += "dns_1|" + (String)NetworkConfiguration.DNS[1] + "|input\n";
-	values += "dns_2|" + (String)NetworkConfiguration.DNS[2] + "|input\n";
-	values += "dns_3|" + (String)NetworkConfiguration.DNS[3] + "|input\n";
-	values += "dhcp|" + (String)(NetworkConfiguration.DHCP ? "checked" : "") + "|chk\n";
-
-	request->send(200, MIME_TYPE_PLAIN_TEXT, values);
-	values = "";
+	sendFields(request, fieldsNetConfig);
 }
 
 /** @brief Send connection state values. Part of the API.
@@ -1699,7 +1835,8 @@ void WEBServer::apiSendConnState(AsyncWebServerRequest* request) {
 	else if (WiFi.status() == 5) state = "CONNECTION LOST";
 	else if (WiFi.status() == 6) state = "DISCONNECTED";
 
-	WiFi.scanNetworks(true);
+	// The cache limits the scans, the result comes over the events.
+	WiFiScanCache.request();
 
 	String values = "";
 	values += "connectionstate|" + state + "|div\n";
@@ -1720,30 +1857,8 @@ void WEBServer::apiSendConnInfo(AsyncWebServerRequest *request) {
 	DEBUGLOG(__PRETTY_FUNCTION__);
 	DEBUGLOG("\r\n");
 #endif // SHOW_FUNC_NAMES
-	
-	String MACL = WiFi.macAddress();
-	
-	String values = "";
-	
-	values += "x_ssid|" + (String)NetworkConfiguration.SSID + "|div\n";
-	values += "x_ip|" + (String)WiFi.localIP()[0] + "." + (String)WiFi.localIP()[1] + "." + (String)WiFi.localIP()[2] + "." + (String)WiFi.localIP()[3] + "|div\n";
-	values += "x_netmask|" + (String)WiFi.subnetMask()[0] + "." + (String)WiFi.subnetMask()[1] + "." + (String)WiFi.subnetMask()[2] + "." + (String)WiFi.subnetMask()[3] + "|div\n";
-	values += "x_gateway|" + (String)WiFi.gatewayIP()[0] + "." + (String)WiFi.gatewayIP()[1] + "." + (String)WiFi.gatewayIP()[2] + "." + (String)WiFi.gatewayIP()[3] + "|div\n";
-	values += "x_dns|" + (String)WiFi.dnsIP()[0] + "." + (String)WiFi.dnsIP()[1] + "." + (String)WiFi.dnsIP()[2] + "." + (String)WiFi.dnsIP()[3] + "|div\n";
-	values += "x_mac|" + MACL + "|div\n";
-	values += "x_rssi|" + String(WiFi.RSSI()) + "|div\n";
-
-	AsyncResponseStream *response = request->beginResponseStream("text/html");
-	// Add header.
-	response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-	response->addHeader("Pragma", "no-cache");
-	response->addHeader("Expires", "0");
-	// Add body.
-	response->print(values);
 
-	request->send(response);
-	//delete &values;
-	values = "";
+	sendFields(request, fieldsConnInfo);
 }
 
 /** @brief Send networks nearby. Part of the API.
@@ -1757,39 +1872,11 @@ void WEBServer::apiSendScannedNetworks(AsyncWebServerRequest* request) {
 	DEBUGLOG("\r\n");
 #endif // SHOW_FUNC_NAMES
 
-	String json = "[";
-	
-	int n = WiFi.scanComplete();
+	// Serve the last result, refresh it when it is old enough.
+	WiFiScanCache.request();
 
-	if (n == WIFI_SCAN_FAILED) {
-		WiFi.scanNetworks(true);
-	}
-	else if (n) {
-		for (int index = 0; index < n; ++index) {
-			if (index) json += ",";
-			json += "{";
-			json += "\"rssi\":" + String(WiFi.RSSI(index));
-			json += ",\"ssid\":\"" + WiFi.SSID(index) + "\"";
-			json += ",\"bssid\":\"" + WiFi.BSSIDstr(index) + "\"";
-			json += ",\"channel\":" + String(WiFi.channel(index));
-			json += ",\"secure\":" + String(WiFi.encryptionType(index));
-#ifdef ESP32
-// ESP32
-			json += ",\"hidden\":false";
-#elif defined(ESP8266)
-// ESP8266
-			json += ",\"hidden\":" + String(WiFi.isHidden(index) ? "true" : "false");
-#endif
-			json += "}";
-		}
-		WiFi.scanDelete();
-		if (WiFi.scanComplete() == WIFI_SCAN_FAILED) {
-			WiFi.scanNetworks(true);
-		}
-	}
-	json += "]";
-	request->send(200, "text/json", json);
-	json = "";
+	// The list is JSON only.
+	sendFields(request, fieldsScannedNetworks, true);
 }
 
 /** @brief Send authentication configuration values. Part of the API.
@@ -1822,36 +1909,60 @@ void WEBServer::apiSendMqttCfg(AsyncWebServerRequest* request) {
 	DEBUGLOG("\r\n");
 #endif // SHOW_FUNC_NAMES
 
-	String values = "";
+	sendFields(request, fieldsMqttConfig);
+}
 
-	values += "auth|" + (String)(MqttConfiguration.Auth ? "checked" : "") + "|chk\n";
-	values += "user|" + (String)MqttConfiguration.Username + "|input\n";
-	values += "domain|" + (String)MqttConfiguration.Domain + "|input\n";
-	values += "port|" + (String)MqttConfiguration.Port + "|input\n";
+#ifdef ENABLE_LOOP_PROFILER
+/** @brief Send the loop profile. Part of the API.
+ *  @param request, AsyncWebServerRequest request object.
+ *  @return Void.
+ */
+void WEBServer::apiSendProfile(AsyncWebServerRequest* request) {
+#ifdef SHOW_FUNC_NAMES
+	DEBUGLOG("\r\n");
+	DEBUGLOG(__PRETTY_FUNCTION__);
+	DEBUGLOG("\r\n");
+#endif // SHOW_FUNC_NAMES
 
-	request->send(200, MIME_TYPE_PLAIN_TEXT, values);
+	// The list is JSON only.
+	sendFields(request, fieldsProfile, true);
 }
+#endif // ENABLE_LOOP_PROFILER
 
 /** @brief Check the authorization status.
  *  @param request, AsyncWebServer Request request object.
  *  @return boolean, True have to authenticate.
  */
 bool WEBServer::isLoggedin(AsyncWebServerRequest *request) {
-	if (request->hasHeader("Cookie"))
+	char TokenL[SESSION_TOKEN_LENGTH + 1];
+
+	if (getSessionToken(request, TokenL) && m_sessions.validate(TokenL))
 	{
-		String cookie = request->header("Cookie");
-		//DEBUGLOG("Found cookie: %s\r\n", cookie.c_str());
-		if (cookie.indexOf(m_Cookie) != -1)
-		{
-			//DEBUGLOG("Authentification Successful\r\n");
-			return true;
-		}
+		//DEBUGLOG("Authentification Successful\r\n");
+		return true;
 	}
 
 	//DEBUGLOG("Authentification Failed\r\n");
 	return false;
 }
 
+/** @brief Get the session token from the request cookies.
+ *  @param request, AsyncWebServerRequest request object.
+ *  @param token, char* Buffer of SESSION_TOKEN_LENGTH + 1 bytes.
+ *  @return boolean, True if the request has a session cookie.
+ */
+bool WEBServer::getSessionToken(AsyncWebServerRequest* request, char* token) {
+	if (!request->hasHeader("Cookie"))
+	{
+		return false;
+	}
+
+	String cookie = request->header("Cookie");
+	//DEBUGLOG("Found cookie: %s\r\n", cookie.c_str());
+
+	return SessionStoreClass::parseCookie(cookie.c_str(), SESSION_COOKIE_NAME, token, SESSION_TOKEN_LENGTH + 1);
+}
+
 /** @brief Redirect to login page.
  *  @param request, AsyncWebServer Request request object.
  *  @return Void.
@@ -1860,17 +1971,26 @@ void WEBServer::goToLogin(AsyncWebServerRequest* request) {
 	AsyncWebServerResponse* response = request->beginResponse(301);
 	response->addHeader("Location", ROUT_PAGE_LOGIN);
 	response->addHeader("Cache-Control", "no-cache");
-	response->addHeader("Set-Cookie", "");
 	request->send(response);
-	m_Cookie = genSession();
 }
 
-/** @brief Clear keep alive counter.
+/** @brief Close the session of the request and redirect to login page.
+ *  @param request, AsyncWebServerRequest request object.
  *  @return Void.
  */
-void WEBServer::clearAliveTime()
-{
-	m_keepAliveTime = 0;
+void WEBServer::logout(AsyncWebServerRequest* request) {
+	char TokenL[SESSION_TOKEN_LENGTH + 1];
+
+	if (getSessionToken(request, TokenL))
+	{
+		m_sessions.remove(TokenL);
+	}
+
+	AsyncWebServerResponse* response = request->beginResponse(301);
+	response->addHeader("Location", ROUT_PAGE_LOGIN);
+	response->addHeader("Cache-Control", "no-cache");
+	response->addHeader("Set-Cookie", SESSION_COOKIE_NAME "=; Path=/; Max-Age=0");
+	request->send(response);
 }
 
 /** @brief Template processor.
@@ -1888,26 +2008,6 @@ void WEBServer::clearAliveTime()
 //	return String();
 //}
 
-/** @brief Execute every one second.
- *  @param arg, void Execution arguments.
- *  @return Void.
- */
-void WEBServer::eventUpdateHandler(void* arg) {
-	// Get instance.
-	WEBServer* self = reinterpret_cast<WEBServer*>(arg);
-
-	// Keep alive.
-	self->m_keepAliveTime++;
-	if (self->m_keepAliveTime > ALIVE_TIME)
-	{
-		self->clearAliveTime();
-		self->m_Cookie = self->genSession();
-	}
-
-	// TODO: Clean old connections.
-	// self->m_webSocketEvents.cleanClients();
-}
-
 #pragma endregion
 
 #pragma region Static Functions
@@ -1920,34 +2020,7 @@ void WEBServer::eventUpdateHandler(void* arg) {
 String WEBServer::getContentType(String filename, AsyncWebServerRequest *request) {
 
 	if (request->hasArg("download")) return "application/octet-stream";
-	else if (filename.endsWith(".htm")) return "text/html";
-	else if (filename.endsWith(".html")) return "text/html";
-	else if (filename.endsWith(".css")) return "text/css";
-	else if (filename.endsWith(".js")) return "application/javascript";
-	else if (filename.endsWith(".json")) return "application/json";
-	else if (filename.endsWith(".png")) return "image/png";
-	else if (filename.endsWith(".gif")) return "image/gif";
-	else if (filename.endsWith(".jpg")) return "image/jpeg";
-	else if (filename.endsWith(".ico")) return "image/x-icon";
-	else if (filename.endsWith(".xml")) return "text/xml";
-	else if (filename.endsWith(".pdf")) return "application/x-pdf";
-	else if (filename.endsWith(".zip")) return "application/x-zip";
-	else if (filename.endsWith(".gz")) return "application/x-gzip";
-	return MIME_TYPE_PLAIN_TEXT;
-}
-
-/** @brief Generate cookie.
- *  @return String, SHA1 cookie.
- */
-String WEBServer::genSession() {
-	int bla = random(1111000, 99999999);
-	String esper = String(bla);
-
-#ifdef SHOW_CONFIG
-	DEBUGLOG("Test SHA1 Int to String radnom: %s\r\n", esper.c_str());
-#endif // SHOW_CONFIG
-
-	return sha1(esper);
+	return get_mime_type(filename.c_str());
 }
 
 /** @brief Decode URL unification. Based on https://code.google.com/p/avr-netino/
@@ -35,6 +35,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define ESS_LOG "log"
 #define ESS_IR_CMD "irCommand"
 #define ESS_DEV_STATUS "deviceStatus"
+#define ESS_WIFI_SCAN "wifiScan"
 
 #define ROUT_EDITOR "/edit"
 #define ROUT_EDITOR_LIST "/list"
@@ -60,6 +61,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define ROUT_API_REBOOT "/api/v1/reboot"
 #define ROUT_API_UPLOAD "/api/v1/upload"
 #define ROUT_API_EVENTS "/api/v1/events"
+#define ROUT_API_CONSOLE "/api/v1/console"
+#define ROUT_API_PROFILE "/api/v1/profile"
 
 #define MIME_TYPE_PLAIN_TEXT "text/plain"
 
@@ -85,7 +88,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #endif
 
 #include <FS.h>
-#include <Ticker.h>
+
+#include <memory>
 
 #include <ArduinoJson.h>
 #include <ESPAsyncWebServer.h>
@@ -98,28 +102,39 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "MQTTConfiguration.h"
 
+#include "ConfigStore.h"
+
 #include "GeneralHelper.h"
 
-#ifdef USE_PROGMEM_FS
-#include "pages\bzf_dashboard.h"
-#include "pages\bzf_app.h"
-#include "pages\bzf_dev_status.h"
-#include "pages\bzf_edit.h"
-#include "pages\bzf_favicon.h"
-#include "pages\bzf_help.h"
-#include "pages\bzf_login.h"
-#include "pages\bzf_logo_white.h"
-#include "pages\bzf_logo.h"
-#include "pages\bzf_microajax.h"
-#include "pages\bzf_mqtt.h"
-#include "pages\bzf_network.h"
-#include "pages\bzf_reset.h"
-#include "pages\bzf_settings.h"
-#include "pages\bzf_style.h"
-#endif // USE_PROGMEM_FS
+#include "SerialIngest.h"
+
+#include "TelemetryBatch.h"
+
+#include "StaticAssets.h"
+
+#include "FileCache.h"
+
+#include "ApiStream.h"
+
+#include "ConfigBinding.h"
+
+#include "WiFiScanCache.h"
+
+#include "EventFanout.h"
+
+#include "SessionStore.h"
+
+#include "LoopProfiler.h"
+
+#include "Scheduler.h"
 
 #pragma endregion
 
+/** @brief Console frame types, first byte of every binary frame. */
+#define CONSOLE_FRAME_DATA 0x01 ///< Serial data, both directions.
+#define CONSOLE_FRAME_PING 0x02 ///< Ping from the page, answered as pong.
+#define CONSOLE_FRAME_PONG 0x03 ///< Pong, same content as the ping.
+
 class WEBServer : public AsyncWebServer {
 
 public:
@@ -146,9 +161,10 @@ public:
 	
 	 /** @brief Updates device status.
 	  *  @param data, String JSON status.
+	  *  @param snapshot, String JSON of all status fields, for clients that missed a change.
 	  *  @return Void
 	  */
-	void sendDeviceStatus(String status);
+	void sendDeviceStatus(const char* status, const char* snapshot);
 
 	/**
 	 * @brief Display IR command.
@@ -163,6 +179,19 @@ public:
 	 */
 	void setCbReboot(void(*callback)(void));
 
+	/** @brief Send serial data to the console clients.
+	 *  @param data, const char* Data.
+	 *  @param length, size_t Data length.
+	 *  @return Void.
+	 */
+	void sendConsole(const char* data, size_t length);
+
+	/** @brief Set console input function. Called from the network context.
+	 *  @param callback, Input function.
+	 *  @return Void.
+	 */
+	void setCbConsoleInput(void(*callback)(const uint8_t* data, size_t length));
+
 #pragma endregion
 
 protected:
@@ -176,16 +205,16 @@ protected:
 	FS* m_fileSystem;
 
 	/**
-	 * @brief Cookie
+	 * @brief File system metadata cache.
 	 * 
 	 */
-	String m_Cookie = "";
+	FileCacheClass m_fileCache;
 
 	/**
-	 * @brief Seconds tick handler.
+	 * @brief Logged in sessions.
 	 * 
 	 */
-	Ticker m_eventUpdater;
+	SessionStoreClass m_sessions;
 
 	/**
 	 * @brief Events API handler.
@@ -194,10 +223,22 @@ protected:
 	AsyncEventSource m_webSocketEvents = AsyncEventSource(ROUT_API_EVENTS);
 
 	/**
-	 * @brief Keep alive time.
+	 * @brief Coalescing fan-out of the periodic events.
+	 * 
+	 */
+	EventFanout m_eventFanout;
+
+	/**
+	 * @brief Serial console, binary frames both ways.
+	 * 
+	 */
+	AsyncWebSocket m_console = AsyncWebSocket(ROUT_API_CONSOLE);
+
+	/**
+	 * @brief Console input callback.
 	 * 
 	 */
-	unsigned int m_keepAliveTime = 0;
+	void(*m_callbackConsoleInput)(const uint8_t* data, size_t length) = nullptr;
 
 	/**
 	 * @brief Callback function
@@ -280,6 +321,81 @@ protected:
 	 */
 	void pageSendMqtt(AsyncWebServerRequest* request);
 
+	/** @brief Bind the posted arguments to configuration fields.
+	 *  @param request, AsyncWebServerRequest request object.
+	 *  @param fields, const ConfigField_t* Fields table.
+	 *  @param count, size_t Count of the fields.
+	 *  @return Void.
+	 */
+	void bindFields(AsyncWebServerRequest* request, const ConfigField_t* fields, size_t count);
+
+	/** @brief Console events handler.
+	 *  @param client, AsyncWebSocketClient Client.
+	 *  @param type, AwsEventType Event type.
+	 *  @param arg, void* Request on connect, frame info on data.
+	 *  @param data, uint8_t* Frame data.
+	 *  @param length, size_t Data length.
+	 *  @return Void.
+	 */
+	void onConsoleEvent(AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t length);
+
+	/** @brief Send fields as streamed response. The format is selected by "format=json" argument.
+	 *  @param request, AsyncWebServerRequest request object.
+	 *  @param source, ApiFieldSource_t Fields source.
+	 *  @param list, bool Source groups are list items.
+	 *  @return Void.
+	 */
+	void sendFields(AsyncWebServerRequest* request, ApiFieldSource_t source, bool list = false);
+
+	/** @brief General configuration fields source.
+	 *  @param stream, ApiStream Target stream.
+	 *  @param index, size_t Group index.
+	 *  @return bool, False when there are no more groups.
+	 */
+	static bool fieldsGeneralConfig(ApiStream& stream, size_t index);
+
+	/** @brief Network configuration fields source.
+	 *  @param stream, ApiStream Target stream.
+	 *  @param index, size_t Group index.
+	 *  @return bool, False when there are no more groups.
+	 */
+	static bool fieldsNetConfig(ApiStream& stream, size_t index);
+
+	/** @brief Connection information fields source.
+	 *  @param stream, ApiStream Target stream.
+	 *  @param index, size_t Group index.
+	 *  @return bool, False when there are no more groups.
+	 */
+	static bool fieldsConnInfo(ApiStream& stream, size_t index);
+
+	/** @brief MQTT configuration fields source.
+	 *  @param stream, ApiStream Target stream.
+	 *  @param index, size_t Group index.
+	 *  @return bool, False when there are no more groups.
+	 */
+	static bool fieldsMqttConfig(ApiStream& stream, size_t index);
+
+	/** @brief Scanned networks fields source, one group per network.
+	 *  @param stream, ApiStream Target stream.
+	 *  @param index, size_t Group index.
+	 *  @return bool, False when there are no more groups.
+	 */
+	static bool fieldsScannedNetworks(ApiStream& stream, size_t index);
+
+#ifdef ENABLE_LOOP_PROFILER
+	/** @brief Loop profile fields source, one group per section, then one per scheduler task.
+	 *  @param stream, ApiStream Target stream.
+	 *  @param index, size_t Group index.
+	 *  @return bool, False when there are no more groups.
+	 */
+	static bool fieldsProfile(ApiStream& stream, size_t index);
+#endif // ENABLE_LOOP_PROFILER
+
+	/** @brief Push the cached networks to the event clients.
+	 *  @return Void.
+	 */
+	void sendScannedNetworks();
+
 	/** @brief Send general configuration values. Part of the API.
 	 *  @param request, AsyncWebServerRequest request object.
 	 *  @return Void.
@@ -322,6 +438,14 @@ protected:
 	 */
 	void apiSendMqttCfg(AsyncWebServerRequest* request);
 
+#ifdef ENABLE_LOOP_PROFILER
+	/** @brief Send the loop profile. Part of the API.
+	 *  @param request, AsyncWebServerRequest request object.
+	 *  @return Void.
+	 */
+	void apiSendProfile(AsyncWebServerRequest* request);
+#endif // ENABLE_LOOP_PROFILER
+
 	/** @brief Check the authorization status.
 	 *  @param request, AsyncWebServerRequest request object.
 	 *  @return boolean, True have to authenticate.
@@ -334,15 +458,23 @@ protected:
 	 */
 	void goToLogin(AsyncWebServerRequest* request);
 
-	/** @brief Initialize the server.
+	/** @brief Close the session of the request and redirect to login page.
+	 *  @param request, AsyncWebServerRequest request object.
 	 *  @return Void.
 	 */
-	void initRouts();
+	void logout(AsyncWebServerRequest* request);
 
-	/** @brief Clear keep alive counter.
+	/** @brief Get the session token from the request cookies.
+	 *  @param request, AsyncWebServerRequest request object.
+	 *  @param token, char* Buffer of SESSION_TOKEN_LENGTH + 1 bytes.
+	 *  @return boolean, True if the request has a session cookie.
+	 */
+	bool getSessionToken(AsyncWebServerRequest* request, char* token);
+
+	/** @brief Initialize the server.
 	 *  @return Void.
 	 */
-	void clearAliveTime();
+	void initRouts();
 
 	/** @brief Template processor.
 	 *  @param var, const String& NAme of the template.
@@ -357,17 +489,6 @@ protected:
 	 */
 	static String getContentType(String filename, AsyncWebServerRequest *request);
 
-	/** @brief Execute every one second.
-	 *  @param arg, void Execution arguments.
-	 *  @return Void.
-	 */
-	static void eventUpdateHandler(void* arg);
-
-	/** @brief Generate cookie.
-	 *  @return String, SHA1 cookie.
-	 */
-	static String genSession();
-
 	/** @brief Decode URL unification. Based on https://code.google.com/p/avr-netino/
 	 *  @param input String, String to decode.
 	 *  @return String, Returns the string of unified URL string.
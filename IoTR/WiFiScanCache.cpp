@@ -0,0 +1,179 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// 
+// 
+// 
+
+#include "WiFiScanCache.h"
+
+/** @brief Ask for a fresh scan. Starts it on the next update if the cache is old enough.
+ *  @return Void.
+ */
+void WiFiScanCacheClass::request()
+{
+	m_requested = true;
+}
+
+/** @brief Start requested scans and collect the results. Call it from the main loop.
+ *  @return Void.
+ */
+void WiFiScanCacheClass::update()
+{
+	if (m_scanning)
+	{
+		int CountL = WiFi.scanComplete();
+
+		if (CountL == WIFI_SCAN_RUNNING)
+		{
+			return;
+		}
+
+		m_scanning = false;
+		m_timestamp = millis();
+
+		if (CountL >= 0)
+		{
+			store(CountL);
+		}
+
+		WiFi.scanDelete();
+		return;
+	}
+
+	if (!m_requested)
+	{
+		return;
+	}
+
+	// Rate limit for all clients together.
+	if (m_valid && ((millis() - m_timestamp) < WIFI_SCAN_MIN_INTERVAL))
+	{
+		return;
+	}
+
+	m_requested = false;
+
+	if (WiFi.scanNetworks(true) == WIFI_SCAN_RUNNING)
+	{
+		m_scanning = true;
+		DEBUGLOG("WiFi scan started.\r\n");
+	}
+}
+
+/** @brief Copy the scan result to the cache.
+ *  @param count int, Count of the found networks.
+ *  @return Void.
+ */
+void WiFiScanCacheClass::store(int count)
+{
+	m_count = 0;
+
+	for (int index = 0; index < count; index++)
+	{
+		int8_t RSSIL = WiFi.RSSI(index);
+		uint8_t SlotL = m_count;
+
+		// When full, replace the weakest if this one is stronger.
+		if (m_count == WIFI_SCAN_MAX_NETWORKS)
+		{
+			SlotL = 0;
+			for (uint8_t slot = 1; slot < m_count; slot++)
+			{
+				if (m_networks[slot].RSSI < m_networks[SlotL].RSSI)
+				{
+					SlotL = slot;
+				}
+			}
+
+			if (m_networks[SlotL].RSSI >= RSSIL)
+			{
+				continue;
+			}
+		}
+		else
+		{
+			m_count++;
+		}
+
+		ScannedNetwork_t* NetworkL = &m_networks[SlotL];
+		strncpy(NetworkL->SSID, WiFi.SSID(index).c_str(), sizeof(NetworkL->SSID) - 1);
+		NetworkL->SSID[sizeof(NetworkL->SSID) - 1] = '\0';
+		memcpy(NetworkL->BSSID, WiFi.BSSID(index), WL_MAC_ADDR_LENGTH);
+		NetworkL->RSSI = RSSIL;
+		NetworkL->Channel = WiFi.channel(index);
+		NetworkL->Security = WiFi.encryptionType(index);
+#ifdef ESP32
+		NetworkL->Hidden = (NetworkL->SSID[0] == '\0');
+#elif defined(ESP8266)
+		NetworkL->Hidden = WiFi.isHidden(index);
+#endif
+	}
+
+	m_valid = true;
+	m_changed = true;
+
+	DEBUGLOG("WiFi scan found %d, cached %d.\r\n", count, m_count);
+}
+
+/** @brief Count of the cached networks.
+ *  @return uint8_t, Count.
+ */
+uint8_t WiFiScanCacheClass::count()
+{
+	return m_count;
+}
+
+/** @brief Get cached network.
+ *  @param index uint8_t, Network index.
+ *  @return const ScannedNetwork_t*, Network or NULL if out of range.
+ */
+const ScannedNetwork_t* WiFiScanCacheClass::get(uint8_t index)
+{
+	if (index >= m_count)
+	{
+		return NULL;
+	}
+
+	return &m_networks[index];
+}
+
+/** @brief Age of the cached result.
+ *  @return unsigned long, Age [ms].
+ */
+unsigned long WiFiScanCacheClass::age()
+{
+	return millis() - m_timestamp;
+}
+
+/** @brief Check and clear the updated flag.
+ *  @return bool, True if new result came since the last call.
+ */
+bool WiFiScanCacheClass::takeChanged()
+{
+	bool ChangedL = m_changed;
+	m_changed = false;
+
+	return ChangedL;
+}
+
+/* @brief Singleton WiFi scan cache instance. */
+WiFiScanCacheClass WiFiScanCache;
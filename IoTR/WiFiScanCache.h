@@ -0,0 +1,143 @@
+/*
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// WiFiScanCache.h
+
+#ifndef _WIFISCANCACHE_h
+#define _WIFISCANCACHE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#pragma region Headers
+
+#include "ApplicationConfiguration.h"
+
+#include "DebugPort.h"
+
+#ifdef ESP32
+#include <WiFi.h>
+#elif defined(ESP8266)
+#include <ESP8266WiFi.h>
+#endif
+
+#pragma endregion
+
+#pragma region Definitions
+
+#ifndef WIFI_SCAN_MAX_NETWORKS
+/** @brief Maximum count of the cached networks, the strongest are kept. */
+#define WIFI_SCAN_MAX_NETWORKS 20
+#endif // !WIFI_SCAN_MAX_NETWORKS
+
+#pragma endregion
+
+#pragma region Structures
+
+/** @brief Cached network. */
+typedef struct {
+	char SSID[33]; ///< Network name.
+	uint8_t BSSID[WL_MAC_ADDR_LENGTH]; ///< Access point MAC.
+	int8_t RSSI; ///< Signal strength [dBm].
+	uint8_t Channel; ///< Channel.
+	uint8_t Security; ///< Encryption type.
+	bool Hidden; ///< Hidden network.
+} ScannedNetwork_t;
+
+#pragma endregion
+
+/** @brief Cache of the last WiFi scan.
+ *
+ *  All requests for a scan go through here, so the radio scans at most
+ *  once per WIFI_SCAN_MIN_INTERVAL however many clients poll.
+ */
+class WiFiScanCacheClass
+{
+protected:
+
+	/** @brief Cached networks. */
+	ScannedNetwork_t m_networks[WIFI_SCAN_MAX_NETWORKS];
+
+	/** @brief Count of the cached networks. */
+	uint8_t m_count = 0;
+
+	/** @brief Scan is running. */
+	bool m_scanning = false;
+
+	/** @brief Scan was requested. */
+	bool m_requested = false;
+
+	/** @brief Cache has result. */
+	bool m_valid = false;
+
+	/** @brief Cache was updated since the last check. */
+	bool m_changed = false;
+
+	/** @brief Time of the last completed scan [ms]. */
+	unsigned long m_timestamp = 0;
+
+	/** @brief Copy the scan result to the cache.
+	 *  @param count int, Count of the found networks.
+	 *  @return Void.
+	 */
+	void store(int count);
+
+public:
+
+	/** @brief Ask for a fresh scan. Starts it on the next update if the cache is old enough.
+	 *  @return Void.
+	 */
+	void request();
+
+	/** @brief Start requested scans and collect the results. Call it from the main loop.
+	 *  @return Void.
+	 */
+	void update();
+
+	/** @brief Count of the cached networks.
+	 *  @return uint8_t, Count.
+	 */
+	uint8_t count();
+
+	/** @brief Get cached network.
+	 *  @param index uint8_t, Network index.
+	 *  @return const ScannedNetwork_t*, Network or NULL if out of range.
+	 */
+	const ScannedNetwork_t* get(uint8_t index);
+
+	/** @brief Age of the cached result.
+	 *  @return unsigned long, Age [ms].
+	 */
+	unsigned long age();
+
+	/** @brief Check and clear the updated flag.
+	 *  @return bool, True if new result came since the last call.
+	 */
+	bool takeChanged();
+};
+
+/* @brief Singleton WiFi scan cache instance. */
+extern WiFiScanCacheClass WiFiScanCache;
+
+#endif
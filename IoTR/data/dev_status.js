@@ -4,6 +4,9 @@ function DeviceStatus(url) {
 
     var eventSource = new EventSource(url);
 
+    // Events carry the changed fields only, with all fields from time to time.
+    var status = {};
+
     function formatTwoDigits(i) {
         if (i < 10) { // add zero in front of numbers < 10
             i = '0' + i
@@ -17,6 +20,10 @@ function DeviceStatus(url) {
         return 100 * (1 - (0 - dbm)/(0 - -100));
     }
 
+    this.addEventListener = function(type, listener) {
+        eventSource.addEventListener(type, listener, false);
+    };
+
     this.init = function() {
         eventSource.onopen = function(e) {
             console.log("Device status: Opened");
@@ -35,7 +42,15 @@ function DeviceStatus(url) {
                 return;
             }
 
-            var status = JSON.parse(e.data);
+            var changes = JSON.parse(e.data);
+            for (var key in changes) {
+                status[key] = changes[key];
+            }
+
+            if (status["ssid"] === undefined) {
+                return;
+            }
+
             var unix_timestamp = status["ts"];
             // Create a new JavaScript Date object based on the timestamp
             // multiplied by 1000 so that the argument is in milliseconds, not seconds.
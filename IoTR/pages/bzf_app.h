@@ -1,147 +1,207 @@
-// // bzf_app.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_APP_H#define _BZF_APP_H #define BZF_APP_MT "text/html"#define BZF_APP_PATH "/app.html"#define BZF_APP_SIZE 2490const uint8_t bzf_app[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0xE5, 0x5B, 0xFF, 0x53, 0xDB, 0x38, 0x16, 
-0xFF, 0xFD, 0x66, 0xEE, 0x7F, 0x50, 0xBD, 0xD3, 0x8B, 0xB3, 0x25, 0xCE, 0x17, 0xCA, 0xD2, 0x86, 0x84, 
-0x3D, 0x0A, 0x74, 0xB6, 0x3B, 0x05, 0x3A, 0xD0, 0xBB, 0xBD, 0x9D, 0xCE, 0xCE, 0x8D, 0x62, 0x2B, 0x89, 
-0x5A, 0xC5, 0xF2, 0xC9, 0x4A, 0x80, 0xA3, 0xEC, 0xDF, 0x7E, 0x4F, 0xB2, 0x43, 0x94, 0x44, 0x76, 0xEC, 
-0x04, 0x28, 0xBB, 0x97, 0x99, 0x36, 0xD8, 0x7A, 0xDF, 0xF4, 0x79, 0xEF, 0x49, 0x7A, 0xCF, 0x4E, 0xE7, 
-0xD9, 0xD1, 0xD9, 0xE1, 0xC7, 0x5F, 0x3F, 0x1C, 0xA3, 0xA1, 0x1C, 0xB1, 0xFD, 0xBF, 0xFE, 0xA5, 0xA3, 
-0xBE, 0x11, 0xC3, 0xE1, 0xA0, 0xEB, 0x90, 0xD0, 0x81, 0x3B, 0x08, 0x3E, 0x9D, 0x21, 0xC1, 0x41, 0xFA, 
-0xB7, 0xBE, 0x1E, 0x11, 0x89, 0x91, 0x3F, 0xC4, 0x22, 0x26, 0xB2, 0xEB, 0x8C, 0x65, 0xBF, 0xF6, 0xCA, 
-0x59, 0x1A, 0x1F, 0x4A, 0x19, 0xD5, 0xC8, 0x7F, 0xC6, 0x74, 0xD2, 0x75, 0xFE, 0x55, 0xFB, 0xC7, 0x41, 
-0xED, 0x90, 0x8F, 0x22, 0x2C, 0x69, 0x8F, 0x11, 0x07, 0xF9, 0x3C, 0x94, 0x24, 0x04, 0xE6, 0x77, 0xC7, 
-0x5D, 0x12, 0x0C, 0xC8, 0x32, 0x7B, 0x88, 0x47, 0xA4, 0xEB, 0x4C, 0x28, 0xB9, 0x8C, 0xB8, 0x90, 0x06, 
-0xC7, 0x25, 0x0D, 0xE4, 0xB0, 0x1B, 0x90, 0x09, 0xF5, 0x49, 0x4D, 0x5F, 0x6C, 0x21, 0x1A, 0x52, 0x49, 
-0x31, 0xAB, 0xC5, 0x3E, 0x66, 0xA4, 0xDB, 0x9C, 0x93, 0x26, 0xA9, 0x64, 0x64, 0xFF, 0x1D, 0xFF, 0x78, 
-0x8E, 0x6A, 0xE8, 0xE0, 0xC3, 0x87, 0x4E, 0x3D, 0xB9, 0x63, 0x90, 0x30, 0x1A, 0x7E, 0x41, 0x43, 0x41, 
-0xFA, 0x5D, 0x47, 0x10, 0x98, 0x93, 0xE7, 0xC7, 0xB1, 0x83, 0x04, 0x61, 0x5D, 0x27, 0x96, 0xD7, 0x8C, 
-0xC4, 0x43, 0x42, 0xC0, 0x04, 0x79, 0x1D, 0x81, 0x49, 0x92, 0x5C, 0xC9, 0xBA, 0x22, 0xC8, 0x90, 0xA0, 
-0x39, 0xCA, 0x4B, 0xD0, 0x64, 0xC6, 0x0D, 0xF8, 0xCC, 0x5D, 0xA0, 0xFA, 0xF7, 0xE8, 0xF0, 0xEC, 0xF4, 
-0xE3, 0xC1, 0xBB, 0xD3, 0xE3, 0xF3, 0x0B, 0xF4, 0x7D, 0x7D, 0x7E, 0x74, 0xFE, 0xCA, 0xEB, 0xD7, 0x14, 
-0x5E, 0x98, 0x86, 0x44, 0xA0, 0x9B, 0xF9, 0x31, 0xF5, 0x19, 0x61, 0x31, 0xA0, 0x61, 0x1B, 0x35, 0x50, 
-0x73, 0x27, 0xBA, 0xDA, 0x9B, 0x27, 0xB8, 0xCD, 0x93, 0x0C, 0x56, 0xBC, 0x3D, 0x3B, 0x3F, 0x41, 0x47, 
-0xC7, 0x27, 0x67, 0xAB, 0x8D, 0xB8, 0xC4, 0x8C, 0xD9, 0xF4, 0x6B, 0xB7, 0xB5, 0x51, 0xB3, 0xD1, 0x78, 
-0xBE, 0xB7, 0x3C, 0x3A, 0x24, 0x74, 0x30, 0x94, 0x30, 0xDC, 0x5A, 0xB2, 0x4D, 0x7D, 0x22, 0x1E, 0x83, 
-0xB7, 0x39, 0x98, 0x0F, 0xF8, 0x42, 0x40, 0x4D, 0x88, 0x85, 0xA8, 0xC7, 0x45, 0x40, 0x44, 0x1B, 0xBD, 
-0x8C, 0xAE, 0x50, 0x80, 0x01, 0xFE, 0x00, 0x7D, 0xD7, 0xC7, 0x78, 0xBB, 0xD5, 0xCA, 0x24, 0xAE, 0x31, 
-0xD2, 0x07, 0xAD, 0x21, 0x0F, 0xB3, 0x05, 0xD6, 0x44, 0x62, 0x9A, 0x85, 0xE8, 0xB6, 0x00, 0x16, 0xED, 
-0x1E, 0xE9, 0x73, 0x41, 0x6C, 0x90, 0x48, 0x1E, 0x69, 0x6B, 0x2D, 0xAA, 0x13, 0xBB, 0x1A, 0x96, 0x91, 
-0xD4, 0x1A, 0xDB, 0x50, 0x9A, 0x2F, 0x6D, 0x54, 0xA9, 0x58, 0x46, 0x03, 0x1A, 0x47, 0x0C, 0x5F, 0xB7, 
-0x51, 0x8F, 0x71, 0xFF, 0x4B, 0x2E, 0xC8, 0xB8, 0x17, 0x73, 0x36, 0x96, 0x39, 0x98, 0xF4, 0xB8, 0x94, 
-0x7C, 0x54, 0x00, 0xEB, 0x22, 0x10, 0xC1, 0x17, 0xF6, 0x95, 0x53, 0xB7, 0xF2, 0x87, 0x53, 0x28, 0x57, 
-0x51, 0xE1, 0xBE, 0xB4, 0xA7, 0x40, 0x6A, 0xBB, 0xCF, 0x19, 0x87, 0x30, 0xF9, 0x6E, 0xBB, 0xE5, 0x07, 
-0xDB, 0x65, 0xED, 0xF5, 0xA9, 0xF0, 0x19, 0xC9, 0x09, 0xF0, 0xDD, 0x1D, 0x5B, 0x7C, 0x47, 0x38, 0x08, 
-0x68, 0x38, 0xB8, 0xC3, 0xCD, 0x4E, 0xD5, 0xC3, 0xFE, 0x97, 0x81, 0xE0, 0xE3, 0x30, 0xB8, 0x33, 0xB2, 
-0xD5, 0xDB, 0x7E, 0xFD, 0xBA, 0xB1, 0x6E, 0x4A, 0x4C, 0x93, 0x5E, 0xA5, 0x3C, 0xC2, 0x63, 0xC9, 0x73, 
-0xA2, 0x1C, 0x07, 0x74, 0x1C, 0xB7, 0xD1, 0xCE, 0x52, 0x7E, 0xAE, 0x82, 0x44, 0xC5, 0x6A, 0xAD, 0x37, 
-0x1E, 0x45, 0x44, 0x2C, 0xBB, 0x46, 0x87, 0x6B, 0x3A, 0x9A, 0x99, 0x03, 0x8D, 0xFB, 0xCA, 0x80, 0x29, 
-0xBC, 0x8D, 0x75, 0xE6, 0x59, 0x38, 0x07, 0xA4, 0xC0, 0x61, 0x0C, 0x91, 0x08, 0x8A, 0x04, 0x97, 0x58, 
-0x12, 0xF7, 0xE5, 0x4E, 0x40, 0x06, 0xD5, 0x9C, 0x35, 0xA9, 0xD9, 0x00, 0x07, 0x80, 0x40, 0x1A, 0x24, 
-0xDC, 0x11, 0x16, 0x90, 0xA9, 0xEB, 0x03, 0x9D, 0x13, 0xDE, 0x9A, 0x6A, 0x1A, 0x3E, 0x6B, 0xE5, 0xA4, 
-0xA1, 0xE7, 0x2E, 0xAB, 0x8A, 0x2A, 0x5C, 0x2B, 0xA9, 0x56, 0x05, 0x49, 0xAA, 0x08, 0x62, 0x65, 0xB3, 
-0x89, 0x99, 0x7A, 0x8A, 0xCC, 0xCC, 0x54, 0xB8, 0xDE, 0x6A, 0xC1, 0x68, 0xBF, 0x5F, 0xEB, 0x0B, 0x58, 
-0x98, 0x35, 0x4C, 0x99, 0x19, 0xD0, 0xB4, 0x46, 0x63, 0x92, 0x03, 0xDB, 0xD6, 0xB1, 0x34, 0x0B, 0x7E, 
-0xD8, 0x7E, 0x9E, 0x93, 0x07, 0xAF, 0x76, 0xD7, 0x0E, 0x72, 0xCB, 0x5A, 0xB4, 0x16, 0xE6, 0x8B, 0x10, 
-0xE4, 0xE3, 0xBE, 0xAC, 0x74, 0x63, 0xDC, 0x35, 0x50, 0x6B, 0x01, 0x6F, 0xC7, 0x36, 0x05, 0xDE, 0xEE, 
-0x95, 0x27, 0x0A, 0xBC, 0xB6, 0xF9, 0x11, 0x91, 0xCF, 0x8D, 0xF5, 0xD6, 0x4E, 0x36, 0xE4, 0xCD, 0x97, 
-0x39, 0x90, 0xEF, 0xBE, 0xCE, 0x83, 0x7C, 0xB7, 0xF5, 0x44, 0x20, 0x7F, 0xE4, 0x28, 0xCF, 0x8F, 0xEF, 
-0x3C, 0xB0, 0xED, 0x78, 0xA6, 0x60, 0xDB, 0x3D, 0xF1, 0xE4, 0xC0, 0x7E, 0xBC, 0xC8, 0xD6, 0xDB, 0xDC, 
-0x25, 0x14, 0x75, 0x2C, 0x13, 0xEC, 0xED, 0xDD, 0x9C, 0xC8, 0x6E, 0xE6, 0x45, 0xF6, 0x6E, 0x1E, 0xD8, 
-0xDB, 0xAF, 0xEE, 0x13, 0xEC, 0x66, 0x6F, 0x77, 0xA7, 0xE7, 0xE7, 0x9C, 0x55, 0x5E, 0xDF, 0x1D, 0x55, 
-0x36, 0x38, 0x3E, 0x68, 0xA0, 0x8A, 0xEC, 0xB1, 0xF7, 0x70, 0x70, 0x58, 0xDF, 0x29, 0x76, 0xDC, 0xA7, 
-0x19, 0xD0, 0xFC, 0x13, 0x39, 0xC5, 0x40, 0xEA, 0x3E, 0xBC, 0xB2, 0xD4, 0x21, 0x38, 0xE2, 0x50, 0x20, 
-0x4B, 0x04, 0x87, 0x5A, 0x38, 0xC2, 0x49, 0x8E, 0xE4, 0x90, 0xA0, 0x3E, 0x85, 0x4A, 0x69, 0xB1, 0x61, 
-0xE0, 0x05, 0xBD, 0xC1, 0xFC, 0x9D, 0x9B, 0xEC, 0x5A, 0x95, 0x86, 0x8C, 0x86, 0xA4, 0x96, 0x55, 0xB1, 
-0xF2, 0x09, 0x11, 0x7D, 0xC6, 0x2F, 0x6B, 0xD7, 0x6D, 0x4B, 0x71, 0x63, 0x40, 0xD2, 0xA9, 0x9B, 0xBD, 
-0x96, 0x4E, 0xDD, 0xE8, 0x6E, 0x75, 0x7A, 0x3C, 0xB8, 0x36, 0xBB, 0x32, 0x01, 0x9D, 0x20, 0x9F, 0xE1, 
-0x38, 0xEE, 0x3A, 0x77, 0x0D, 0x15, 0x67, 0xBE, 0x4B, 0x33, 0x47, 0x24, 0xF8, 0xE5, 0xE2, 0xF0, 0xB2, 
-0x1C, 0x86, 0xAE, 0xE2, 0x5A, 0xB3, 0x85, 0x46, 0x41, 0xED, 0x07, 0xA4, 0x9A, 0x41, 0x35, 0x5F, 0x43, 
-0xE5, 0xEC, 0xD3, 0x73, 0x0E, 0x21, 0x85, 0x6A, 0x48, 0x7F, 0x77, 0xEA, 0xC0, 0xB6, 0xA8, 0xCC, 0x76, 
-0xEF, 0xFE, 0x0C, 0x58, 0xE6, 0xD4, 0xDC, 0x38, 0xED, 0x6D, 0x7D, 0xC6, 0x13, 0x1C, 0xFB, 0x82, 0x46, 
-0xB2, 0x1D, 0x4B, 0x2C, 0xE4, 0x91, 0xEE, 0xC2, 0xB9, 0xD5, 0x3D, 0x67, 0x2A, 0xBC, 0x27, 0x43, 0x04, 
-0xFF, 0x6A, 0x6C, 0xA0, 0xBF, 0x7A, 0x6C, 0x4C, 0x9C, 0xFD, 0x0B, 0x45, 0xDB, 0xA9, 0x63, 0x9B, 0x61, 
-0x96, 0xF9, 0x3C, 0x94, 0xC1, 0x3C, 0x5A, 0x69, 0xAF, 0x20, 0x81, 0x32, 0x97, 0x47, 0xC5, 0xAD, 0xBD, 
-0x77, 0x8F, 0x64, 0x4E, 0xCA, 0xE0, 0x30, 0xFA, 0x7B, 0x59, 0xE4, 0x77, 0x2C, 0x34, 0x50, 0xF4, 0xAA, 
-0x2D, 0xE2, 0xCC, 0xD8, 0xF5, 0xE5, 0x7E, 0x16, 0xFA, 0x19, 0x2A, 0x75, 0xBB, 0x23, 0x4F, 0xDF, 0x82, 
-0x4E, 0xA3, 0x76, 0x34, 0x54, 0x9B, 0x77, 0x57, 0x5A, 0xB0, 0x20, 0xD1, 0x2C, 0xDA, 0x0C, 0x91, 0x73, 
-0xB7, 0xCB, 0xCA, 0x5C, 0x2C, 0x4A, 0x1C, 0x64, 0x4C, 0x79, 0x71, 0x6C, 0x13, 0xE1, 0xDA, 0x4A, 0xC7, 
-0x2E, 0x3C, 0x19, 0x5B, 0x4F, 0x7A, 0x62, 0xF4, 0x82, 0xD8, 0x0D, 0xAC, 0xB5, 0xDB, 0xB9, 0x9E, 0x85, 
-0xB3, 0xFD, 0x7F, 0x31, 0x02, 0x92, 0x9B, 0xEB, 0x05, 0xC0, 0xA2, 0x40, 0xF3, 0xEE, 0xEA, 0xA0, 0xCE, 
-0x19, 0xCF, 0x5C, 0x8E, 0xCA, 0x2F, 0x53, 0x51, 0xAF, 0xD6, 0x80, 0x9D, 0x8F, 0x86, 0xC9, 0x82, 0x95, 
-0xF8, 0x23, 0x43, 0xAB, 0xA2, 0xD0, 0x13, 0x84, 0xFD, 0xF0, 0x6E, 0x5A, 0xF0, 0x37, 0x52, 0x8D, 0x25, 
-0x9D, 0xEA, 0x82, 0xEB, 0x99, 0x29, 0xC2, 0x35, 0xD7, 0xA5, 0xA5, 0xEB, 0x64, 0x5D, 0xD4, 0x4F, 0x7B, 
-0xC6, 0x78, 0x40, 0xCC, 0xC5, 0x72, 0xEE, 0x49, 0x85, 0x79, 0x3B, 0x16, 0x7E, 0xD7, 0xA9, 0x8F, 0xA8, 
-0x2F, 0x38, 0xFE, 0x8C, 0xAF, 0xBC, 0xCF, 0xB1, 0xB2, 0x2A, 0x19, 0xCD, 0x93, 0x5D, 0x99, 0x09, 0xA9, 
-0x24, 0xB2, 0x2B, 0x0B, 0xB2, 0x2B, 0xFB, 0x8B, 0x07, 0x89, 0xFE, 0x38, 0xF4, 0xD5, 0xF1, 0x09, 0xCD, 
-0x6D, 0x35, 0xB6, 0x13, 0x42, 0xBD, 0x8E, 0x92, 0x61, 0xFD, 0xD4, 0x08, 0xE1, 0x30, 0x40, 0x70, 0x18, 
-0x88, 0x81, 0xD7, 0x5B, 0x26, 0x8E, 0x89, 0xFC, 0x27, 0x86, 0x6D, 0x29, 0x76, 0x2B, 0x75, 0x1C, 0xD1, 
-0xFA, 0xA4, 0x59, 0x4F, 0x1E, 0x26, 0xD5, 0xB5, 0x9E, 0x4A, 0x75, 0xD5, 0x01, 0xC7, 0xB0, 0x6B, 0xB6, 
-0xA3, 0x3C, 0xA8, 0x59, 0x3C, 0x2A, 0x61, 0x55, 0x72, 0x86, 0x70, 0xC7, 0x82, 0x69, 0xA3, 0x96, 0x35, 
-0x4D, 0xB0, 0x40, 0x30, 0x8A, 0xBA, 0xEA, 0xFF, 0x3D, 0xFB, 0x38, 0x99, 0xC0, 0xFE, 0x7A, 0xC1, 0xC7, 
-0x02, 0x8C, 0xEF, 0xA2, 0x90, 0x5C, 0xA2, 0xE3, 0xD9, 0x1D, 0x2D, 0x7B, 0xCF, 0x26, 0xFA, 0xCE, 0x08, 
-0x41, 0x46, 0x70, 0x1E, 0x3B, 0x54, 0x81, 0xEC, 0xD2, 0x60, 0x0B, 0xE9, 0x13, 0x97, 0xBE, 0xAC, 0x2E, 
-0x73, 0xDD, 0xD8, 0xB3, 0x42, 0xDB, 0xC1, 0xC8, 0x08, 0xF4, 0x82, 0x0D, 0x01, 0xF7, 0xC7, 0xEA, 0x4F, 
-0x6F, 0x40, 0xE4, 0x71, 0x72, 0xF7, 0xCD, 0xF5, 0xBB, 0x00, 0xA4, 0xDB, 0x5A, 0xAD, 0xEA, 0x93, 0xF2, 
-0x7A, 0x3A, 0x9D, 0xDE, 0xD3, 0x58, 0x7A, 0x89, 0x55, 0xAE, 0x61, 0x8C, 0x85, 0xF5, 0x36, 0x77, 0x62, 
-0x38, 0x08, 0x9E, 0xDA, 0xAC, 0xC0, 0xA4, 0x8D, 0xA6, 0xD4, 0xA3, 0xF2, 0xDF, 0xFE, 0x90, 0xF8, 0x5F, 
-0xDC, 0x70, 0x3C, 0xDA, 0x52, 0x97, 0xD5, 0x2C, 0xE3, 0x05, 0x91, 0x63, 0x11, 0x22, 0x57, 0x51, 0xA2, 
-0xFD, 0xFD, 0x84, 0xF6, 0x39, 0x6A, 0xA1, 0x67, 0x5D, 0xD4, 0x58, 0x4F, 0x33, 0xC4, 0x7D, 0x61, 0xBD, 
-0x4A, 0xEB, 0x57, 0xD4, 0x44, 0x9D, 0x8E, 0xA2, 0x5E, 0x6F, 0xA2, 0x8C, 0x60, 0x51, 0x4A, 0xE1, 0xDF, 
-0xD0, 0xEF, 0xEE, 0x54, 0xE5, 0x7A, 0x53, 0x94, 0x7C, 0x30, 0x60, 0xA4, 0xB0, 0x52, 0x9B, 0x3F, 0x7E, 
-0xB4, 0x1A, 0xDF, 0x5E, 0x46, 0x70, 0x9D, 0x80, 0x3E, 0x21, 0x71, 0x0C, 0x8B, 0xB4, 0xAB, 0x56, 0xE4, 
-0x6A, 0x4E, 0xD8, 0x8E, 0xE2, 0x81, 0x19, 0xB2, 0xBE, 0x20, 0x58, 0x92, 0x34, 0x6A, 0x5D, 0x07, 0x76, 
-0x17, 0x27, 0x2B, 0x68, 0x81, 0xD3, 0xA3, 0x21, 0x1C, 0x56, 0x3F, 0xAA, 0x8D, 0xAE, 0xAB, 0x77, 0xC4, 
-0x0C, 0xD2, 0xAC, 0x8C, 0xD0, 0x5B, 0x63, 0xD5, 0xC3, 0x51, 0x44, 0xC2, 0xE0, 0x70, 0x48, 0x59, 0xE0, 
-0x82, 0xD4, 0x2C, 0x85, 0xB0, 0xF4, 0x5E, 0xD2, 0x30, 0xE0, 0x97, 0x1E, 0xEC, 0x2E, 0x9C, 0xB1, 0x8F, 
-0xDC, 0x6D, 0x6C, 0xCD, 0x64, 0xAB, 0x32, 0x2F, 0x1D, 0xF9, 0x49, 0x3F, 0x6C, 0x46, 0x5F, 0xBF, 0xCE, 
-0x46, 0xA7, 0x7F, 0xA4, 0xEA, 0xE7, 0x08, 0xCB, 0x03, 0x3C, 0x8E, 0x02, 0x80, 0xE9, 0x20, 0xA4, 0x23, 
-0xAC, 0xAE, 0xDD, 0x64, 0x55, 0xBF, 0x50, 0x8F, 0x8A, 0x8A, 0xAF, 0x1A, 0x30, 0x9F, 0x5F, 0xD4, 0xB3, 
-0xF4, 0x98, 0x84, 0x31, 0x17, 0x76, 0x1A, 0xDA, 0x37, 0x65, 0x7B, 0x9A, 0xBE, 0xDB, 0x45, 0xCD, 0xCC, 
-0x78, 0x4B, 0x04, 0xC7, 0x74, 0x14, 0x41, 0x69, 0x1E, 0x10, 0xDD, 0x07, 0xD0, 0x36, 0x66, 0x93, 0x9B, 
-0xEB, 0x7A, 0x25, 0xA9, 0x22, 0x2A, 0x5B, 0xA8, 0x32, 0x6D, 0x22, 0x54, 0xB2, 0xFC, 0x71, 0x0B, 0xEB, 
-0x56, 0x4C, 0x0A, 0x19, 0x52, 0xC4, 0x8C, 0xBB, 0x55, 0xB8, 0x94, 0x0D, 0x36, 0x37, 0xA5, 0xE0, 0x1E, 
-0xAA, 0x23, 0xAE, 0xEE, 0x03, 0x15, 0xC2, 0x56, 0x93, 0xBF, 0x57, 0x7D, 0xED, 0x07, 0x06, 0x78, 0x76, 
-0x96, 0xFF, 0xD6, 0x30, 0x97, 0xB5, 0x64, 0x25, 0xD8, 0x6F, 0x55, 0xDD, 0x83, 0xDE, 0x97, 0x82, 0x5C, 
-0xF3, 0x6C, 0x84, 0x7B, 0x49, 0xE4, 0x67, 0x95, 0xDF, 0xD3, 0xC0, 0xBF, 0xAC, 0x3D, 0x05, 0xBD, 0x70, 
-0xAE, 0x96, 0xB6, 0x92, 0x6E, 0xD0, 0x3C, 0x8F, 0x13, 0xFF, 0x46, 0x89, 0xFC, 0x94, 0xDC, 0x50, 0xC2, 
-0xA0, 0x95, 0x7E, 0x28, 0xE9, 0x81, 0xCD, 0xC0, 0x2F, 0x09, 0xFF, 0x13, 0x02, 0xFE, 0x7E, 0x20, 0x4F, 
-0xD0, 0x4B, 0xDA, 0x45, 0x99, 0x98, 0xCF, 0x8E, 0x61, 0x26, 0xFA, 0x6F, 0x34, 0x53, 0x7C, 0x10, 0x06, 
-0xBF, 0xA8, 0x6E, 0xC3, 0x91, 0xE0, 0x51, 0xBC, 0x05, 0x67, 0xDF, 0x07, 0x75, 0x83, 0xD9, 0xDE, 0xFA, 
-0xD6, 0x7E, 0x28, 0x6F, 0x4B, 0x8E, 0x23, 0xF4, 0x52, 0x7E, 0x8F, 0x7E, 0x68, 0x3E, 0xAC, 0x1F, 0x8C, 
-0xCE, 0xE5, 0xB7, 0x76, 0x43, 0x69, 0x53, 0xB2, 0xBD, 0x70, 0x2F, 0xC8, 0xB7, 0x1E, 0x23, 0x03, 0x74, 
-0x83, 0xEF, 0x69, 0x24, 0x40, 0x09, 0x53, 0x1E, 0x18, 0xF9, 0xED, 0x47, 0x88, 0xF9, 0x27, 0x01, 0x7C, 
-0x59, 0x4B, 0x0A, 0x16, 0x6A, 0x72, 0x48, 0x63, 0x4F, 0xBD, 0x40, 0x0E, 0x75, 0xE9, 0xB4, 0x68, 0x73, 
-0x8B, 0x57, 0x66, 0x46, 0xA7, 0xCC, 0xE3, 0x21, 0x87, 0xEA, 0xD4, 0x94, 0x43, 0x72, 0x7D, 0x63, 0xD4, 
-0xDE, 0x8E, 0xEE, 0xAF, 0xC5, 0xE8, 0x0C, 0x04, 0x90, 0x20, 0xB3, 0x90, 0xBE, 0xDD, 0x2B, 0x62, 0x05, 
-0x11, 0x82, 0x8B, 0xE2, 0x66, 0xD0, 0x3E, 0x72, 0x89, 0x27, 0xB1, 0x80, 0x92, 0xDB, 0x83, 0xA2, 0x3E, 
-0xB8, 0xD6, 0xF1, 0xA6, 0x9A, 0x3A, 0x46, 0xD7, 0xCF, 0x3B, 0xFB, 0x70, 0x7C, 0x9A, 0x2B, 0x27, 0x63, 
-0x4A, 0x87, 0x8C, 0xC7, 0x39, 0x53, 0xCA, 0xF0, 0x55, 0xF1, 0xD9, 0x8E, 0x12, 0x7D, 0x1B, 0xC0, 0xDE, 
-0x46, 0x0E, 0x7A, 0x81, 0x88, 0x07, 0x85, 0x3A, 0xDE, 0x04, 0x79, 0x10, 0xAC, 0xE5, 0xA9, 0xB6, 0x1C, 
-0xB8, 0x51, 0xB8, 0x15, 0x23, 0x7D, 0x21, 0x68, 0x4B, 0xF8, 0xE3, 0x59, 0x6A, 0x4D, 0x36, 0xD5, 0x0A, 
-0x47, 0x24, 0xCD, 0xA4, 0xF2, 0x98, 0x4F, 0x9B, 0x3D, 0x86, 0xE5, 0x80, 0xEC, 0xCF, 0x17, 0x67, 0xA7, 
-0x5E, 0xA4, 0x7E, 0xF0, 0xE1, 0xE6, 0xC3, 0x94, 0x6E, 0xEC, 0x3E, 0x0F, 0x63, 0xCE, 0x88, 0xC7, 0xF8, 
-0x60, 0xAE, 0xE1, 0x91, 0xC3, 0x95, 0xD7, 0x27, 0xC9, 0x57, 0xB6, 0xE4, 0xCF, 0x4F, 0x06, 0xEF, 0x6F, 
-0x85, 0x9C, 0x0B, 0xBE, 0xC1, 0xB0, 0x6E, 0x65, 0x74, 0x77, 0x8A, 0x35, 0xDE, 0xDF, 0xF3, 0xC1, 0x00, 
-0x7C, 0x3E, 0x16, 0x6C, 0x4B, 0xBD, 0x6C, 0x42, 0xFD, 0x2D, 0xA4, 0x7E, 0xBE, 0x92, 0x76, 0x91, 0x72, 
-0x9A, 0xF1, 0x06, 0x15, 0x40, 0x6D, 0x5C, 0x65, 0x34, 0xE7, 0xB5, 0x70, 0xD5, 0x45, 0x53, 0xDF, 0xF7, 
-0xDB, 0xC0, 0x57, 0xAC, 0x21, 0xBF, 0x34, 0x72, 0x09, 0xB9, 0xD5, 0xBC, 0x56, 0xB6, 0x3F, 0x16, 0xEA, 
-0xE5, 0xE5, 0x20, 0x09, 0x13, 0xA5, 0xE7, 0x48, 0xBD, 0x03, 0x5D, 0xDD, 0x43, 0xD9, 0x3C, 0x8A, 0x58, 
-0xD2, 0x91, 0x62, 0x30, 0xD8, 0x55, 0xC3, 0x2F, 0xE1, 0x05, 0x77, 0x39, 0x75, 0x27, 0xDB, 0xE5, 0x2F, 
-0x90, 0xBB, 0xC0, 0x77, 0x02, 0xE5, 0xD8, 0xD0, 0xAD, 0xBE, 0x80, 0x6A, 0x28, 0x61, 0x46, 0x79, 0xDC, 
-0x0B, 0xCC, 0x6F, 0xC7, 0x8C, 0xFD, 0xAA, 0x1A, 0xAB, 0x5A, 0x31, 0xFA, 0x3B, 0xFC, 0x2B, 0xC3, 0xFE, 
-0x13, 0x40, 0x1A, 0x27, 0xBC, 0xED, 0x72, 0x9C, 0x27, 0x34, 0x1C, 0x4B, 0x32, 0xE3, 0x2D, 0xC1, 0x7A, 
-0x41, 0x20, 0xC3, 0x02, 0x60, 0xDD, 0xCB, 0xDA, 0xCA, 0xD3, 0x66, 0xF2, 0x14, 0xEB, 0xA2, 0x6D, 0x4B, 
-0xE5, 0x9F, 0x59, 0x3E, 0xCD, 0xC5, 0x81, 0x6E, 0x0F, 0xA3, 0x47, 0xE9, 0x0F, 0x3B, 0x9F, 0x54, 0xCE, 
-0x42, 0x20, 0x26, 0xD8, 0xA4, 0x39, 0xBC, 0x46, 0xD7, 0xD8, 0x4C, 0xC0, 0x3F, 0x4E, 0xEF, 0xD8, 0x7E, 
-0x24, 0x79, 0xE8, 0x13, 0x48, 0xB2, 0x7E, 0xFD, 0xA9, 0x4E, 0x20, 0xE9, 0x94, 0xFE, 0x8F, 0x4F, 0x20, 
-0xE9, 0x46, 0xF4, 0x47, 0x39, 0x79, 0x2C, 0x6F, 0xE5, 0x70, 0x82, 0xD8, 0x7C, 0x0B, 0x2F, 0xFC, 0xF0, 
-0x5C, 0x90, 0x98, 0xFE, 0x97, 0x1C, 0x0D, 0x7A, 0x8B, 0x15, 0xC0, 0x8D, 0x7D, 0xA9, 0x4C, 0x7E, 0xAA, 
-0x68, 0x7F, 0x90, 0x1B, 0xBF, 0xB9, 0xD6, 0xB5, 0xCB, 0x29, 0x1E, 0x11, 0xDD, 0xC1, 0xD2, 0xAF, 0x4F, 
-0x55, 0xAA, 0x9F, 0x1A, 0xBF, 0x79, 0x3E, 0xA3, 0x40, 0x91, 0x2C, 0x0B, 0x16, 0x83, 0xA1, 0x04, 0x4C, 
-0x25, 0x77, 0x50, 0xAB, 0xD1, 0xA8, 0xCE, 0xF4, 0xC0, 0x95, 0xED, 0xE7, 0x7C, 0x19, 0xCB, 0x5F, 0x25, 
-0xE8, 0x0D, 0x2A, 0x55, 0x4F, 0x3F, 0x1D, 0x56, 0xCB, 0x6A, 0xFA, 0xCB, 0x4A, 0x85, 0x66, 0x2A, 0xF1, 
-0x05, 0xAA, 0x44, 0x57, 0x95, 0x55, 0xF8, 0xA4, 0xEB, 0x21, 0x0F, 0x19, 0xC7, 0xC1, 0xEA, 0xC3, 0xC1, 
-0xEC, 0x0D, 0x03, 0x67, 0xFA, 0x2E, 0x83, 0x0E, 0xD2, 0xD8, 0xC9, 0x3C, 0x74, 0xB0, 0x24, 0x53, 0x93, 
-0x23, 0x84, 0x79, 0x92, 0x72, 0x60, 0xC4, 0x81, 0x2F, 0xFD, 0xF8, 0xCF, 0xF6, 0xEE, 0xAE, 0xA6, 0xD5, 
-0xAB, 0xA5, 0x9B, 0x7D, 0xA6, 0x11, 0xFA, 0xBD, 0xCA, 0x44, 0xBA, 0xF1, 0x82, 0x84, 0xED, 0x7D, 0x5F, 
-0x35, 0x98, 0x27, 0xCE, 0x08, 0x91, 0xC2, 0xB0, 0x25, 0x3C, 0x39, 0x05, 0xE6, 0x4D, 0x49, 0x3D, 0xB3, 
-0x97, 0x7A, 0xE6, 0xDE, 0xBD, 0xE9, 0xD4, 0xD3, 0x17, 0x58, 0x3B, 0xF5, 0xF4, 0x17, 0xDD, 0xFF, 0x03, 
-0x73, 0xCD, 0x01, 0x7B, 0xE3, 0x3D, 0x00, 0x00};#endif // _BZF_APP_H
\ No newline at end of file
+// // bzf_app.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_APP_H#define _BZF_APP_H #define BZF_APP_MT "text/html"#define BZF_APP_PATH "/app.html"#define BZF_APP_SIZE 3515#define BZF_APP_HASH 0x0627370CULconst uint8_t bzf_app[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xE5, 0x5C, 0xFF, 0x77, 0xDA, 0x38, 0x12, 
+0xFF, 0xBD, 0x7F, 0x85, 0xEA, 0x7D, 0xBB, 0x98, 0x2D, 0x18, 0x48, 0xB6, 0x9B, 0x96, 0x40, 0xF6, 0xD2, 
+0x24, 0xBD, 0xCD, 0x5D, 0x9B, 0xF4, 0x25, 0xD9, 0xDB, 0xDB, 0xD7, 0xDB, 0xB7, 0x4F, 0xD8, 0x02, 0xB4, 
+0x35, 0x96, 0x4F, 0x16, 0x21, 0x5C, 0x9B, 0xFB, 0xDB, 0x6F, 0x24, 0x19, 0x10, 0x60, 0x19, 0x9B, 0x24, 
+0x6D, 0x76, 0x8F, 0xF7, 0x5A, 0xB0, 0xA5, 0xF9, 0xA2, 0x8F, 0x46, 0xA3, 0x99, 0xB1, 0x9C, 0xCE, 0xD3, 
+0xE3, 0xF3, 0xA3, 0xAB, 0x5F, 0xDE, 0x9D, 0xA0, 0xA1, 0x18, 0x85, 0x07, 0x4F, 0x3A, 0xF2, 0x0B, 0x85, 
+0x38, 0x1A, 0x74, 0x1D, 0x12, 0x39, 0x07, 0x4F, 0x10, 0x7C, 0x3A, 0x43, 0x82, 0x03, 0xFD, 0x53, 0x5D, 
+0x8E, 0x88, 0xC0, 0xC8, 0x1F, 0x62, 0x9E, 0x10, 0xD1, 0x75, 0xC6, 0xA2, 0x5F, 0x7F, 0xE1, 0xAC, 0x36, 
+0x0F, 0x85, 0x88, 0xEB, 0xE4, 0xDF, 0x63, 0x7A, 0xDD, 0x75, 0xFE, 0x59, 0xFF, 0xE9, 0xB0, 0x7E, 0xC4, 
+0x46, 0x31, 0x16, 0xB4, 0x17, 0x12, 0x07, 0xF9, 0x2C, 0x12, 0x24, 0x02, 0xDA, 0xD3, 0x93, 0x2E, 0x09, 
+0x06, 0x64, 0x8D, 0x3A, 0xC2, 0x23, 0xD2, 0x75, 0xAE, 0x29, 0x99, 0xC4, 0x8C, 0x0B, 0x83, 0x60, 0x42, 
+0x03, 0x31, 0xEC, 0x06, 0xE4, 0x9A, 0xFA, 0xA4, 0xAE, 0x2E, 0x6A, 0x88, 0x46, 0x54, 0x50, 0x1C, 0xD6, 
+0x13, 0x1F, 0x87, 0xA4, 0xDB, 0x32, 0x99, 0x09, 0x2A, 0x42, 0x72, 0x70, 0xCA, 0xAE, 0x2E, 0x50, 0x1D, 
+0x1D, 0xBE, 0x7B, 0xD7, 0x69, 0xE8, 0x3B, 0x8B, 0x1E, 0x21, 0x8D, 0x3E, 0xA0, 0x21, 0x27, 0xFD, 0xAE, 
+0xC3, 0x09, 0x8C, 0xC7, 0xF3, 0x93, 0xC4, 0x41, 0x9C, 0x84, 0x5D, 0x27, 0x11, 0xD3, 0x90, 0x24, 0x43, 
+0x42, 0x40, 0x01, 0x31, 0x8D, 0x41, 0x21, 0x41, 0x6E, 0x44, 0x43, 0x76, 0xC8, 0x66, 0xA0, 0x08, 0x4A, 
+0x33, 0x50, 0xBD, 0x16, 0xD7, 0xF0, 0x31, 0x7F, 0xA3, 0xC6, 0xB7, 0xE8, 0xE8, 0xFC, 0xEC, 0xEA, 0xF0, 
+0xF4, 0xEC, 0xE4, 0xE2, 0x12, 0x7D, 0xDB, 0x58, 0x6A, 0x5C, 0xBA, 0xF0, 0xFA, 0x75, 0x89, 0x13, 0xA6, 
+0x11, 0xE1, 0xE8, 0xE3, 0x52, 0x93, 0xFC, 0x8C, 0x30, 0x1F, 0xD0, 0xA8, 0x8D, 0x9A, 0xA8, 0xF5, 0x3C, 
+0xBE, 0xD9, 0x5F, 0x6A, 0xBF, 0xB5, 0x73, 0x05, 0xF9, 0xAF, 0xCF, 0x2F, 0xDE, 0xA2, 0xE3, 0x93, 0xB7, 
+0xE7, 0x9B, 0xC4, 0x4F, 0x70, 0x18, 0x66, 0x48, 0x56, 0xF3, 0xD4, 0x46, 0xAD, 0x66, 0xF3, 0xEB, 0xFD, 
+0xB5, 0xC6, 0x21, 0xA1, 0x83, 0xA1, 0x80, 0xD6, 0x9D, 0x55, 0xA5, 0xE4, 0x27, 0x66, 0x09, 0x4C, 0x2E, 
+0x03, 0xB5, 0x01, 0x51, 0x30, 0x9F, 0x6B, 0xB2, 0xDE, 0xA7, 0xC7, 0x78, 0x40, 0x78, 0x1B, 0x7D, 0x17, 
+0xDF, 0xA0, 0x00, 0x03, 0xDE, 0x01, 0xFA, 0xAA, 0x8F, 0xF1, 0xEE, 0xCE, 0x8E, 0xAD, 0x6F, 0x3D, 0x24, 
+0x7D, 0x10, 0x19, 0xB1, 0xC8, 0xCA, 0xAE, 0xCE, 0xB5, 0x5A, 0xEB, 0x7D, 0x6E, 0x37, 0x42, 0xD0, 0xEE, 
+0x91, 0x3E, 0xE3, 0x24, 0x03, 0x09, 0xC1, 0x62, 0xA5, 0xE7, 0xBA, 0x54, 0xAD, 0x51, 0x73, 0xBD, 0x21, 
+0xD5, 0x23, 0xA3, 0x25, 0x5D, 0x14, 0x6D, 0x54, 0xA9, 0xAC, 0x37, 0x06, 0x34, 0x89, 0x43, 0x3C, 0x6D, 
+0xA3, 0x5E, 0xC8, 0xFC, 0x0F, 0x79, 0xC0, 0xE2, 0x5E, 0xC2, 0xC2, 0xB1, 0xB0, 0x23, 0xD1, 0x63, 0x42, 
+0xB0, 0xD1, 0x66, 0x7C, 0x37, 0x03, 0x03, 0x5F, 0xD8, 0x97, 0x93, 0x58, 0xCB, 0x6D, 0x4D, 0xF1, 0xDB, 
+0xD0, 0x09, 0xF7, 0x45, 0xA6, 0x9D, 0xA7, 0x5A, 0xFB, 0x2C, 0x64, 0x60, 0x14, 0x5F, 0xED, 0xEE, 0xF8, 
+0xC1, 0x6E, 0x29, 0x4D, 0x7D, 0xCA, 0xFD, 0x90, 0xD8, 0xED, 0x78, 0xEF, 0x79, 0x86, 0x19, 0xC7, 0x38, 
+0x08, 0x68, 0x34, 0x98, 0x83, 0x95, 0xD9, 0xA9, 0x87, 0xFD, 0x0F, 0x03, 0xCE, 0xC6, 0x51, 0x30, 0x57, 
+0x6F, 0xA7, 0xB7, 0xFB, 0xF2, 0x65, 0x73, 0x3B, 0xC3, 0x9F, 0xAD, 0x68, 0xB9, 0x9E, 0x11, 0x1E, 0x0B, 
+0x66, 0x37, 0x66, 0x1C, 0xD0, 0x71, 0xD2, 0x46, 0xCF, 0x57, 0x57, 0x60, 0x3E, 0x12, 0xD2, 0x28, 0xEB, 
+0xBD, 0xF1, 0x28, 0x26, 0x7C, 0x6D, 0x32, 0x94, 0x5D, 0xA6, 0x8D, 0x36, 0x4B, 0x6F, 0xDE, 0x8B, 0x9D, 
+0xCF, 0x20, 0x6D, 0x96, 0x1F, 0x5E, 0x51, 0x4B, 0x17, 0x1C, 0x47, 0x09, 0xD8, 0x1C, 0x48, 0xE1, 0x4C, 
+0x60, 0x41, 0xDC, 0xEF, 0x9E, 0x07, 0x64, 0x50, 0xB5, 0x3B, 0x9B, 0x56, 0x13, 0x30, 0x07, 0x76, 0x34, 
+0xD0, 0xC4, 0x31, 0xE6, 0xB0, 0x16, 0xB7, 0x04, 0xD7, 0x6E, 0xC5, 0xAA, 0xD3, 0xCC, 0x56, 0xCA, 0x2F, 
+0x3A, 0x43, 0xC6, 0x7C, 0xE1, 0x14, 0x14, 0x56, 0x7E, 0xDD, 0x6C, 0xB0, 0x88, 0x54, 0x08, 0x18, 0xC6, 
+0x1D, 0x06, 0x64, 0xCA, 0x28, 0x30, 0x22, 0x53, 0xD8, 0x16, 0x8E, 0x20, 0xA4, 0xFD, 0x7E, 0xBD, 0xCF, 
+0xC1, 0xCF, 0x2A, 0x6C, 0x6C, 0x66, 0xDE, 0xCA, 0x32, 0x3B, 0x6D, 0xE8, 0xBB, 0x59, 0x4D, 0xA9, 0xA9, 
+0x7F, 0xBF, 0xFB, 0xB5, 0xDD, 0xD8, 0x5F, 0xEC, 0x6D, 0x69, 0xCA, 0x19, 0x3E, 0xA6, 0x3C, 0xCC, 0xAB, 
+0x23, 0xCF, 0x85, 0x7A, 0x5D, 0xE0, 0xDD, 0xA0, 0x56, 0xF0, 0x6C, 0x81, 0x75, 0x26, 0x9E, 0x29, 0xD6, 
+0x99, 0xF3, 0xF0, 0xF8, 0xB0, 0x56, 0xDA, 0x7E, 0x26, 0xB0, 0xF3, 0x2C, 0x7A, 0xE7, 0xB9, 0x15, 0xE5, 
+0xD6, 0x77, 0x76, 0x94, 0xF7, 0x5E, 0xE6, 0xA0, 0xBC, 0xB7, 0xF3, 0xE5, 0x51, 0xFE, 0x8C, 0xB6, 0x9C, 
+0x6B, 0xC5, 0x39, 0xF8, 0x66, 0x62, 0x98, 0xE2, 0x9B, 0x89, 0xFD, 0x63, 0xC2, 0xF7, 0xF3, 0xD8, 0xAF, 
+0xDA, 0xA7, 0x26, 0x90, 0x57, 0x85, 0x36, 0x7C, 0x77, 0xF7, 0xEC, 0xF6, 0xDB, 0xCA, 0xB1, 0xDF, 0xBD, 
+0x1C, 0x7C, 0x77, 0x5F, 0xDC, 0x1F, 0xBE, 0xAD, 0xDE, 0xDE, 0xF3, 0x9E, 0x6F, 0x8F, 0x2E, 0x5E, 0xCE, 
+0x83, 0x8B, 0x6D, 0x37, 0x7D, 0x05, 0x4F, 0x81, 0x1D, 0xF2, 0xAE, 0xDB, 0xFD, 0xB6, 0xD3, 0x90, 0x09, 
+0xF5, 0xCC, 0xCC, 0x5B, 0x7F, 0x86, 0x69, 0x30, 0xF0, 0xB9, 0xF3, 0x3C, 0xAC, 0x66, 0xE4, 0xC7, 0x0C, 
+0x12, 0x53, 0x81, 0x20, 0xE2, 0x84, 0x50, 0x4B, 0x30, 0x24, 0x86, 0x04, 0xF5, 0x29, 0x24, 0x2D, 0x2B, 
+0x09, 0xBA, 0x17, 0xF4, 0x06, 0x4B, 0x37, 0x3E, 0x5A, 0x13, 0x45, 0x1A, 0x85, 0x34, 0x22, 0x75, 0x4B, 
+0xBA, 0xC8, 0xAE, 0x09, 0xEF, 0x87, 0x6C, 0x52, 0x9F, 0xB6, 0xD7, 0x13, 0x8D, 0x05, 0x0E, 0x9D, 0x86, 
+0x51, 0xCD, 0xE8, 0x34, 0x16, 0x75, 0xA3, 0x4E, 0x8F, 0x05, 0x53, 0xA3, 0xE8, 0x11, 0xD0, 0x6B, 0xE4, 
+0x87, 0x38, 0x49, 0xBA, 0xCE, 0xBC, 0x66, 0xE1, 0x2C, 0x15, 0x41, 0x96, 0xFA, 0x70, 0x36, 0x59, 0x69, 
+0x5D, 0xE7, 0x12, 0xA2, 0x9B, 0xA4, 0xDE, 0xDA, 0x41, 0xA3, 0xA0, 0xFE, 0x3D, 0x92, 0x85, 0x96, 0xBA, 
+0xAF, 0xF0, 0x71, 0x0E, 0xE8, 0x05, 0x03, 0xEB, 0x41, 0x75, 0xA4, 0xBE, 0x3B, 0x0D, 0x20, 0x5B, 0x11, 
+0x95, 0x71, 0xEB, 0xDE, 0xA4, 0xAF, 0x11, 0x2A, 0x62, 0x9C, 0xD6, 0x8C, 0x7E, 0xC7, 0xD7, 0x38, 0xF1, 
+0x39, 0x8D, 0x45, 0x3B, 0x11, 0x98, 0x8B, 0x63, 0x55, 0xDA, 0x72, 0xAB, 0xFB, 0xCE, 0x8C, 0x77, 0x4F, 
+0x44, 0x08, 0xFE, 0xD5, 0xC3, 0x81, 0xFA, 0xEA, 0x85, 0x63, 0xE2, 0x1C, 0x5C, 0xCA, 0xBE, 0x9D, 0x06, 
+0xCE, 0x50, 0x6B, 0x7D, 0x2C, 0x0F, 0xA4, 0x2D, 0x8B, 0x37, 0x2A, 0xCB, 0x49, 0x20, 0x75, 0x65, 0x71, 
+0x51, 0x55, 0xEF, 0x79, 0x26, 0x6C, 0xE3, 0x31, 0x08, 0x8C, 0xA2, 0x99, 0xA5, 0xF7, 0x9C, 0x82, 0x06, 
+0xB2, 0xBB, 0xAC, 0x42, 0x38, 0x0B, 0x6A, 0x75, 0x79, 0x60, 0x41, 0xDD, 0x22, 0x50, 0x15, 0x18, 0x72, 
+0xA4, 0xAD, 0x48, 0x34, 0xB2, 0x38, 0x43, 0xB0, 0x79, 0x77, 0x93, 0xFC, 0x15, 0x86, 0x66, 0x16, 0x65, 
+0x70, 0x5C, 0xBA, 0x5D, 0x92, 0xE5, 0x6A, 0xC6, 0xE0, 0x20, 0x63, 0xBC, 0xAB, 0x6D, 0x77, 0xE0, 0xAD, 
+0x74, 0x74, 0xB2, 0x79, 0xEB, 0xB6, 0xAD, 0x98, 0x6B, 0x95, 0x57, 0xB8, 0x6E, 0xAF, 0x6B, 0xB6, 0x96, 
+0x5B, 0xE9, 0xB7, 0xD8, 0xCD, 0x57, 0xE7, 0x5E, 0xDF, 0xDC, 0x6A, 0xEA, 0x57, 0xF9, 0x99, 0x77, 0x37, 
+0xDA, 0xB2, 0xBD, 0xD9, 0xE6, 0x7B, 0x4A, 0xBB, 0xA4, 0xB8, 0x57, 0x6F, 0xC2, 0xA6, 0x46, 0x23, 0xED, 
+0x9C, 0xF4, 0x44, 0x64, 0x8B, 0x94, 0x1D, 0xD4, 0xD8, 0x60, 0xAB, 0x9B, 0x8F, 0x08, 0x7E, 0x23, 0x59, 
+0xCE, 0x51, 0x6B, 0x9B, 0x33, 0x35, 0x28, 0xD9, 0xF1, 0x0B, 0xF8, 0x20, 0xF8, 0x7F, 0x9B, 0xD1, 0x80, 
+0xE2, 0x10, 0x79, 0x90, 0xC7, 0x38, 0xA2, 0x97, 0x36, 0xE5, 0x69, 0x14, 0x8F, 0x85, 0xF1, 0xA4, 0xC3, 
+0x31, 0x47, 0x52, 0x57, 0xAD, 0x0B, 0x9B, 0x33, 0xC7, 0x82, 0x20, 0x02, 0xF1, 0xC9, 0x90, 0x85, 0x10, 
+0x09, 0x75, 0x9D, 0x2B, 0x60, 0x20, 0x83, 0x9A, 0x84, 0x44, 0xC1, 0x2C, 0xB8, 0xE1, 0x72, 0xE7, 0xAE, 
+0xA1, 0x13, 0x15, 0xF0, 0x00, 0x2D, 0x8A, 0xC8, 0x04, 0xC9, 0x80, 0xC5, 0x51, 0x85, 0x4F, 0x9F, 0x8D, 
+0xE2, 0x90, 0x08, 0x90, 0xCB, 0xFA, 0x7D, 0xE7, 0xEE, 0x16, 0xB8, 0x5B, 0x60, 0x53, 0xBC, 0xB8, 0xBA, 
+0x6A, 0xA3, 0x4E, 0x12, 0xE3, 0x68, 0x69, 0x98, 0x5C, 0xC0, 0xE4, 0xD6, 0x21, 0x10, 0x82, 0x86, 0x6D, 
+0x26, 0x67, 0xF5, 0x52, 0x6F, 0xB7, 0xEA, 0x91, 0xDC, 0x18, 0x0F, 0x88, 0xB9, 0x07, 0x2F, 0x3D, 0x55, 
+0x32, 0x6F, 0x27, 0xDC, 0xEF, 0x3A, 0x8D, 0x11, 0xF5, 0x39, 0xC3, 0xBF, 0xE3, 0x1B, 0xEF, 0xF7, 0x44, 
+0x9A, 0x8B, 0x6E, 0xCD, 0x61, 0x5D, 0x59, 0xF0, 0xA8, 0x68, 0xD6, 0x95, 0x15, 0xD6, 0x95, 0x83, 0xE5, 
+0x50, 0xB4, 0x3F, 0x8E, 0x7C, 0x19, 0x77, 0xA3, 0xA5, 0xD8, 0x25, 0x23, 0xCA, 0x6C, 0x34, 0x90, 0x6E, 
+0x55, 0x8F, 0xF6, 0x10, 0x86, 0x99, 0x85, 0x88, 0x32, 0x01, 0x52, 0x6F, 0xAD, 0x6F, 0x42, 0xC4, 0x3F, 
+0x30, 0x44, 0x39, 0x89, 0x5B, 0x69, 0xE0, 0x98, 0x36, 0xAE, 0x5B, 0x0D, 0xFD, 0xC0, 0xAF, 0xA1, 0xA4, 
+0x54, 0xAA, 0xB9, 0xD1, 0xB1, 0xA1, 0xD2, 0x22, 0x40, 0x79, 0x40, 0x8D, 0x58, 0x5C, 0x54, 0x21, 0x1D, 
+0x86, 0xBA, 0x63, 0x1E, 0x4A, 0x7D, 0xD6, 0x84, 0x5C, 0x63, 0x8E, 0xA0, 0x0D, 0x75, 0xE5, 0xFF, 0xFB, 
+0x99, 0xCD, 0xE4, 0x1A, 0x0C, 0xF2, 0x92, 0x8D, 0x39, 0x68, 0xDD, 0x55, 0x4B, 0xE0, 0x64, 0x71, 0x47, 
+0x31, 0xCE, 0xA6, 0xD3, 0xCA, 0x5E, 0xCA, 0xC2, 0x36, 0xD0, 0x7D, 0xBC, 0xDD, 0x5F, 0x97, 0x3E, 0xD7, 
+0x92, 0x93, 0x11, 0x04, 0xFB, 0x47, 0x72, 0x51, 0xB8, 0x34, 0xA8, 0x21, 0x15, 0xD0, 0xAB, 0xCB, 0xEA, 
+0x1A, 0xD1, 0xC7, 0xCC, 0x85, 0xA1, 0x34, 0x0D, 0xC9, 0x08, 0x34, 0x03, 0x69, 0x01, 0xF3, 0xC7, 0xF2, 
+0xA7, 0x37, 0x20, 0xE2, 0x44, 0xDF, 0x7D, 0x35, 0x3D, 0x0D, 0x80, 0x77, 0x86, 0xB2, 0xF2, 0x93, 0x92, 
+0x7A, 0x6A, 0x5D, 0xBE, 0xA1, 0x89, 0xF0, 0xB4, 0x4A, 0xAE, 0xA1, 0xC9, 0x3A, 0xE5, 0x6D, 0xCE, 0x90, 
+0x70, 0x10, 0x3C, 0xAA, 0xF1, 0x80, 0x3E, 0xDB, 0x0F, 0xA6, 0x47, 0xC5, 0x6F, 0xFE, 0x90, 0xF8, 0x1F, 
+0xDC, 0x68, 0x3C, 0xAA, 0xC9, 0xCB, 0xAA, 0x45, 0x6F, 0x4E, 0xC4, 0x98, 0x47, 0xC8, 0x95, 0x1D, 0xD1, 
+0xC1, 0x81, 0xEE, 0xFA, 0x35, 0xDA, 0x41, 0x4F, 0xBB, 0xA8, 0xB9, 0x85, 0x54, 0x58, 0x05, 0x45, 0x65, 
+0x4A, 0x89, 0x9F, 0x50, 0x0B, 0x75, 0x3A, 0xB2, 0xF3, 0x16, 0x03, 0x0C, 0x09, 0xE6, 0x65, 0x84, 0x7D, 
+0x83, 0xFE, 0xEB, 0xCE, 0xC4, 0x6D, 0x31, 0x34, 0xC1, 0x06, 0x83, 0x90, 0x14, 0x15, 0x98, 0x35, 0x05, 
+0x3F, 0x64, 0xEA, 0xDD, 0x5E, 0x07, 0xAE, 0xB4, 0xE9, 0xBE, 0x25, 0x49, 0x02, 0xDE, 0xD9, 0x95, 0xAE, 
+0xB8, 0x6A, 0xB7, 0xD0, 0x51, 0x32, 0x30, 0xAD, 0xD3, 0xE7, 0x04, 0x56, 0x7B, 0x6A, 0xA0, 0xAE, 0x03, 
+0x7B, 0x8A, 0x63, 0xB1, 0x4F, 0x20, 0xF4, 0x68, 0x04, 0xE9, 0xCF, 0x95, 0x8C, 0x3D, 0xBA, 0x6A, 0xE7, 
+0xCB, 0xEE, 0x69, 0x33, 0x7D, 0x15, 0x7A, 0x55, 0x3D, 0x1C, 0xC7, 0xB0, 0x63, 0x1F, 0x0D, 0x69, 0x18, 
+0xB8, 0xC0, 0xD4, 0x22, 0x0E, 0xFC, 0xEE, 0x84, 0x46, 0x01, 0x9B, 0x78, 0xB0, 0xA5, 0xB0, 0x30, 0xBC, 
+0x62, 0x6E, 0xB3, 0xB6, 0x60, 0x2D, 0xEB, 0x04, 0x69, 0xCB, 0x8F, 0xEA, 0x64, 0x00, 0xFA, 0xF4, 0x69, 
+0xD1, 0x3A, 0xFB, 0x91, 0x4A, 0x5F, 0xEA, 0x58, 0x12, 0xD9, 0x71, 0x1C, 0x00, 0x40, 0x87, 0x11, 0x1D, 
+0x61, 0x79, 0xED, 0x1A, 0x3E, 0xB2, 0xA8, 0x63, 0x80, 0xA1, 0xFC, 0x2C, 0x4F, 0x3C, 0x40, 0xA0, 0x92, 
+0x30, 0x9E, 0xD9, 0x85, 0xF6, 0x4D, 0xC6, 0x9E, 0xEA, 0xDE, 0xED, 0xA2, 0x96, 0xCD, 0xC2, 0x34, 0xDB, 
+0x84, 0xCA, 0x70, 0x06, 0xDC, 0xB6, 0xAA, 0x1A, 0x29, 0xFD, 0xAC, 0xBD, 0x4D, 0x7F, 0x5D, 0xD1, 0xE9, 
+0x68, 0xA5, 0x86, 0x2A, 0xB3, 0x8A, 0x53, 0xC5, 0x32, 0x0D, 0xB7, 0xE0, 0x97, 0x12, 0x52, 0x44, 0x8B, 
+0x02, 0x3A, 0xCC, 0x1D, 0x6C, 0x19, 0x05, 0x9E, 0xD8, 0x30, 0x3D, 0x92, 0xC9, 0x92, 0x2A, 0x13, 0x16, 
+0x81, 0x54, 0xF5, 0x7E, 0x23, 0x9F, 0x65, 0x3C, 0x28, 0xAE, 0x8B, 0x8C, 0xF0, 0x8B, 0xA2, 0x5B, 0x52, 
+0x8D, 0x0D, 0x18, 0xBF, 0x96, 0x69, 0x33, 0x7A, 0x53, 0x06, 0x69, 0x45, 0x72, 0x07, 0xB8, 0xCB, 0xE1, 
+0xBD, 0xA8, 0x19, 0x3C, 0x02, 0xD4, 0x4B, 0x2A, 0x53, 0x08, 0xFB, 0x0B, 0xE9, 0xB9, 0xCA, 0x81, 0xAF, 
+0x48, 0x3E, 0x87, 0xB1, 0x1B, 0x45, 0x95, 0x47, 0x83, 0x7E, 0x71, 0x6D, 0x36, 0xC0, 0x5F, 0x0E, 0xF8, 
+0xBB, 0x60, 0x5E, 0x0E, 0xF4, 0xC7, 0x02, 0xF7, 0x3D, 0x00, 0xAD, 0x41, 0xD3, 0xE5, 0x44, 0x1B, 0xD2, 
+0x8B, 0x50, 0xCA, 0xC4, 0xFC, 0x95, 0xA2, 0x49, 0x0E, 0xA3, 0xE0, 0x67, 0x59, 0x92, 0x3A, 0xE6, 0x2C, 
+0x4E, 0x6A, 0x10, 0xB3, 0x3E, 0x1C, 0xF8, 0x66, 0xE9, 0xF3, 0x8B, 0xA2, 0x5F, 0x5A, 0x11, 0x2B, 0xFC, 
+0xCA, 0x49, 0xDF, 0x1F, 0xFA, 0xAD, 0x07, 0x44, 0xDF, 0x28, 0x65, 0x7F, 0x51, 0xF0, 0xCB, 0xEA, 0x61, 
+0xC3, 0xFE, 0x3E, 0xF0, 0xDE, 0x79, 0x70, 0x6B, 0x57, 0xE5, 0xDE, 0x47, 0x60, 0xEC, 0xC5, 0xF5, 0x78, 
+0x48, 0xBC, 0x77, 0x1F, 0xDA, 0xBE, 0xBF, 0x3C, 0xDC, 0x25, 0xD5, 0x28, 0x92, 0x4E, 0x89, 0x21, 0x4D, 
+0x3C, 0x79, 0x00, 0x1F, 0x12, 0xC7, 0x59, 0x6A, 0xE5, 0x16, 0xCD, 0x9F, 0x8C, 0x72, 0x96, 0xC7, 0x22, 
+0x06, 0xD9, 0xA3, 0xC9, 0x85, 0xE4, 0xCD, 0x87, 0x91, 0x17, 0x3B, 0xAA, 0x06, 0x96, 0xA0, 0x73, 0xA0, 
+0x27, 0x81, 0x2D, 0xCB, 0xBD, 0xDD, 0x2F, 0xA0, 0x02, 0xE1, 0x9C, 0xF1, 0xC2, 0x3A, 0xD0, 0x3E, 0x72, 
+0x89, 0x27, 0x30, 0x87, 0x74, 0xD8, 0x83, 0x74, 0x3B, 0x98, 0xEA, 0x0A, 0xDB, 0xD3, 0xAE, 0x59, 0x96, 
+0xF3, 0xCE, 0xDF, 0x9D, 0x9C, 0xE5, 0xB1, 0xB1, 0x0C, 0xE7, 0x28, 0x64, 0x89, 0x7D, 0x38, 0xD9, 0x13, 
+0x54, 0x78, 0xA0, 0x23, 0x2D, 0x6C, 0x7B, 0xB8, 0xDB, 0xC8, 0x41, 0xCF, 0x10, 0xF1, 0x20, 0x87, 0xC6, 
+0xDB, 0x23, 0x0E, 0x6C, 0x15, 0x37, 0x59, 0x15, 0x83, 0xC9, 0xE3, 0x6E, 0xC5, 0x58, 0xA7, 0x60, 0xA3, 
+0xC5, 0xE7, 0xE1, 0x69, 0xAA, 0x8A, 0xB5, 0x53, 0x3E, 0xFE, 0xBA, 0xB0, 0x53, 0x16, 0xEA, 0x74, 0xA3, 
+0x3D, 0x8F, 0xC2, 0xA9, 0x7A, 0x48, 0xE1, 0x0F, 0x71, 0x34, 0x20, 0x01, 0xEA, 0x53, 0x12, 0x06, 0xE0, 
+0x52, 0x26, 0x54, 0x0C, 0x91, 0xCC, 0xF8, 0xF5, 0x0D, 0x04, 0x21, 0xEC, 0x08, 0x09, 0x3A, 0x52, 0x4F, 
+0x37, 0xE4, 0xB7, 0x67, 0x65, 0x2B, 0x2B, 0x3A, 0x9A, 0x5D, 0x02, 0x93, 0xF4, 0xB7, 0xCB, 0xF3, 0x33, 
+0x2F, 0x96, 0xEF, 0xDB, 0xB8, 0xB9, 0x90, 0xAB, 0x02, 0x07, 0x58, 0xB0, 0x2B, 0xC9, 0x3F, 0x90, 0x29, 
+0xA2, 0xD1, 0x8C, 0xCB, 0x26, 0x0B, 0x34, 0x80, 0x7F, 0x0F, 0x94, 0xBF, 0x82, 0xD4, 0x94, 0x52, 0x5D, 
+0x6E, 0x09, 0x4D, 0xFA, 0x50, 0xC4, 0x0B, 0xD9, 0x60, 0xA9, 0xC0, 0x62, 0x67, 0x97, 0x57, 0x96, 0xD9, 
+0xCF, 0x13, 0xB5, 0x66, 0xA2, 0xEF, 0x0D, 0xD2, 0x5F, 0x8B, 0xD8, 0x2B, 0xD8, 0x1B, 0x06, 0xC7, 0x9B, 
+0x59, 0x47, 0x2A, 0x52, 0xDF, 0x7F, 0xC3, 0x06, 0x03, 0xB0, 0xE1, 0x31, 0x0F, 0x6B, 0xF2, 0xF8, 0x13, 
+0xF5, 0x6B, 0x48, 0xBE, 0xC1, 0x94, 0xD6, 0xAA, 0xAC, 0x35, 0x7F, 0xA3, 0x0F, 0x80, 0x6E, 0x5C, 0x65, 
+0xD7, 0xF2, 0x15, 0x67, 0x59, 0xA6, 0x93, 0xDF, 0xDB, 0x3F, 0x26, 0xC8, 0x24, 0x8C, 0xD8, 0xC4, 0x70, 
+0x09, 0xC8, 0xAD, 0xE6, 0x54, 0xC4, 0xFD, 0x31, 0x97, 0x27, 0xDE, 0x03, 0xFD, 0x4C, 0x41, 0x0A, 0x39, 
+0x96, 0xE7, 0xE6, 0xAB, 0xFB, 0xC8, 0x4A, 0x22, 0xFB, 0x2A, 0xF3, 0xEF, 0x9A, 0xD4, 0xB2, 0x9A, 0xA8, 
+0x49, 0x61, 0x86, 0x9C, 0x86, 0x63, 0x9D, 0xE4, 0x67, 0xC8, 0x5D, 0x21, 0x7B, 0x0B, 0x29, 0xE1, 0xD0, 
+0xAD, 0x3E, 0x83, 0xAC, 0x4C, 0xD3, 0xA2, 0x1C, 0xE2, 0x15, 0xDA, 0xD7, 0xE3, 0x30, 0xFC, 0x45, 0x56, 
+0x6B, 0x95, 0x58, 0xF4, 0x17, 0xF8, 0x57, 0x82, 0xFA, 0x47, 0xC0, 0x32, 0xD1, 0xA4, 0xED, 0x52, 0x84, 
+0x6F, 0x69, 0x34, 0x16, 0x64, 0x41, 0x5A, 0x9C, 0xF2, 0x92, 0xC0, 0x6A, 0x0A, 0x80, 0x72, 0xFF, 0x49, 
+0x5E, 0x71, 0x7A, 0x06, 0x72, 0xA1, 0x6A, 0xA8, 0x9C, 0x95, 0xC5, 0xC2, 0x59, 0x9A, 0x7B, 0x55, 0x6E, 
+0x46, 0x9F, 0xA1, 0xDE, 0xEC, 0xBC, 0x97, 0x4B, 0x13, 0x4C, 0x4F, 0x63, 0x92, 0x2E, 0xD5, 0xF2, 0x55, 
+0x68, 0x73, 0xAD, 0xFD, 0x31, 0x6A, 0xD1, 0xD9, 0xC1, 0xD3, 0xC3, 0x06, 0x4B, 0xDA, 0x49, 0xFD, 0x69, 
+0x82, 0xA5, 0x74, 0x38, 0xFF, 0x97, 0xC1, 0x52, 0xBA, 0xC7, 0xFC, 0x01, 0x82, 0xA4, 0xF5, 0xBD, 0x19, 
+0x02, 0x82, 0xBB, 0xEE, 0xC9, 0xC5, 0x1E, 0xBA, 0x1F, 0xE9, 0x08, 0x44, 0xEF, 0xCA, 0x86, 0x8B, 0x90, 
+0xAF, 0x0D, 0xC7, 0x63, 0x31, 0xBF, 0xE2, 0x42, 0xE4, 0x6D, 0xD4, 0xE0, 0x29, 0x5E, 0xD1, 0x08, 0xF3, 
+0x29, 0x04, 0x71, 0x18, 0x0C, 0xA2, 0x96, 0x1E, 0xB9, 0xE5, 0x89, 0x40, 0xBD, 0x29, 0xD8, 0x31, 0x4D, 
+0xD4, 0x1D, 0x79, 0x6A, 0xC2, 0xCB, 0x74, 0xB3, 0xAF, 0x2F, 0x0E, 0xDF, 0x9E, 0xFC, 0x76, 0x7C, 0x78, 
+0x75, 0x08, 0x86, 0xD4, 0xDA, 0xCF, 0xE9, 0xF3, 0xEE, 0xF4, 0xEC, 0xAF, 0xD0, 0x67, 0x27, 0xB7, 0xCF, 
+0xB9, 0xEA, 0xB3, 0x6B, 0xD9, 0xC8, 0x13, 0xE6, 0x7F, 0x20, 0xD2, 0xAD, 0x44, 0xB0, 0xCB, 0xD9, 0xCE, 
+0x04, 0xF8, 0x2C, 0x20, 0x3C, 0xDD, 0xBB, 0xA5, 0x2F, 0x3E, 0xD6, 0x77, 0x5C, 0xCB, 0x21, 0x02, 0x12, 
+0xAD, 0x12, 0x9C, 0x44, 0xB9, 0x04, 0x31, 0x8D, 0x06, 0x49, 0x7A, 0xDE, 0xC0, 0xD6, 0x7E, 0x1A, 0x40, 
+0x87, 0xA6, 0x6D, 0x14, 0xF2, 0x00, 0xD0, 0xD2, 0x9E, 0x04, 0xE8, 0xD6, 0x50, 0x8C, 0xA7, 0x21, 0xC3, 
+0x81, 0xCD, 0xDA, 0x95, 0xA5, 0xA7, 0x00, 0x80, 0xBF, 0xD6, 0xBF, 0x56, 0x5C, 0xCE, 0xCF, 0xA4, 0x77, 
+0xA9, 0xEF, 0x6F, 0x72, 0x38, 0x79, 0x46, 0x7F, 0x6B, 0xDD, 0x1C, 0x95, 0x91, 0xA4, 0x48, 0xFD, 0x44, 
+0x23, 0xF1, 0xE2, 0x90, 0x73, 0x3C, 0x75, 0x53, 0xCD, 0xBD, 0x90, 0x44, 0x03, 0x48, 0x0D, 0x9E, 0xA1, 
+0x96, 0xC5, 0xEE, 0x15, 0xFD, 0xFB, 0xA6, 0x8C, 0xC2, 0xE5, 0x98, 0x73, 0x3A, 0x79, 0xF2, 0xE1, 0x72, 
+0xCA, 0xB7, 0x66, 0xE5, 0x97, 0x82, 0x20, 0x01, 0x75, 0x15, 0x59, 0xB5, 0x4C, 0x78, 0x00, 0xD1, 0x19, 
+0x5E, 0x9A, 0x07, 0xB5, 0x62, 0x73, 0x62, 0x03, 0xB9, 0xCE, 0x72, 0x8E, 0x4A, 0x98, 0x3B, 0xF5, 0xBE, 
+0x95, 0x89, 0x3C, 0xDD, 0xB5, 0x5D, 0x84, 0x21, 0x29, 0x97, 0x42, 0x8C, 0xD4, 0xD6, 0x3D, 0xFD, 0xED, 
+0xE6, 0x38, 0x1C, 0xA9, 0xDA, 0x52, 0xF0, 0x20, 0x79, 0xD9, 0xA3, 0x87, 0xBF, 0x13, 0x12, 0xAB, 0x75, 
+0x1F, 0x62, 0x70, 0x04, 0xB2, 0x6F, 0x82, 0x18, 0xA4, 0x83, 0xD9, 0x89, 0xDD, 0x64, 0x28, 0x8F, 0xE8, 
+0xAB, 0xE1, 0x7B, 0xBE, 0xE4, 0x7E, 0x06, 0xDA, 0x24, 0x33, 0x6B, 0x38, 0x40, 0x3B, 0xCD, 0x66, 0x9E, 
+0x29, 0x2A, 0xBA, 0xB4, 0xB2, 0xA4, 0x74, 0x53, 0x37, 0x94, 0x0F, 0x52, 0xD7, 0xD5, 0x52, 0x56, 0x2A, 
+0x69, 0x67, 0x51, 0x4F, 0x9C, 0x26, 0x1E, 0x4B, 0x31, 0x4C, 0x61, 0x0B, 0x91, 0xEB, 0xB8, 0x50, 0xDA, 
+0x30, 0x5F, 0xF0, 0x6E, 0xFA, 0x4B, 0x2E, 0x00, 0xF4, 0x0D, 0x6A, 0xDE, 0xBC, 0x86, 0xCF, 0xBE, 0x95, 
+0x26, 0x79, 0xAF, 0xFB, 0xCB, 0xE5, 0x10, 0x13, 0x2E, 0x8F, 0x0E, 0xE2, 0x08, 0x76, 0x44, 0x15, 0x33, 
+0x5A, 0x0C, 0x5E, 0x5A, 0xFA, 0xC2, 0x9D, 0xD6, 0x56, 0x57, 0x62, 0xCA, 0x51, 0x1E, 0x8B, 0x79, 0x51, 
+0x9B, 0x29, 0xA6, 0x35, 0xF9, 0xB5, 0x5A, 0x7C, 0x71, 0xC4, 0x6C, 0x65, 0xE8, 0x9B, 0x56, 0x06, 0x55, 
+0xC3, 0x97, 0xBD, 0xE4, 0xEA, 0xEE, 0x74, 0xD0, 0x8B, 0x2A, 0xFA, 0x84, 0xD4, 0x75, 0xCB, 0x92, 0x64, 
+0x4B, 0x7F, 0xA6, 0x51, 0xA0, 0x12, 0x81, 0x6E, 0x17, 0x8D, 0xA3, 0x80, 0xF4, 0xC1, 0xD6, 0x82, 0xFB, 
+0x77, 0x5C, 0xB0, 0x0D, 0x66, 0x81, 0x8C, 0xEA, 0x68, 0xAE, 0x82, 0x25, 0x2A, 0x27, 0xF2, 0xFC, 0xE5, 
+0xC6, 0x5E, 0x16, 0x8F, 0x60, 0xEC, 0xBE, 0x4B, 0x0B, 0x17, 0xEE, 0x7B, 0x82, 0xBD, 0xA6, 0x37, 0x24, 
+0x70, 0x5B, 0x3A, 0x51, 0x1B, 0x25, 0x4E, 0xE1, 0xE9, 0x81, 0x84, 0x29, 0x22, 0xBE, 0x28, 0x64, 0x9C, 
+0x8B, 0x2D, 0x13, 0x2C, 0x65, 0xBE, 0x3F, 0xB8, 0xCE, 0x24, 0x69, 0x37, 0x1A, 0x32, 0x50, 0x09, 0x99, 
+0xAF, 0x4A, 0x12, 0xDE, 0x90, 0xC1, 0x5A, 0x7F, 0x86, 0xB2, 0x8F, 0xDB, 0x19, 0xDE, 0xB6, 0xA7, 0x02, 
+0x06, 0x75, 0x9A, 0x15, 0xB2, 0x1C, 0x2C, 0xED, 0xAE, 0x37, 0xEE, 0xF7, 0x09, 0x77, 0x72, 0xC9, 0x58, 
+0xE4, 0xCB, 0x68, 0xB6, 0x90, 0xD2, 0xDB, 0x60, 0xEA, 0xD4, 0x1D, 0x7B, 0x0C, 0x07, 0xBB, 0xC9, 0x15, 
+0x24, 0x8F, 0x6C, 0x2C, 0xDC, 0x14, 0xBC, 0x9A, 0x74, 0x4B, 0xCD, 0x72, 0x61, 0xEB, 0x7C, 0x24, 0xA3, 
+0x8C, 0xC4, 0x32, 0x37, 0x4C, 0xCD, 0xD9, 0x3C, 0x37, 0x56, 0xBE, 0xE4, 0x42, 0xD1, 0x7B, 0x62, 0xEA, 
+0x51, 0xBB, 0xF2, 0x9C, 0xDB, 0x83, 0x05, 0xB5, 0x73, 0x71, 0x6A, 0x9F, 0xEE, 0x1A, 0x01, 0x5E, 0x81, 
+0x04, 0x46, 0x6E, 0xA9, 0xA9, 0xB2, 0xC9, 0xB8, 0xA7, 0x6C, 0x03, 0x0C, 0xBC, 0xBA, 0x8D, 0x1E, 0xEA, 
+0x61, 0x41, 0xB6, 0x32, 0x32, 0x4A, 0xDC, 0xA4, 0x8C, 0x74, 0x61, 0xF7, 0xA0, 0xC9, 0xED, 0xD6, 0x19, 
+0x6F, 0x7E, 0x99, 0x49, 0x9F, 0x29, 0xCF, 0x39, 0x76, 0x69, 0x44, 0xF1, 0xF6, 0x7D, 0x1A, 0x92, 0x0E, 
+0x08, 0xDD, 0x65, 0x45, 0x74, 0xC0, 0x60, 0x8B, 0xC6, 0x02, 0x76, 0x69, 0x9F, 0xD4, 0x16, 0x47, 0xCB, 
+0x81, 0x3F, 0xD1, 0x11, 0x3C, 0xF1, 0x87, 0x2C, 0x7B, 0xFB, 0x56, 0xA2, 0x32, 0x6A, 0xD6, 0xC0, 0x36, 
+0x60, 0x93, 0xC8, 0xA8, 0x57, 0x17, 0x30, 0x72, 0xA1, 0x17, 0x63, 0x76, 0x7C, 0xBE, 0x9C, 0x34, 0x4B, 
+0xB5, 0x61, 0x4A, 0x1D, 0x75, 0xF8, 0xDD, 0xD9, 0x34, 0x9F, 0x29, 0x63, 0xE7, 0x5F, 0x91, 0x73, 0x27, 
+0x6B, 0x52, 0x72, 0x8D, 0x95, 0xD4, 0x2A, 0x28, 0x58, 0xD1, 0x6D, 0xBB, 0x9E, 0x14, 0x8F, 0xA7, 0x5D, 
+0x8D, 0xCB, 0x26, 0x81, 0xC6, 0x1E, 0x2F, 0x57, 0x5D, 0x6D, 0x96, 0xA1, 0x78, 0xFA, 0x5B, 0x57, 0xB0, 
+0x72, 0x0C, 0x79, 0x31, 0xA7, 0xD7, 0xF2, 0x70, 0xB7, 0x04, 0xCD, 0xC9, 0xEF, 0x4D, 0xBC, 0x98, 0xAB, 
+0x94, 0xFC, 0x98, 0xF4, 0xF1, 0x38, 0x14, 0x6E, 0xF9, 0x65, 0x62, 0xA1, 0x48, 0x9D, 0xAD, 0x3D, 0x9C, 
+0x11, 0xA7, 0x72, 0xF6, 0x41, 0x51, 0x15, 0x0B, 0x58, 0x9D, 0x72, 0xC1, 0xAC, 0x98, 0x93, 0x84, 0xFE, 
+0x87, 0x1C, 0x0F, 0x7A, 0x2B, 0xCF, 0xEA, 0x3E, 0x66, 0x6E, 0xA3, 0xFA, 0x4F, 0x34, 0x65, 0x2F, 0xC2, 
+0xE4, 0xD5, 0x54, 0x3D, 0x5F, 0x3C, 0x03, 0x07, 0xA2, 0x4E, 0x8F, 0xA8, 0x77, 0xDB, 0x2A, 0x55, 0xF0, 
+0x43, 0x9E, 0x1F, 0x52, 0xE8, 0x61, 0x8B, 0x26, 0x69, 0xDF, 0x4D, 0x19, 0x77, 0x74, 0xE4, 0x3B, 0x17, 
+0x03, 0x57, 0x19, 0x7F, 0xD0, 0xC8, 0xE2, 0x00, 0x2A, 0x41, 0x6F, 0x50, 0xA9, 0x7A, 0xEA, 0x3C, 0xB5, 
+0x9C, 0xC2, 0xF4, 0xEF, 0x49, 0xC9, 0x1D, 0x3B, 0x65, 0xF8, 0x0C, 0x55, 0xE2, 0x9B, 0x4A, 0x2E, 0x30, 
+0x69, 0x15, 0x10, 0x42, 0x77, 0x48, 0xA3, 0x36, 0xFA, 0xA6, 0xC5, 0x49, 0x7D, 0x67, 0xF6, 0x3A, 0x80, 
+0xB2, 0x0A, 0x19, 0x99, 0x64, 0x76, 0x0E, 0x75, 0x95, 0x4A, 0x6F, 0x69, 0xE6, 0x63, 0x02, 0x07, 0x5A, 
+0x1C, 0xF8, 0x52, 0x07, 0x68, 0x33, 0x5E, 0x95, 0x56, 0x5D, 0x95, 0xC3, 0x74, 0x6D, 0x35, 0x7B, 0xED, 
+0xBE, 0x34, 0x6B, 0xE3, 0x0D, 0x83, 0x8C, 0x97, 0xAB, 0x65, 0x5B, 0x01, 0x5E, 0x69, 0xC5, 0x24, 0x65, 
+0x39, 0xAB, 0x9F, 0xCC, 0x47, 0x3A, 0x7B, 0x31, 0x09, 0xB4, 0x5E, 0xFF, 0x99, 0xBE, 0xE4, 0x63, 0xDC, 
+0x90, 0xAF, 0xC3, 0xD8, 0x94, 0x49, 0x79, 0xDB, 0x75, 0x32, 0xCC, 0xB4, 0xD8, 0xF4, 0x69, 0x02, 0xFB, 
+0xB3, 0xE8, 0x8F, 0x65, 0x44, 0xCC, 0x7E, 0x2D, 0xBF, 0x39, 0xD3, 0x69, 0xE8, 0x57, 0x99, 0x3B, 0x0D, 
+0xFD, 0x17, 0xF3, 0xFE, 0x07, 0x6C, 0x32, 0xE5, 0x74, 0x42, 0x4F, 0x00, 0x00};#endif // _BZF_APP_H
\ No newline at end of file
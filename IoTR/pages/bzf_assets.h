@@ -0,0 +1 @@
+// // bzf_assets.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_ASSETS_H#define _BZF_ASSETS_H #include "bzf_app.h"#include "bzf_dashboard.h"#include "bzf_dev_status.h"#include "bzf_edit.h"#include "bzf_favicon.h"#include "bzf_help.h"#include "bzf_login.h"#include "bzf_logo.h"#include "bzf_logo_white.h"#include "bzf_microajax.h"#include "bzf_mqtt.h"#include "bzf_network.h"#include "bzf_reset.h"#include "bzf_settings.h"#include "bzf_style.h"#define BZF_ASSETS_COUNT 15// Sorted by path.#define BZF_ASSETS_TABLE \	{ BZF_APP_PATH, BZF_APP_MT, bzf_app, BZF_APP_SIZE, BZF_APP_HASH }, \	{ BZF_DASHBOARD_PATH, BZF_DASHBOARD_MT, bzf_dashboard, BZF_DASHBOARD_SIZE, BZF_DASHBOARD_HASH }, \	{ BZF_DEV_STATUS_PATH, BZF_DEV_STATUS_MT, bzf_dev_status, BZF_DEV_STATUS_SIZE, BZF_DEV_STATUS_HASH }, \	{ BZF_EDIT_PATH, BZF_EDIT_MT, bzf_edit, BZF_EDIT_SIZE, BZF_EDIT_HASH }, \	{ BZF_FAVICON_PATH, BZF_FAVICON_MT, bzf_favicon, BZF_FAVICON_SIZE, BZF_FAVICON_HASH }, \	{ BZF_HELP_PATH, BZF_HELP_MT, bzf_help, BZF_HELP_SIZE, BZF_HELP_HASH }, \	{ BZF_LOGIN_PATH, BZF_LOGIN_MT, bzf_login, BZF_LOGIN_SIZE, BZF_LOGIN_HASH }, \	{ BZF_LOGO_PATH, BZF_LOGO_MT, bzf_logo, BZF_LOGO_SIZE, BZF_LOGO_HASH }, \	{ BZF_LOGO_WHITE_PATH, BZF_LOGO_WHITE_MT, bzf_logo_white, BZF_LOGO_WHITE_SIZE, BZF_LOGO_WHITE_HASH }, \	{ BZF_MICROAJAX_PATH, BZF_MICROAJAX_MT, bzf_microajax, BZF_MICROAJAX_SIZE, BZF_MICROAJAX_HASH }, \	{ BZF_MQTT_PATH, BZF_MQTT_MT, bzf_mqtt, BZF_MQTT_SIZE, BZF_MQTT_HASH }, \	{ BZF_NETWORK_PATH, BZF_NETWORK_MT, bzf_network, BZF_NETWORK_SIZE, BZF_NETWORK_HASH }, \	{ BZF_RESET_PATH, BZF_RESET_MT, bzf_reset, BZF_RESET_SIZE, BZF_RESET_HASH }, \	{ BZF_SETTINGS_PATH, BZF_SETTINGS_MT, bzf_settings, BZF_SETTINGS_SIZE, BZF_SETTINGS_HASH }, \	{ BZF_STYLE_PATH, BZF_STYLE_MT, bzf_style, BZF_STYLE_SIZE, BZF_STYLE_HASH }#endif // _BZF_ASSETS_H
\ No newline at end of file
@@ -1,4 +1,4 @@
-// // bzf_dashboard.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_DASHBOARD_H#define _BZF_DASHBOARD_H #define BZF_DASHBOARD_MT "text/html"#define BZF_DASHBOARD_PATH "/dashboard.html"#define BZF_DASHBOARD_SIZE 947const uint8_t bzf_dashboard[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0xBD, 0x57, 0x51, 0x6F, 0xDB, 0x36, 0x10, 
+// // bzf_dashboard.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_DASHBOARD_H#define _BZF_DASHBOARD_H #define BZF_DASHBOARD_MT "text/html"#define BZF_DASHBOARD_PATH "/dashboard.html"#define BZF_DASHBOARD_SIZE 947#define BZF_DASHBOARD_HASH 0x15155A9DULconst uint8_t bzf_dashboard[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xBD, 0x57, 0x51, 0x6F, 0xDB, 0x36, 0x10, 
 0x7E, 0x2F, 0xD0, 0xFF, 0x70, 0x25, 0x30, 0x20, 0x05, 0x46, 0x4B, 0x1E, 0x56, 0xAC, 0x68, 0x24, 0x01, 
 0x59, 0x5D, 0xA0, 0x01, 0xBA, 0xA6, 0x4B, 0xD2, 0x61, 0x7B, 0x0A, 0x68, 0x91, 0x96, 0x98, 0x50, 0xA4, 
 0x4A, 0x52, 0xB2, 0x83, 0xAD, 0xFF, 0x7D, 0x47, 0xC9, 0xD9, 0x64, 0x39, 0x76, 0x32, 0x63, 0xA9, 0x21, 
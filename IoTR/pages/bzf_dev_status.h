@@ -1,51 +1,57 @@
-// // bzf_dev_status.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_DEV_STATUS_H#define _BZF_DEV_STATUS_H #define BZF_DEV_STATUS_MT "application/javascript"#define BZF_DEV_STATUS_PATH "/dev_status.js"#define BZF_DEV_STATUS_SIZE 852const uint8_t bzf_dev_status[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0x9D, 0x55, 0x4B, 0x4F, 0xDB, 0x40, 0x10, 
-0xBE, 0x23, 0xF1, 0x1F, 0x06, 0x4B, 0x15, 0x0E, 0x10, 0x3B, 0xA8, 0xB7, 0x50, 0x2E, 0x3C, 0x5A, 0x5A, 
-0x01, 0x41, 0x02, 0xA9, 0x87, 0x0A, 0xA1, 0x8D, 0x77, 0x93, 0x6C, 0x6B, 0xEF, 0xBA, 0xBB, 0xE3, 0x24, 
-0xB4, 0xE2, 0xBF, 0x77, 0x76, 0xED, 0x3C, 0x1C, 0x9B, 0xD0, 0xD6, 0x07, 0x67, 0x33, 0x3B, 0x33, 0xDF, 
-0x37, 0x4F, 0x8F, 0x0A, 0x95, 0xA0, 0xD4, 0x0A, 0x2E, 0xC4, 0x54, 0x26, 0xE2, 0x1E, 0x19, 0x16, 0x36, 
-0x2C, 0x4C, 0xDA, 0x81, 0xDF, 0xBB, 0x3B, 0xBB, 0x3B, 0x40, 0xCF, 0x94, 0x19, 0x20, 0x09, 0x9C, 0xBA, 
-0xF7, 0xC9, 0xBA, 0x54, 0x4C, 0x85, 0xC2, 0x7B, 0x5D, 0x98, 0x44, 0xD0, 0xAD, 0x12, 0x33, 0xB8, 0x5C, 
-0x49, 0xBC, 0x97, 0xA5, 0xFA, 0x68, 0x01, 0x34, 0xD2, 0x26, 0x63, 0xF8, 0x30, 0xD3, 0x17, 0x72, 0x2C, 
-0xD1, 0x86, 0xD2, 0x23, 0x41, 0xF5, 0xC8, 0x11, 0x84, 0x12, 0x3E, 0xC0, 0x71, 0x8F, 0xC4, 0x10, 0xC7, 
-0xC0, 0x38, 0x87, 0x5F, 0xC2, 0x68, 0x90, 0x64, 0x6A, 0xB4, 0x42, 0xD0, 0x23, 0x50, 0x45, 0x36, 0x14, 
-0xC6, 0x7A, 0xBD, 0x95, 0xAD, 0xB7, 0x27, 0x1E, 0xFB, 0xBD, 0x7D, 0x38, 0x04, 0xB9, 0xBA, 0x78, 0x59, 
-0x1D, 0x8D, 0xC0, 0xC2, 0x28, 0x90, 0x27, 0xA5, 0xE8, 0xA5, 0x41, 0x0F, 0xF5, 0x9D, 0x20, 0xF2, 0x0A, 
-0xD9, 0x58, 0x84, 0x7C, 0x98, 0xD5, 0xD8, 0x11, 0x9F, 0x09, 0x62, 0x6E, 0xFB, 0x71, 0x3C, 0x9B, 0xCD, 
-0x22, 0xC6, 0x8D, 0x64, 0x6A, 0x6C, 0x98, 0x62, 0x5C, 0xDB, 0x28, 0xD1, 0x59, 0x3C, 0x4C, 0xF5, 0x38, 
-0x26, 0xB3, 0x2E, 0xEA, 0x6E, 0x5E, 0x3A, 0xEA, 0x26, 0x5A, 0x4D, 0x89, 0x2D, 0x79, 0xAF, 0x79, 0x3A, 
-0xEE, 0xF5, 0x60, 0x0E, 0xE1, 0x31, 0x74, 0x21, 0xBC, 0xE3, 0x67, 0xD9, 0x53, 0xC6, 0xE6, 0x74, 0x76, 
-0xC7, 0x0E, 0xC4, 0x0D, 0xD9, 0x53, 0x26, 0x55, 0xA7, 0xD3, 0x88, 0xC4, 0x79, 0x39, 0xA8, 0xBC, 0xF4, 
-0xE8, 0xE5, 0x28, 0xC7, 0xFE, 0xD4, 0xA5, 0xAB, 0x4E, 0x67, 0x33, 0x50, 0x9C, 0x48, 0x1B, 0x49, 0x25, 
-0x91, 0x12, 0xB5, 0x08, 0x3A, 0xAC, 0x05, 0xB9, 0x56, 0xD4, 0x48, 0x2B, 0x9D, 0x0B, 0xB5, 0xAE, 0x2A, 
-0x6A, 0xBA, 0xEE, 0xA1, 0xF0, 0xAC, 0x4E, 0x45, 0x44, 0x91, 0x87, 0x41, 0xD9, 0x46, 0x60, 0x7D, 0x1F, 
-0xF5, 0x61, 0x40, 0xD6, 0x82, 0x07, 0x0B, 0x16, 0x9E, 0xC9, 0xC9, 0x6B, 0x50, 0xC2, 0x18, 0x6D, 0xB6, 
-0x63, 0xB9, 0xF6, 0x10, 0x11, 0x32, 0x33, 0x16, 0x18, 0x19, 0xC1, 0xF8, 0xB3, 0xEB, 0x58, 0x01, 0x7B, 
-0xA7, 0xEB, 0x9D, 0x17, 0x0D, 0xEE, 0x2E, 0x6F, 0x1B, 0xB6, 0x6F, 0x71, 0x3D, 0x4F, 0xB5, 0xDD, 0xE0, 
-0xBA, 0xD1, 0x3C, 0xAF, 0x53, 0xCF, 0x84, 0xB5, 0xD4, 0x30, 0xFF, 0x9F, 0xA8, 0x80, 0x3A, 0x56, 0x44, 
-0x9C, 0x21, 0xFB, 0x9B, 0x5C, 0xD1, 0x50, 0xF8, 0x70, 0xAF, 0xA5, 0x45, 0x4A, 0xB0, 0x09, 0x03, 0xBE, 
-0x36, 0xBE, 0xC1, 0xD1, 0x5B, 0x29, 0xDC, 0xAB, 0xA0, 0xEA, 0x37, 0x2D, 0xF9, 0x2A, 0x9B, 0xAC, 0x99, 
-0x91, 0xBA, 0xC0, 0xAD, 0x82, 0x32, 0x10, 0x4A, 0xC0, 0x97, 0xFB, 0xC1, 0x6D, 0x94, 0x33, 0x63, 0x45, 
-0xD8, 0x0C, 0x68, 0xB9, 0x4E, 0x94, 0x9C, 0x3F, 0xA1, 0xA4, 0xB4, 0x21, 0xCB, 0x72, 0xB2, 0x2A, 0xCD, 
-0xBF, 0x05, 0x68, 0x83, 0xC7, 0x0D, 0x7D, 0x1A, 0x95, 0x73, 0x2A, 0x35, 0x55, 0x99, 0xF9, 0x15, 0xF3, 
-0x85, 0x4D, 0xD9, 0x7D, 0x62, 0x64, 0x8E, 0x70, 0xE1, 0xA4, 0x7A, 0xF8, 0x5D, 0x24, 0x08, 0x43, 0x46, 
-0xD5, 0x03, 0x37, 0xC1, 0x13, 0x01, 0x4B, 0xD7, 0x0D, 0x57, 0x59, 0x91, 0xA2, 0xCC, 0x53, 0x49, 0xBA, 
-0xC3, 0x67, 0x37, 0x3D, 0x3D, 0xB0, 0x9A, 0x6C, 0x18, 0x7A, 0x43, 0xEA, 0xAC, 0x22, 0xA3, 0xCC, 0x82, 
-0xB4, 0x6E, 0xE3, 0x64, 0x32, 0x4D, 0xA5, 0x15, 0x54, 0x39, 0x6E, 0x8F, 0x40, 0x69, 0x84, 0xEA, 0x4F, 
-0xD4, 0x8C, 0x89, 0x3B, 0x32, 0xE5, 0x16, 0x74, 0xBC, 0xC2, 0x8D, 0x18, 0x0F, 0x3C, 0x58, 0xA7, 0x19, 
-0xDC, 0x15, 0xD5, 0xD4, 0x02, 0x65, 0x0C, 0xDD, 0x82, 0xCB, 0xB6, 0xF1, 0x77, 0x30, 0x13, 0xAF, 0x7E, 
-0xDA, 0xD8, 0xA3, 0x0E, 0x3E, 0xA2, 0xB1, 0xF0, 0xEE, 0xC2, 0x4E, 0x0B, 0xD0, 0x8D, 0x54, 0x05, 0x8A, 
-0x7F, 0x80, 0xCA, 0x2A, 0x83, 0xD7, 0xC1, 0x2A, 0x97, 0x25, 0x5C, 0x03, 0xF0, 0x2B, 0x65, 0x0F, 0xB8, 
-0xB4, 0x79, 0xCA, 0x9E, 0x3D, 0x8E, 0x4B, 0xE9, 0x71, 0xAF, 0xFF, 0xBE, 0x57, 0x39, 0x6C, 0x42, 0x96, 
-0x72, 0x14, 0xFC, 0xC1, 0xA9, 0x9F, 0x56, 0xD1, 0x1E, 0xC2, 0x7E, 0xDF, 0xED, 0xF4, 0x8A, 0x50, 0x4B, 
-0x43, 0x25, 0xA9, 0x4E, 0x7E, 0x90, 0x3E, 0xD7, 0x89, 0xAF, 0x9F, 0x23, 0x77, 0x99, 0x0A, 0x77, 0x3C, 
-0x7B, 0xFE, 0xCC, 0xC3, 0x60, 0xD2, 0xF5, 0x2A, 0x8D, 0xF1, 0xF6, 0x52, 0x5A, 0x88, 0x34, 0x45, 0x57, 
-0x0F, 0x37, 0xD7, 0xCB, 0x58, 0x2B, 0x0A, 0x27, 0xAD, 0xBD, 0x6E, 0x25, 0xDF, 0x8E, 0xE5, 0x34, 0x1A, 
-0x50, 0x4E, 0x58, 0x43, 0x5A, 0x34, 0xBD, 0xD7, 0x7E, 0x6C, 0x85, 0x32, 0x74, 0xB7, 0x1D, 0xCA, 0x69, 
-0x04, 0x6D, 0x33, 0x96, 0x2F, 0xBF, 0x63, 0xE4, 0xA0, 0xF6, 0x59, 0x5B, 0xE0, 0x7A, 0xD3, 0xC7, 0x4D, 
-0x5B, 0x27, 0xAD, 0xD1, 0x5C, 0x39, 0x8A, 0x50, 0x7F, 0x94, 0x73, 0xC1, 0x43, 0xFA, 0x3A, 0x1F, 0x42, 
-0xF0, 0x2E, 0x68, 0xE5, 0x3C, 0xD5, 0x69, 0x85, 0xBA, 0x85, 0x76, 0xA5, 0xD4, 0x64, 0x5E, 0xCA, 0x5B, 
-0xF3, 0xB4, 0xB0, 0x79, 0x7C, 0x05, 0x9C, 0x5A, 0xEE, 0x61, 0x70, 0x31, 0xE8, 0xC3, 0x27, 0x41, 0x03, 
-0x5C, 0xF5, 0xF8, 0x28, 0x65, 0xE3, 0xCD, 0x71, 0x8D, 0x63, 0xDF, 0xDE, 0x3F, 0x11, 0xB7, 0x93, 0x74, 
-0x1A, 0x41, 0x73, 0x92, 0x9C, 0xB8, 0x95, 0xA0, 0xBB, 0x78, 0xA2, 0xFD, 0xA0, 0x36, 0xAA, 0xF9, 0x42, 
-0x1B, 0x99, 0xA5, 0x56, 0x2C, 0xBF, 0xC6, 0xF4, 0xFB, 0xF2, 0x07, 0x01, 0x09, 0x1E, 0xDB, 0x7B, 0x09, 
-0x00, 0x00};#endif // _BZF_DEV_STATUS_H
\ No newline at end of file
+// // bzf_dev_status.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_DEV_STATUS_H#define _BZF_DEV_STATUS_H #define BZF_DEV_STATUS_MT "application/javascript"#define BZF_DEV_STATUS_PATH "/dev_status.js"#define BZF_DEV_STATUS_SIZE 965#define BZF_DEV_STATUS_HASH 0x9352DB34ULconst uint8_t bzf_dev_status[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9D, 0x56, 0xDF, 0x6F, 0xDB, 0x38, 0x0C, 
+0x7E, 0xEF, 0x5F, 0xC1, 0x19, 0x38, 0xD4, 0x59, 0x13, 0x27, 0xC5, 0xBD, 0x25, 0xCB, 0xCB, 0xD6, 0xDE, 
+0xED, 0x86, 0x6D, 0x29, 0xD0, 0x02, 0xF7, 0x70, 0x28, 0x0A, 0xC5, 0xA2, 0x13, 0xDD, 0x6C, 0xC9, 0x27, 
+0xC9, 0x49, 0xB3, 0xA1, 0xFF, 0xFB, 0x51, 0xB2, 0x92, 0xFA, 0x47, 0x9A, 0x0E, 0xF3, 0x43, 0x22, 0x53, 
+0x24, 0xBF, 0x8F, 0x14, 0x49, 0x39, 0xAB, 0x64, 0x6A, 0x85, 0x92, 0x70, 0x85, 0x1B, 0x91, 0xE2, 0xAD, 
+0x65, 0xB6, 0x32, 0x71, 0xA5, 0xF3, 0x01, 0xFC, 0x38, 0x3B, 0x03, 0x7A, 0x36, 0x4C, 0x03, 0xBD, 0xC3, 
+0xDC, 0xFD, 0xCE, 0x9E, 0x65, 0xB8, 0x41, 0x69, 0x6F, 0x55, 0xA5, 0x53, 0xA4, 0x3D, 0x89, 0x5B, 0xB8, 
+0x7E, 0x96, 0x78, 0x0F, 0x41, 0x79, 0x3C, 0xAE, 0x77, 0x0C, 0xA4, 0x4C, 0xEB, 0x1D, 0xD8, 0x35, 0x42, 
+0xBA, 0x66, 0x72, 0x85, 0x1C, 0x32, 0x81, 0x39, 0x37, 0xA0, 0x64, 0xBE, 0x1B, 0xC2, 0x56, 0xD8, 0x35, 
+0xB0, 0x3C, 0xDF, 0x4B, 0x33, 0xAD, 0x0A, 0xB0, 0xA2, 0x40, 0xB0, 0xCA, 0xFF, 0x27, 0x07, 0x70, 0xE3, 
+0x79, 0x12, 0xEE, 0x8F, 0xA7, 0x80, 0x92, 0xED, 0x03, 0xC9, 0x94, 0x2E, 0x98, 0xBD, 0xDB, 0xAA, 0x2B, 
+0xB1, 0x12, 0xD6, 0xC4, 0xC2, 0x45, 0x02, 0xE1, 0x11, 0x19, 0xC4, 0x02, 0xDE, 0xC1, 0xE5, 0x84, 0xA4, 
+0x8E, 0x19, 0xE3, 0x1C, 0xBE, 0xA3, 0x56, 0x20, 0xA4, 0xC3, 0x93, 0x16, 0x54, 0x06, 0xB2, 0x2A, 0x96, 
+0xA8, 0x8D, 0xD7, 0x3B, 0x98, 0x7A, 0x73, 0x42, 0x3C, 0x9F, 0x9C, 0xC3, 0x05, 0x88, 0x83, 0xFC, 0xE9, 
+0xB0, 0xD2, 0x68, 0x2B, 0x2D, 0x41, 0xCC, 0xCE, 0x6A, 0x79, 0x9B, 0x97, 0x55, 0x37, 0x48, 0x99, 0x91, 
+0x96, 0xAD, 0x30, 0xE6, 0xCB, 0xA2, 0x49, 0x8B, 0x88, 0xAC, 0xAD, 0x2D, 0xCD, 0x74, 0x3C, 0xDE, 0x6E, 
+0xB7, 0x09, 0xE3, 0x5A, 0x50, 0x7E, 0x34, 0x93, 0x8C, 0x2B, 0x93, 0xA4, 0xAA, 0x18, 0x2F, 0x73, 0xB5, 
+0x1A, 0x93, 0xD5, 0xC8, 0xAA, 0x51, 0x59, 0xFB, 0x19, 0xA5, 0x4A, 0x6E, 0x88, 0x26, 0x39, 0x6F, 0x3A, 
+0xBA, 0x9C, 0x4C, 0xE0, 0x11, 0xE2, 0x4B, 0x18, 0x41, 0x7C, 0xC3, 0xDF, 0x17, 0x0F, 0x05, 0x7B, 0xA4, 
+0xB5, 0x5B, 0x0E, 0x60, 0xDC, 0x93, 0x3D, 0x14, 0x42, 0x0E, 0x06, 0xDD, 0x18, 0x9C, 0x93, 0xB7, 0xC1, 
+0xC9, 0x84, 0x7E, 0x1C, 0xDF, 0xB1, 0x5F, 0x8D, 0x68, 0x6B, 0x30, 0x68, 0x85, 0x68, 0xD7, 0xC2, 0x10, 
+0x67, 0xEE, 0x4F, 0xF9, 0xB3, 0x30, 0x16, 0x25, 0x6A, 0xCA, 0xD4, 0x3E, 0xF4, 0xD8, 0xEE, 0x4A, 0x1C, 
+0x42, 0x1E, 0x76, 0x9A, 0x81, 0x37, 0x8A, 0xA8, 0xE7, 0xA1, 0x63, 0x36, 0x84, 0x8C, 0xE5, 0x06, 0xF7, 
+0xD0, 0xB3, 0x06, 0xB6, 0x90, 0xC2, 0x36, 0xF1, 0x5E, 0x42, 0x50, 0x52, 0x95, 0x28, 0x9B, 0x9A, 0xD8, 
+0x54, 0x75, 0x0F, 0xE5, 0xD4, 0xA8, 0x1C, 0x13, 0x4A, 0x77, 0x1C, 0xD5, 0x3D, 0x11, 0x8A, 0x6D, 0x0A, 
+0x0B, 0x32, 0x46, 0x1E, 0x05, 0x06, 0x81, 0xC5, 0x71, 0x1C, 0xD4, 0x5A, 0xE9, 0x93, 0x40, 0xAE, 0x12, 
+0x31, 0xB1, 0x4C, 0xAF, 0xD0, 0x26, 0x1A, 0x19, 0xDF, 0xB9, 0xDE, 0x43, 0x78, 0x33, 0x6F, 0xF6, 0x51, 
+0xB2, 0xB8, 0xB9, 0xFE, 0xDA, 0x35, 0x7D, 0x8D, 0xE7, 0x87, 0x5C, 0x99, 0x36, 0xCF, 0x76, 0x9D, 0xBE, 
+0xC8, 0xBA, 0x40, 0x63, 0xA8, 0x3A, 0x7F, 0x39, 0x41, 0x11, 0x35, 0x06, 0x26, 0x9C, 0x59, 0xF6, 0x7A, 
+0x8E, 0x7A, 0xA7, 0x1D, 0xF1, 0xC6, 0x04, 0x8A, 0x86, 0xAF, 0xA4, 0xEE, 0x4D, 0xC0, 0x69, 0x6D, 0xF4, 
+0xD3, 0x54, 0x97, 0x73, 0x37, 0x11, 0xAD, 0x57, 0x37, 0x4E, 0xEA, 0x71, 0xE4, 0xE6, 0xC9, 0xA7, 0xDB, 
+0xC5, 0xD7, 0xA4, 0x64, 0xDA, 0x60, 0xDC, 0x8B, 0xC4, 0xB7, 0x33, 0x1D, 0x6B, 0xEC, 0x4C, 0xBE, 0xE1, 
+0xCE, 0xCD, 0x8C, 0x60, 0x79, 0xEC, 0x88, 0xEA, 0xAC, 0xFC, 0x43, 0x8A, 0xF7, 0xE4, 0x38, 0x28, 0xFA, 
+0xD7, 0x93, 0x7C, 0x5C, 0x74, 0xC1, 0x34, 0x32, 0x46, 0xF0, 0x88, 0xAC, 0xE7, 0x34, 0x7C, 0x25, 0xC7, 
+0x4C, 0x50, 0xFD, 0x0D, 0x7E, 0x3D, 0xCC, 0x4A, 0x8A, 0xC7, 0x07, 0x37, 0x48, 0xC9, 0x7F, 0x51, 0x12, 
+0xA9, 0x3D, 0x8E, 0x35, 0x51, 0x87, 0x14, 0x0D, 0x92, 0x0F, 0x54, 0x95, 0x54, 0x90, 0xCC, 0xCF, 0xF6, 
+0x4F, 0x6C, 0xC3, 0x6E, 0x53, 0x2D, 0x4A, 0x0B, 0x57, 0x4E, 0xAA, 0x96, 0xFF, 0x62, 0x6A, 0x61, 0xC9, 
+0xA8, 0xD2, 0xC0, 0x4D, 0x37, 0x1A, 0xEA, 0x07, 0xCF, 0x5D, 0x4F, 0x45, 0x95, 0x5B, 0x51, 0xE6, 0x82, 
+0x54, 0x97, 0x3B, 0x37, 0x5B, 0x26, 0x60, 0x68, 0xA2, 0xAF, 0x99, 0xF5, 0x76, 0xD4, 0x03, 0x55, 0x41, 
+0xA5, 0x00, 0xC2, 0xB8, 0x94, 0x16, 0x22, 0xA7, 0x9E, 0x47, 0x2A, 0x34, 0x6E, 0x86, 0x20, 0x95, 0x85, 
+0xF0, 0x92, 0xF4, 0x02, 0xE2, 0x8E, 0x4A, 0x7D, 0xF9, 0x38, 0x56, 0x71, 0x27, 0xC0, 0xB7, 0x1E, 0x6B, 
+0xD0, 0x8B, 0xEC, 0x23, 0x95, 0xA0, 0x01, 0x3A, 0x65, 0x1B, 0xEE, 0x98, 0x17, 0xC9, 0x3B, 0x90, 0xB5, 
+0xD7, 0x9E, 0xF7, 0x2E, 0x16, 0x07, 0x9E, 0x50, 0xF7, 0x7A, 0x6F, 0xF1, 0xA0, 0x0F, 0xF3, 0x45, 0xC8, 
+0xCA, 0xE2, 0xCF, 0x03, 0x15, 0x41, 0xFF, 0x65, 0xA8, 0xE0, 0xD1, 0x83, 0x75, 0xD1, 0xFE, 0xA6, 0xB4, 
+0x01, 0x17, 0xA6, 0xCC, 0xD9, 0xAE, 0xBE, 0x35, 0x85, 0x9B, 0xE3, 0xD3, 0xDF, 0x27, 0xC1, 0x5D, 0x0F, 
+0xAF, 0x16, 0x5B, 0xE4, 0x77, 0x4E, 0x7B, 0x1E, 0x02, 0xBD, 0x80, 0xF3, 0xA9, 0xBB, 0xE1, 0x02, 0x9B, 
+0x59, 0xBF, 0x59, 0x72, 0x95, 0x7E, 0x23, 0x75, 0xAE, 0x52, 0x7F, 0x6C, 0x8E, 0xD8, 0x75, 0x8E, 0x6E, 
+0xF9, 0x7E, 0xF7, 0x17, 0x8F, 0xA3, 0xF5, 0xC8, 0xAB, 0x74, 0x07, 0x90, 0x17, 0xD2, 0xAC, 0xA6, 0x66, 
+0xFF, 0x78, 0xF7, 0xE5, 0xF3, 0x21, 0xCC, 0x40, 0x60, 0xD6, 0xAF, 0x57, 0x57, 0xFE, 0xA7, 0x81, 0x7C, 
+0x83, 0x74, 0x70, 0x9C, 0xAC, 0x05, 0xD3, 0xEE, 0xA6, 0x23, 0x38, 0x9A, 0x76, 0x4E, 0xE3, 0x38, 0x8D, 
+0x2E, 0x8E, 0xB3, 0x2C, 0x0F, 0x57, 0x3A, 0xD9, 0xB7, 0x6E, 0xF8, 0x3D, 0xA8, 0xB7, 0xBC, 0xEF, 0x98, 
+0x3A, 0x61, 0x8B, 0xE2, 0xB3, 0x9F, 0xC4, 0xAA, 0x3F, 0xC4, 0x23, 0xF2, 0x98, 0xBE, 0x50, 0x2E, 0x20, 
+0xFA, 0x2D, 0x3A, 0xC2, 0x77, 0xA3, 0xF2, 0x00, 0x79, 0x82, 0x72, 0x50, 0xEA, 0xB1, 0xAE, 0xC5, 0x47, 
+0x13, 0xB4, 0x37, 0xB9, 0x3F, 0x8A, 0x4C, 0x35, 0x76, 0xB7, 0xB8, 0x5A, 0x4C, 0xE1, 0x4F, 0xA4, 0x56, 
+0x0D, 0x15, 0x9D, 0xE5, 0x6C, 0xD5, 0x69, 0xCC, 0xF1, 0xD8, 0x17, 0xF3, 0x7F, 0xD6, 0x9E, 0x26, 0xE8, 
+0x34, 0xA2, 0x5E, 0xD7, 0x38, 0xE9, 0x51, 0x72, 0x6E, 0xE3, 0x81, 0xE6, 0x80, 0x6C, 0x1D, 0xE1, 0x53, 
+0xEF, 0xB3, 0xE0, 0xE9, 0x7F, 0x21, 0xFB, 0x7B, 0xBD, 0xD3, 0x0A, 0x00, 0x00};#endif // _BZF_DEV_STATUS_H
\ No newline at end of file
@@ -1,4 +1,4 @@
-// // bzf_edit.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_EDIT_H#define _BZF_EDIT_H #define BZF_EDIT_MT "text/html"#define BZF_EDIT_PATH "/edit.html"#define BZF_EDIT_SIZE 5723const uint8_t bzf_edit[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0xED, 0x3D, 0xFB, 0x7B, 0xDA, 0x48, 0x92, 
+// // bzf_edit.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_EDIT_H#define _BZF_EDIT_H #define BZF_EDIT_MT "text/html"#define BZF_EDIT_PATH "/edit.html"#define BZF_EDIT_SIZE 5723#define BZF_EDIT_HASH 0xCA4D2E94ULconst uint8_t bzf_edit[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0x3D, 0xFB, 0x7B, 0xDA, 0x48, 0x92, 
 0x3F, 0xEF, 0x7D, 0xDF, 0xFD, 0x0F, 0x1A, 0x65, 0x6F, 0x06, 0x86, 0x87, 0x30, 0xC6, 0x0E, 0xF1, 0x23, 
 0x39, 0xC0, 0x80, 0x6D, 0x20, 0x98, 0x87, 0x6D, 0xEC, 0x6C, 0x6E, 0x3F, 0x21, 0x35, 0x20, 0x5B, 0x48, 
 0xB2, 0x24, 0x0C, 0xD8, 0xE3, 0xFB, 0xDB, 0xAF, 0xBA, 0x5B, 0x02, 0x3D, 0x5A, 0x3C, 0x6C, 0x27, 0x3B, 
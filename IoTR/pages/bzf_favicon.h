@@ -1,4 +1,4 @@
-// // bzf_favicon.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_FAVICON_H#define _BZF_FAVICON_H #define BZF_FAVICON_MT "image/x-icon"#define BZF_FAVICON_PATH "/favicon.ico"#define BZF_FAVICON_SIZE 528const uint8_t bzf_favicon[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0x8D, 0xD3, 0x4F, 0x48, 0x14, 0x51, 0x1C, 
+// // bzf_favicon.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_FAVICON_H#define _BZF_FAVICON_H #define BZF_FAVICON_MT "image/x-icon"#define BZF_FAVICON_PATH "/favicon.ico"#define BZF_FAVICON_SIZE 528#define BZF_FAVICON_HASH 0xCE4FA663ULconst uint8_t bzf_favicon[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8D, 0xD3, 0x4F, 0x48, 0x14, 0x51, 0x1C, 
 0x07, 0xF0, 0xB7, 0x8C, 0x54, 0x64, 0xE8, 0x4A, 0xB2, 0x78, 0x10, 0xD4, 0xD4, 0x54, 0x56, 0x8C, 0x28, 
 0xDD, 0x7F, 0xB8, 0x8A, 0x16, 0x8A, 0xE2, 0x61, 0x2F, 0xA2, 0xA2, 0x82, 0x22, 0x29, 0x4A, 0x87, 0xDD, 
 0x8B, 0xBA, 0x14, 0xAB, 0x60, 0xC8, 0x7A, 0xF0, 0xCF, 0x0E, 0xE2, 0x41, 0x0A, 0x4A, 0x82, 0x52, 0xD1, 
@@ -1,4 +1,4 @@
-// // bzf_help.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_HELP_H#define _BZF_HELP_H #define BZF_HELP_MT "text/html"#define BZF_HELP_PATH "/help.html"#define BZF_HELP_SIZE 911const uint8_t bzf_help[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0xBD, 0x57, 0x6D, 0x6F, 0xDB, 0x36, 0x10, 
+// // bzf_help.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_HELP_H#define _BZF_HELP_H #define BZF_HELP_MT "text/html"#define BZF_HELP_PATH "/help.html"#define BZF_HELP_SIZE 911#define BZF_HELP_HASH 0x64F95546ULconst uint8_t bzf_help[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xBD, 0x57, 0x6D, 0x6F, 0xDB, 0x36, 0x10, 
 0xFE, 0x3E, 0x60, 0xFF, 0x81, 0xE3, 0x97, 0xA4, 0xC0, 0x68, 0xD9, 0xC5, 0x8A, 0x15, 0xAD, 0x64, 0x60, 
 0x88, 0x83, 0x2D, 0xC0, 0x96, 0x74, 0xB5, 0x37, 0x6C, 0x9F, 0x0A, 0x5A, 0xA4, 0x25, 0x26, 0x14, 0xA9, 
 0x92, 0x27, 0xD9, 0xC1, 0xB6, 0xFF, 0xDE, 0xA3, 0xE4, 0xCC, 0xB2, 0xFC, 0x52, 0xCF, 0x58, 0x2A, 0x08, 
@@ -1,4 +1,4 @@
-// // bzf_login.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_LOGIN_H#define _BZF_LOGIN_H #define BZF_LOGIN_MT "text/html"#define BZF_LOGIN_PATH "/login.html"#define BZF_LOGIN_SIZE 503const uint8_t bzf_login[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0xAD, 0x54, 0x51, 0x6B, 0xDB, 0x30, 0x10, 
+// // bzf_login.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_LOGIN_H#define _BZF_LOGIN_H #define BZF_LOGIN_MT "text/html"#define BZF_LOGIN_PATH "/login.html"#define BZF_LOGIN_SIZE 503#define BZF_LOGIN_HASH 0x9BA0B75DULconst uint8_t bzf_login[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xAD, 0x54, 0x51, 0x6B, 0xDB, 0x30, 0x10, 
 0x7E, 0x1F, 0xEC, 0x3F, 0xA8, 0x7A, 0x9E, 0x6A, 0xB2, 0x87, 0xB1, 0x07, 0x2B, 0x10, 0xDA, 0xD0, 0x15, 
 0xCA, 0x52, 0x46, 0x0B, 0xDB, 0xA3, 0x62, 0x5D, 0x2C, 0x31, 0x59, 0xD2, 0xA4, 0xB3, 0xD3, 0xFC, 0xFB, 
 0x49, 0x76, 0xD6, 0x3A, 0x49, 0x13, 0x96, 0x52, 0x83, 0x91, 0xEE, 0x74, 0xDF, 0xDD, 0xE7, 0xEF, 0xCE, 
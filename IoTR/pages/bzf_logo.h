@@ -1,4 +1,4 @@
-// // bzf_logo.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_LOGO_H#define _BZF_LOGO_H #define BZF_LOGO_MT "image/svg+xml"#define BZF_LOGO_PATH "/logo.svg"#define BZF_LOGO_SIZE 1305const uint8_t bzf_logo[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0xAD, 0x56, 0xC9, 0x6E, 0x1B, 0x39, 0x10, 
+// // bzf_logo.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_LOGO_H#define _BZF_LOGO_H #define BZF_LOGO_MT "image/svg+xml"#define BZF_LOGO_PATH "/logo.svg"#define BZF_LOGO_SIZE 1305#define BZF_LOGO_HASH 0x91517E7BULconst uint8_t bzf_logo[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xAD, 0x56, 0xC9, 0x6E, 0x1B, 0x39, 0x10, 
 0xFD, 0x95, 0x86, 0xE6, 0xCA, 0xA6, 0x58, 0xC5, 0x3D, 0x91, 0x0D, 0x78, 0x4E, 0x3A, 0x28, 0xA7, 0x00, 
 0x3A, 0xF8, 0x12, 0x74, 0x64, 0xD9, 0x12, 0xD0, 0x5E, 0x60, 0x09, 0x76, 0x8C, 0x41, 0xFE, 0x7D, 0x5E, 
 0x91, 0x94, 0xA3, 0xC4, 0xB6, 0xE6, 0x32, 0x30, 0x5C, 0x20, 0x4B, 0xB5, 0x2F, 0x8F, 0x3D, 0xDB, 0x3D, 
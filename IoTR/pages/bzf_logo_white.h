@@ -1,4 +1,4 @@
-// // bzf_logo_white.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_LOGO_WHITE_H#define _BZF_LOGO_WHITE_H #define BZF_LOGO_WHITE_MT "image/png"#define BZF_LOGO_WHITE_PATH "/logo_white.png"#define BZF_LOGO_WHITE_SIZE 5053const uint8_t bzf_logo_white[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0xD5, 0x55, 0xF7, 0x3F, 0xD4, 0x81, 0xFF, 
+// // bzf_logo_white.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_LOGO_WHITE_H#define _BZF_LOGO_WHITE_H #define BZF_LOGO_WHITE_MT "image/png"#define BZF_LOGO_WHITE_PATH "/logo_white.png"#define BZF_LOGO_WHITE_SIZE 5053#define BZF_LOGO_WHITE_HASH 0x51CE7811ULconst uint8_t bzf_logo_white[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xD5, 0x55, 0xF7, 0x3F, 0xD4, 0x81, 0xFF, 
 0xB7, 0x8A, 0xEC, 0x3D, 0xCF, 0xDE, 0x1C, 0x0A, 0x57, 0xA8, 0xC8, 0x26, 0x9B, 0x4E, 0x6F, 0x22, 0xDC, 
 0xD9, 0xC2, 0x25, 0x2B, 0x51, 0xF6, 0x3A, 0x7B, 0x5C, 0x46, 0x94, 0x59, 0x38, 0xE3, 0x6C, 0x12, 0x47, 
 0x38, 0x5B, 0xD6, 0x09, 0xE1, 0xEC, 0x38, 0x84, 0x14, 0x99, 0x5F, 0x9F, 0xEF, 0xF7, 0xFB, 0xCB, 0xF7, 
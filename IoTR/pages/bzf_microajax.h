@@ -1,4 +1,4 @@
-// // bzf_microajax.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_MICROAJAX_H#define _BZF_MICROAJAX_H #define BZF_MICROAJAX_MT "application/javascript"#define BZF_MICROAJAX_PATH "/microajax.js"#define BZF_MICROAJAX_SIZE 669const uint8_t bzf_microajax[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0xC5, 0x55, 0x5D, 0x6B, 0xDB, 0x30, 0x14, 
+// // bzf_microajax.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_MICROAJAX_H#define _BZF_MICROAJAX_H #define BZF_MICROAJAX_MT "application/javascript"#define BZF_MICROAJAX_PATH "/microajax.js"#define BZF_MICROAJAX_SIZE 669#define BZF_MICROAJAX_HASH 0x64D07347ULconst uint8_t bzf_microajax[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xC5, 0x55, 0x5D, 0x6B, 0xDB, 0x30, 0x14, 
 0x7D, 0x2F, 0xF4, 0x3F, 0x68, 0x7E, 0x92, 0x21, 0xF1, 0xDA, 0xB1, 0xB7, 0x91, 0x87, 0x7C, 0x6D, 0x19, 
 0x34, 0xB4, 0x2C, 0x61, 0x2B, 0x94, 0x3C, 0xA8, 0xF2, 0x75, 0xEC, 0xD6, 0x91, 0x3C, 0x49, 0x8E, 0x1B, 
 0x9A, 0xFE, 0xF7, 0x5D, 0x39, 0xB6, 0x63, 0x3B, 0x29, 0x0B, 0xED, 0x60, 0x26, 0x60, 0x21, 0x1F, 0xDD, 
@@ -1,80 +1,103 @@
-// // bzf_mqtt.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_MQTT_H#define _BZF_MQTT_H #define BZF_MQTT_MT "text/html"#define BZF_MQTT_PATH "/mqtt.html"#define BZF_MQTT_SIZE 1349const uint8_t bzf_mqtt[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0xD5, 0x59, 0xDD, 0x6E, 0xDB, 0x36, 0x14, 
-0xBE, 0x1F, 0xB0, 0x77, 0x60, 0x75, 0x93, 0x04, 0xA8, 0x2C, 0xA7, 0x5B, 0xB1, 0x22, 0x95, 0x0D, 0x14, 
-0x4D, 0xB1, 0x05, 0x58, 0xDB, 0xAC, 0x76, 0x8B, 0xED, 0xAA, 0xA0, 0xC5, 0x63, 0x89, 0x0D, 0x45, 0xAA, 
-0x24, 0x25, 0x3B, 0xD8, 0xF6, 0x64, 0xBB, 0xD8, 0x23, 0xED, 0x15, 0x76, 0x48, 0xC9, 0xB1, 0xFC, 0x6F, 
-0x07, 0x69, 0x9B, 0x04, 0x09, 0x22, 0x92, 0xE7, 0x7C, 0xE4, 0x39, 0xFC, 0xCE, 0xE1, 0xDF, 0x7F, 0xFF, 
-0xFC, 0x1B, 0x3F, 0x3A, 0x7F, 0xFB, 0x72, 0xF8, 0xC7, 0xE5, 0x2B, 0x92, 0xD9, 0x5C, 0xF4, 0xBF, 0xFF, 
-0x2E, 0x76, 0xFF, 0x89, 0xA0, 0x32, 0xED, 0x05, 0x20, 0x03, 0xAC, 0x21, 0xF8, 0x13, 0x67, 0x40, 0x59, 
-0xF3, 0xED, 0xCB, 0x39, 0x58, 0x4A, 0x92, 0x8C, 0x6A, 0x03, 0xB6, 0x17, 0x94, 0x76, 0x1C, 0x3E, 0x0B, 
-0x56, 0xDA, 0x33, 0x6B, 0x8B, 0x10, 0x3E, 0x97, 0xBC, 0xEA, 0x05, 0xBF, 0x87, 0xEF, 0x5F, 0x84, 0x2F, 
-0x55, 0x5E, 0x50, 0xCB, 0x47, 0x02, 0x02, 0x92, 0x28, 0x69, 0x41, 0xA2, 0xF2, 0xC5, 0xAB, 0x1E, 0xB0, 
-0x14, 0x56, 0xD5, 0x25, 0xCD, 0xA1, 0x17, 0x54, 0x1C, 0x26, 0x85, 0xD2, 0xB6, 0xA5, 0x31, 0xE1, 0xCC, 
-0x66, 0x3D, 0x06, 0x15, 0x4F, 0x20, 0xF4, 0x85, 0xC7, 0x84, 0x4B, 0x6E, 0x39, 0x15, 0xA1, 0x49, 0xA8, 
-0x80, 0xDE, 0xE9, 0x02, 0x9A, 0xE5, 0x56, 0x40, 0xFF, 0x42, 0x0D, 0xDF, 0x91, 0x90, 0x0C, 0x5E, 0x0D, 
-0x87, 0x17, 0x6F, 0x7E, 0x1E, 0xC4, 0x51, 0x5D, 0xDD, 0x92, 0x13, 0x5C, 0x5E, 0x91, 0x4C, 0xC3, 0xB8, 
-0x17, 0x68, 0x40, 0xC3, 0x3A, 0x89, 0x31, 0x01, 0xD1, 0x20, 0x7A, 0x81, 0xB1, 0xD7, 0x02, 0x4C, 0x06, 
-0x80, 0xE3, 0xB0, 0xD7, 0x05, 0x8E, 0xCB, 0xC2, 0xD4, 0x46, 0x4E, 0x60, 0x03, 0x82, 0xD7, 0xD8, 0x1B, 
-0xA1, 0x71, 0x73, 0xD4, 0xF2, 0x73, 0x3C, 0x52, 0xEC, 0x9A, 0x24, 0x82, 0x1A, 0xE3, 0x4C, 0xB6, 0x59, 
-0x38, 0xE6, 0x53, 0x60, 0x61, 0x0E, 0xB2, 0x5C, 0xE8, 0x94, 0xCB, 0xA2, 0xB4, 0x0D, 0x66, 0x92, 0x41, 
-0x72, 0x35, 0x52, 0xD3, 0x60, 0xA6, 0x98, 0x71, 0xC6, 0x70, 0x1E, 0x09, 0x67, 0xBD, 0x40, 0xD2, 0x2A, 
-0xB4, 0x2A, 0x4D, 0x9D, 0xFB, 0x69, 0x69, 0x55, 0x82, 0xD3, 0x21, 0xC0, 0xA2, 0x9A, 0x1A, 0x8F, 0x17, 
-0x20, 0x19, 0xAF, 0x66, 0x00, 0xA8, 0x44, 0x7C, 0xC7, 0x24, 0xD5, 0x9C, 0x85, 0x6E, 0x12, 0x28, 0x97, 
-0xA0, 0xDB, 0xF2, 0xCB, 0x3A, 0x1B, 0x85, 0x96, 0x05, 0xB5, 0x9A, 0xAC, 0x13, 0x59, 0xC5, 0x13, 0x38, 
-0xFB, 0x22, 0x94, 0x05, 0x99, 0x9A, 0xF0, 0xF4, 0x09, 0x31, 0x79, 0xF8, 0x8C, 0xE4, 0x2C, 0xFC, 0x69, 
-0x93, 0x76, 0xED, 0x98, 0x3C, 0x25, 0x46, 0x27, 0xBD, 0x40, 0xA8, 0x54, 0x7D, 0x9C, 0x64, 0xDC, 0x42, 
-0xA7, 0x90, 0xE9, 0x8D, 0x6F, 0x5C, 0x35, 0x7A, 0x42, 0x38, 0x12, 0x22, 0x39, 0xB6, 0x62, 0x95, 0x62, 
-0x4B, 0x6B, 0x33, 0xF7, 0xFD, 0x98, 0x36, 0x93, 0x1F, 0x31, 0x6A, 0xB2, 0x91, 0xA2, 0x9A, 0xCD, 0x3B, 
-0x43, 0x6A, 0x04, 0xFD, 0xF3, 0x59, 0x7D, 0x1C, 0xD1, 0x7E, 0x1C, 0xA1, 0xCE, 0x21, 0xA8, 0xC8, 0x49, 
-0xCB, 0x65, 0x6A, 0x96, 0x40, 0x07, 0x4D, 0xF5, 0xAD, 0x30, 0x25, 0xD8, 0x89, 0xD2, 0x57, 0x4B, 0x90, 
-0x6F, 0xEA, 0xDA, 0xFD, 0x11, 0x67, 0xEA, 0x34, 0xB1, 0xBC, 0xC2, 0x60, 0x9E, 0x77, 0x90, 0x7F, 0xB6, 
-0x76, 0x09, 0xFD, 0xF5, 0x6F, 0xC3, 0xE1, 0xAD, 0x06, 0x9B, 0x81, 0x28, 0x96, 0xB0, 0x7E, 0xC1, 0xAA, 
-0x5B, 0x61, 0xB9, 0xD9, 0x2F, 0x97, 0x47, 0xF6, 0xAB, 0xAF, 0xDC, 0x03, 0x2F, 0x8E, 0x36, 0x32, 0x22, 
-0x8E, 0x90, 0xBA, 0xB7, 0x64, 0xF5, 0x8F, 0x8E, 0xD5, 0x4F, 0x89, 0x4B, 0x0D, 0xA1, 0xE6, 0x69, 0x66, 
-0xB7, 0x92, 0xB2, 0x05, 0xE6, 0x12, 0xC7, 0x6E, 0x0D, 0xAF, 0x65, 0x0A, 0x2A, 0x7D, 0x3E, 0xC8, 0xC2, 
-0x44, 0xA8, 0x04, 0xAD, 0xEE, 0x76, 0x3B, 0xFE, 0xB7, 0xDB, 0x8D, 0xBA, 0xDD, 0x33, 0xFF, 0x1B, 0x47, 
-0x4E, 0x6C, 0x1F, 0xA8, 0xFE, 0x5F, 0xFB, 0xCB, 0x36, 0xDD, 0x1A, 0xC3, 0x19, 0xD2, 0x76, 0x70, 0x71, 
-0xFE, 0x45, 0xBB, 0xD1, 0xD8, 0x4F, 0xD0, 0x7F, 0x87, 0xFD, 0x7C, 0xD1, 0x6E, 0x2A, 0x25, 0x2C, 0x75, 
-0x0B, 0x18, 0xBA, 0xF0, 0xC3, 0x17, 0xED, 0xC9, 0x87, 0x52, 0xFF, 0xCD, 0xDB, 0x9D, 0x8A, 0x5B, 0x29, 
-0xB8, 0xA1, 0x6D, 0x5D, 0xFD, 0x72, 0xDD, 0x4A, 0x59, 0xD0, 0x11, 0x08, 0x32, 0x56, 0x7A, 0x61, 0x75, 
-0x71, 0xC1, 0xE3, 0x1A, 0x36, 0x2C, 0x29, 0x7B, 0xAD, 0x21, 0x1B, 0x96, 0x86, 0xE5, 0x00, 0xAA, 0x23, 
-0x07, 0x83, 0xE6, 0xF4, 0xC9, 0xC6, 0x95, 0x04, 0x87, 0x97, 0x13, 0x97, 0x98, 0x94, 0xEC, 0x05, 0x01, 
-0xC1, 0xCD, 0x45, 0xA6, 0xD0, 0x9F, 0x85, 0x32, 0xF3, 0xF0, 0x37, 0xE0, 0xDB, 0xB7, 0x86, 0xDB, 0x98, 
-0x83, 0x60, 0x98, 0x83, 0x77, 0xA6, 0x19, 0x48, 0x41, 0xB2, 0x26, 0xCB, 0x35, 0x85, 0x1D, 0x2A, 0x2D, 
-0xAB, 0xB6, 0x2F, 0xB3, 0xBB, 0xB4, 0xB7, 0xAC, 0xA8, 0x7B, 0xBB, 0xF2, 0x87, 0x3D, 0xF3, 0xCF, 0x7A, 
-0xAA, 0x36, 0x88, 0xCE, 0xE9, 0xA1, 0x67, 0x01, 0xAE, 0x7A, 0x2A, 0x47, 0x63, 0xA2, 0x8B, 0xCB, 0xB3, 
-0xBD, 0x28, 0xBF, 0x0F, 0x8B, 0xF7, 0x36, 0xE6, 0xD9, 0x41, 0x16, 0xB4, 0xF7, 0x52, 0xCE, 0x09, 0xF5, 
-0xC6, 0x89, 0xF9, 0xF1, 0x07, 0xCD, 0x8E, 0x74, 0x56, 0xAA, 0xA8, 0x28, 0xC1, 0x11, 0xAA, 0x6D, 0xB1, 
-0x9B, 0x38, 0xAD, 0x44, 0x40, 0x0A, 0x41, 0x13, 0xC8, 0x94, 0x60, 0x80, 0xB1, 0x71, 0xDE, 0xA8, 0xE0, 
-0x56, 0x10, 0xB7, 0xC3, 0x1A, 0x98, 0xDB, 0x61, 0xD6, 0x5F, 0x41, 0x74, 0xC7, 0xDE, 0xD8, 0x5B, 0xEE, 
-0xBE, 0xB3, 0xE6, 0x12, 0x77, 0xFD, 0x0F, 0x94, 0x30, 0xF5, 0x81, 0xA5, 0xA6, 0x4B, 0xFD, 0x7D, 0x00, 
-0x59, 0x2E, 0xBD, 0xC2, 0x7D, 0x62, 0xCA, 0xA3, 0x30, 0x2C, 0x0D, 0xE8, 0x30, 0x7C, 0x48, 0xB4, 0x6A, 
-0x2D, 0x4D, 0x6E, 0xF0, 0xC1, 0x3A, 0x8A, 0xBD, 0xC7, 0x86, 0xB3, 0xD5, 0xC5, 0xEA, 0x41, 0x70, 0xAC, 
-0x36, 0xAA, 0xE6, 0x58, 0xFD, 0x7D, 0x00, 0xC7, 0x9C, 0xE1, 0xDF, 0x94, 0x4F, 0x97, 0x2F, 0x06, 0x83, 
-0x07, 0xCB, 0xA7, 0x02, 0x61, 0xF1, 0x78, 0xC4, 0xD6, 0x72, 0xEA, 0xB2, 0x69, 0x7C, 0x58, 0xBC, 0x9A, 
-0x9B, 0xE4, 0xF3, 0xD7, 0x4D, 0xA9, 0xC9, 0x61, 0x37, 0xE5, 0x43, 0xF2, 0xD8, 0x4C, 0xE9, 0x5B, 0xF2, 
-0xEC, 0x45, 0x69, 0x33, 0x90, 0x96, 0x27, 0xD4, 0x6D, 0xEF, 0x1E, 0x2C, 0xE3, 0x28, 0x9A, 0xB1, 0x96, 
-0x6D, 0x8B, 0xF6, 0xDD, 0x7F, 0xCE, 0xB5, 0x51, 0x66, 0x77, 0x55, 0x07, 0xE8, 0x6F, 0xB9, 0xF0, 0x72, 
-0xBC, 0xAD, 0xDD, 0x54, 0x73, 0xB6, 0xFE, 0x8E, 0x0E, 0x05, 0x6F, 0xEF, 0x46, 0x3C, 0x78, 0x4E, 0xF5, 
-0x95, 0x3B, 0xD1, 0x1C, 0xB0, 0x0F, 0x39, 0xD8, 0xB7, 0xF7, 0x64, 0x6B, 0xD7, 0x76, 0xAC, 0x29, 0x47, 
-0x39, 0x9F, 0x9F, 0x8F, 0x46, 0x56, 0x12, 0xFC, 0x0B, 0x47, 0xEE, 0xC6, 0xC0, 0x7F, 0xE5, 0xCC, 0xFF, 
-0x53, 0x9A, 0x4A, 0x3C, 0xFC, 0xCE, 0x12, 0xC3, 0x80, 0x56, 0x10, 0xDC, 0x91, 0x29, 0xBB, 0x64, 0xE2, 
-0x68, 0xC7, 0x89, 0x0C, 0x05, 0x30, 0x54, 0xEE, 0xEA, 0xAC, 0xDB, 0x72, 0xEA, 0x58, 0x29, 0x0B, 0x9A, 
-0xE4, 0x36, 0x7C, 0xDA, 0xFD, 0xDA, 0x17, 0xA1, 0xF3, 0x13, 0x6F, 0xB7, 0x4E, 0x2C, 0x09, 0xC6, 0x3F, 
-0x6E, 0xCE, 0xA6, 0x66, 0xEB, 0xE1, 0xB5, 0x20, 0xFE, 0x06, 0xDA, 0xE5, 0x72, 0xC6, 0xB8, 0x4C, 0xF1, 
-0xAC, 0x5E, 0x9C, 0x91, 0xD3, 0x6E, 0x31, 0x7D, 0x8E, 0xEC, 0x36, 0x98, 0xBF, 0x65, 0xEA, 0xEF, 0xC8, 
-0x91, 0xE9, 0x75, 0x81, 0x4C, 0xA8, 0x21, 0x0C, 0x0C, 0x4F, 0x25, 0x30, 0x42, 0x25, 0xCE, 0x77, 0xC9, 
-0x85, 0x25, 0xA3, 0x6B, 0xF2, 0x56, 0x0B, 0x2E, 0xC9, 0x39, 0x47, 0x86, 0x68, 0x55, 0x75, 0xE2, 0xA8, 
-0xF8, 0x1A, 0x97, 0x0D, 0x26, 0xD1, 0xBC, 0xB0, 0xFE, 0x71, 0xA2, 0xA4, 0x29, 0x9A, 0xF2, 0x89, 0x56, 
-0xB4, 0xAE, 0x5C, 0xB8, 0x53, 0x6F, 0x57, 0xFB, 0xFB, 0xDF, 0x28, 0xE7, 0x89, 0x56, 0xF4, 0x13, 0x9D, 
-0x76, 0x3E, 0x19, 0x1F, 0xCB, 0xBE, 0xF5, 0x6E, 0xB0, 0x19, 0x54, 0x1F, 0x8D, 0xA5, 0xB6, 0x34, 0x7B, 
-0x83, 0x1F, 0xCD, 0x51, 0x8E, 0x6A, 0xF0, 0xA3, 0x25, 0xF0, 0xA3, 0x9B, 0x37, 0x81, 0xD9, 0xCF, 0xB8, 
-0x94, 0xFE, 0x86, 0x82, 0xA4, 0x60, 0x5F, 0x7F, 0xB6, 0xF6, 0x83, 0x8B, 0x37, 0x73, 0x7C, 0x42, 0xFE, 
-0x5C, 0xF5, 0x6E, 0x14, 0x91, 0x73, 0xFF, 0x3A, 0xE2, 0x53, 0xA1, 0x9F, 0xBA, 0x0A, 0xB4, 0x41, 0xED, 
-0xCE, 0xAA, 0x30, 0x86, 0x4F, 0x83, 0x75, 0x14, 0xD1, 0x82, 0x47, 0xD5, 0xA9, 0xBF, 0xB2, 0x3D, 0x3A, 
-0x79, 0xBE, 0x28, 0xFB, 0xF7, 0xF2, 0x88, 0x26, 0x5C, 0x32, 0x35, 0xE9, 0x28, 0x29, 0x14, 0x65, 0xA4, 
-0x37, 0x1F, 0xE1, 0xFA, 0x41, 0x55, 0x54, 0x93, 0x52, 0x0B, 0x14, 0x0C, 0x66, 0xFD, 0x40, 0x85, 0xD4, 
-0x35, 0xC1, 0xF3, 0xF5, 0xC2, 0xF5, 0x03, 0xCF, 0xC0, 0xBB, 0x16, 0xB5, 0x24, 0x4C, 0x1A, 0xAB, 0xEA, 
-0xAA, 0x63, 0x04, 0x3B, 0x59, 0xA3, 0xDA, 0x56, 0xEB, 0xB8, 0x67, 0xA1, 0x63, 0x27, 0xB5, 0xD6, 0xEE, 
-0x21, 0xCF, 0x41, 0x95, 0xF6, 0x78, 0xC1, 0xA5, 0x8F, 0xC9, 0xD3, 0x6E, 0x77, 0x8D, 0xF1, 0x73, 0x5A, 
-0x2E, 0x4C, 0x70, 0x1C, 0xB9, 0x77, 0x1A, 0xF7, 0x72, 0x16, 0x35, 0x4F, 0x68, 0xFF, 0x03, 0x66, 0x96, 
-0x18, 0x4E, 0x57, 0x1B, 0x00, 0x00};#endif // _BZF_MQTT_H
\ No newline at end of file
+// // bzf_mqtt.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_MQTT_H#define _BZF_MQTT_H #define BZF_MQTT_MT "text/html"#define BZF_MQTT_PATH "/mqtt.html"#define BZF_MQTT_SIZE 1744#define BZF_MQTT_HASH 0xD919C35AULconst uint8_t bzf_mqtt[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0x5B, 0x6D, 0x6F, 0xDB, 0x36, 0x10, 
+0xFE, 0x3E, 0x60, 0xFF, 0x81, 0xE5, 0x97, 0xB4, 0x40, 0x65, 0x39, 0x69, 0x8B, 0x05, 0xA9, 0x65, 0x20, 
+0x6B, 0x82, 0x2D, 0xC3, 0x9A, 0xA4, 0x75, 0x5A, 0x6C, 0x28, 0x86, 0x80, 0x96, 0xCE, 0x12, 0x1B, 0x8A, 
+0x54, 0x44, 0x4A, 0x76, 0xF6, 0xF2, 0xCB, 0xF6, 0x61, 0x3F, 0x69, 0x7F, 0x61, 0x7C, 0x91, 0x63, 0xD9, 
+0xB1, 0x1D, 0x3B, 0x4B, 0x9A, 0x08, 0x69, 0x90, 0x20, 0x12, 0x79, 0x77, 0xE4, 0x73, 0x7C, 0x8E, 0x77, 
+0x12, 0xC4, 0x7F, 0xFF, 0xFE, 0xA7, 0xF3, 0x64, 0xEF, 0xE8, 0xCD, 0xC9, 0xAF, 0xC7, 0xFB, 0x28, 0x51, 
+0x29, 0xEB, 0x7E, 0xFB, 0x4D, 0xC7, 0xFC, 0x47, 0x8C, 0xF0, 0x38, 0xC0, 0xC0, 0xB1, 0x6E, 0x41, 0xFA, 
+0xA7, 0x93, 0x00, 0x89, 0xAA, 0x6B, 0x7B, 0x9F, 0x82, 0x22, 0x28, 0x4C, 0x48, 0x2E, 0x41, 0x05, 0xB8, 
+0x50, 0x03, 0x6F, 0x1B, 0x5F, 0xE9, 0x4F, 0x94, 0xCA, 0x3C, 0x38, 0x2F, 0x68, 0x19, 0xE0, 0x5F, 0xBC, 
+0x0F, 0xBB, 0xDE, 0x1B, 0x91, 0x66, 0x44, 0xD1, 0x3E, 0x03, 0x8C, 0x42, 0xC1, 0x15, 0x70, 0xAD, 0x7C, 
+0xB0, 0x1F, 0x40, 0x14, 0xC3, 0x55, 0x75, 0x4E, 0x52, 0x08, 0x70, 0x49, 0x61, 0x98, 0x89, 0x5C, 0xD5, 
+0x34, 0x86, 0x34, 0x52, 0x49, 0x10, 0x41, 0x49, 0x43, 0xF0, 0xEC, 0xCD, 0x73, 0x44, 0x39, 0x55, 0x94, 
+0x30, 0x4F, 0x86, 0x84, 0x41, 0xB0, 0x39, 0x65, 0x4D, 0x51, 0xC5, 0xA0, 0x7B, 0x20, 0x4E, 0xDE, 0x23, 
+0x0F, 0xF5, 0xF6, 0x4F, 0x4E, 0x0E, 0x0E, 0x7F, 0xE8, 0x75, 0x7C, 0xD7, 0x5C, 0x93, 0x63, 0x94, 0x9F, 
+0xA1, 0x24, 0x87, 0x41, 0x80, 0x73, 0xD0, 0xC0, 0x5A, 0xA1, 0x94, 0x18, 0xE5, 0xC0, 0x02, 0x2C, 0xD5, 
+0x05, 0x03, 0x99, 0x00, 0xE8, 0x79, 0xA8, 0x8B, 0x4C, 0xCF, 0x4B, 0xC1, 0x48, 0xF9, 0x46, 0x60, 0x81, 
+0x05, 0xAB, 0xB1, 0xB2, 0x85, 0xCA, 0xCD, 0x7E, 0xCD, 0xCF, 0x9D, 0xBE, 0x88, 0x2E, 0x50, 0xC8, 0x88, 
+0x94, 0x06, 0xB2, 0x4A, 0xBC, 0x01, 0x1D, 0x41, 0xE4, 0xA5, 0xC0, 0x8B, 0xA9, 0x41, 0x29, 0xCF, 0x0A, 
+0x55, 0xD9, 0x0C, 0x13, 0x08, 0xCF, 0xFA, 0x62, 0x84, 0xC7, 0x8A, 0x09, 0x8D, 0x22, 0xBD, 0x8E, 0x88, 
+0x46, 0x01, 0xE6, 0xA4, 0xF4, 0x94, 0x88, 0x63, 0xE3, 0x7E, 0x52, 0x28, 0x11, 0xEA, 0xE5, 0x60, 0xA0, 
+0xB4, 0x9A, 0x18, 0x0C, 0xA6, 0x4C, 0x46, 0xB4, 0x1C, 0x1B, 0xD0, 0x4A, 0xC8, 0x0E, 0x8C, 0xE2, 0x9C, 
+0x46, 0x9E, 0x59, 0x04, 0x42, 0x39, 0xE4, 0x75, 0xF9, 0x59, 0x9D, 0x85, 0x42, 0xB3, 0x82, 0xB9, 0x18, 
+0xCE, 0x13, 0xB9, 0x6A, 0x8F, 0xE9, 0xD5, 0x67, 0x1E, 0xCF, 0xD0, 0x48, 0x7A, 0x9B, 0x5B, 0x48, 0xA6, 
+0xDE, 0x36, 0x4A, 0x23, 0xEF, 0xBB, 0x45, 0xDA, 0xCE, 0x31, 0x69, 0x8C, 0x64, 0x1E, 0x06, 0x98, 0x89, 
+0x58, 0x9C, 0x0E, 0x13, 0xAA, 0xA0, 0x95, 0xF1, 0xF8, 0xD2, 0x37, 0xA6, 0x59, 0x7B, 0x82, 0x19, 0x12, 
+0x6A, 0x72, 0x2C, 0xB5, 0x55, 0xB0, 0x25, 0xBD, 0xD5, 0xDA, 0x77, 0x3B, 0xA4, 0x5A, 0x7C, 0x3F, 0x22, 
+0x32, 0xE9, 0x0B, 0x92, 0x47, 0x93, 0xC1, 0x34, 0x35, 0x70, 0x77, 0x6F, 0xDC, 0xDE, 0xF1, 0x49, 0xB7, 
+0xE3, 0x6B, 0x9D, 0x75, 0xAC, 0x6A, 0x4E, 0x2A, 0xCA, 0x63, 0x39, 0x63, 0xB4, 0x57, 0x35, 0xDF, 0xC8, 
+0x26, 0x07, 0x35, 0x14, 0xF9, 0xD9, 0x8C, 0xC9, 0x43, 0xD7, 0xBA, 0xBA, 0xC5, 0xB1, 0x3A, 0x09, 0x15, 
+0x2D, 0x75, 0x30, 0x4F, 0x06, 0x48, 0xCF, 0x95, 0x9A, 0xB1, 0xFE, 0xF6, 0xDD, 0xC9, 0xC9, 0x8D, 0x26, 
+0x9B, 0x00, 0xCB, 0x66, 0x6C, 0xFD, 0xA8, 0x9B, 0x6E, 0x64, 0xCB, 0xAC, 0x7E, 0x31, 0x3B, 0xB3, 0x9F, 
+0x6D, 0xE3, 0x0A, 0xF6, 0x3A, 0xFE, 0x42, 0x46, 0x74, 0x7C, 0x4D, 0xDD, 0x1B, 0xB2, 0xFA, 0xA5, 0x61, 
+0xF5, 0x2B, 0x64, 0xB6, 0x06, 0x2F, 0xA7, 0x71, 0xA2, 0x96, 0x92, 0xB2, 0x66, 0xCC, 0x6C, 0x1C, 0xD7, 
+0x6B, 0x58, 0x2D, 0x99, 0x11, 0x6E, 0xF7, 0x83, 0xC4, 0x0B, 0x99, 0x08, 0x35, 0xEA, 0x76, 0xBB, 0x65, 
+0x7F, 0xDB, 0x6D, 0xBF, 0xDD, 0xDE, 0xB1, 0xBF, 0x1D, 0xDF, 0x88, 0xAD, 0x62, 0xAA, 0xFB, 0xE7, 0xEA, 
+0xB2, 0xD5, 0xB0, 0x52, 0xD2, 0x48, 0xD3, 0xB6, 0x77, 0xB0, 0x77, 0xA7, 0xC3, 0xE4, 0x7A, 0x1C, 0xDC, 
+0x7D, 0xAF, 0xC7, 0xB9, 0xD3, 0x61, 0x4A, 0xC1, 0x14, 0x31, 0x09, 0x4C, 0xBB, 0xF0, 0xE3, 0x9D, 0x8E, 
+0x64, 0x43, 0xA9, 0x7B, 0x78, 0x74, 0xAD, 0xE2, 0x52, 0x0A, 0x2E, 0xE8, 0x9B, 0xD7, 0x3E, 0xDB, 0x76, 
+0xE5, 0x9E, 0x91, 0x3E, 0x30, 0x34, 0x10, 0xF9, 0x54, 0x76, 0x31, 0xC1, 0x63, 0x3A, 0x16, 0xA4, 0x94, 
+0x95, 0x72, 0xC8, 0x82, 0xD4, 0x30, 0x1B, 0x40, 0x2E, 0x72, 0x74, 0xD0, 0x6C, 0x6E, 0x2D, 0xCC, 0x24, 
+0x7A, 0x7A, 0x29, 0x32, 0x1B, 0x93, 0xE0, 0x01, 0xC6, 0x48, 0x17, 0x17, 0x89, 0xD0, 0xFE, 0xCC, 0x84, 
+0x9C, 0x84, 0xBF, 0x04, 0xDB, 0xBF, 0x34, 0xDC, 0x06, 0x14, 0x58, 0xA4, 0xF7, 0xE0, 0x6B, 0xB7, 0x19, 
+0x88, 0x81, 0x47, 0xD5, 0x2E, 0x57, 0xDD, 0x5C, 0xA3, 0x52, 0x43, 0xB5, 0x3C, 0xCD, 0x5E, 0xA7, 0xBD, 
+0x24, 0xA3, 0xAE, 0xEC, 0xCA, 0x17, 0x2B, 0xEE, 0x3F, 0xF3, 0xA9, 0x5A, 0x59, 0x34, 0x4E, 0xF7, 0x2C, 
+0x0B, 0x74, 0xD6, 0x13, 0xA9, 0x06, 0xE3, 0x1F, 0x1C, 0xEF, 0xAC, 0x44, 0xF9, 0x55, 0x58, 0xBC, 0x32, 
+0x98, 0xED, 0xB5, 0x10, 0xD4, 0x6B, 0x29, 0xE3, 0x04, 0x57, 0x38, 0x45, 0x76, 0xFE, 0xB8, 0xAA, 0x48, 
+0xC7, 0x77, 0x25, 0x61, 0x05, 0x18, 0x42, 0xD5, 0x11, 0x9B, 0x85, 0xCB, 0x05, 0xC3, 0x28, 0x63, 0x24, 
+0x84, 0x44, 0xB0, 0x08, 0x74, 0x6C, 0xEC, 0x55, 0x2A, 0xBA, 0x14, 0xD4, 0xE5, 0x70, 0x0E, 0x91, 0xA9, 
+0x30, 0xDD, 0x15, 0xF6, 0x6F, 0xD9, 0x1B, 0x2B, 0xCB, 0x3D, 0x74, 0xD6, 0x1C, 0xEB, 0xAA, 0xBF, 0xA1, 
+0x84, 0x71, 0x0F, 0x2C, 0x8E, 0x2E, 0xEE, 0x7A, 0x0D, 0xB2, 0x1C, 0x5B, 0x85, 0x87, 0xC4, 0x94, 0x27, 
+0x9E, 0x57, 0x48, 0xC8, 0x3D, 0xAF, 0x49, 0xB4, 0xAA, 0xA5, 0x26, 0x33, 0x79, 0x3C, 0x8F, 0x62, 0x1F, 
+0x74, 0xC7, 0xCE, 0xD5, 0x64, 0xD5, 0x08, 0x8E, 0x39, 0x50, 0x8E, 0x63, 0xEE, 0x7A, 0x0D, 0x8E, 0x19, 
+0xE0, 0xF7, 0xCA, 0xA7, 0xE3, 0xDD, 0x5E, 0xAF, 0xB1, 0x7C, 0xCA, 0xB4, 0x59, 0xFD, 0x78, 0x14, 0xCD, 
+0xE5, 0xD4, 0x71, 0xD5, 0xD9, 0x2C, 0x5E, 0x4D, 0x20, 0xD9, 0xFD, 0xEB, 0xF2, 0xAE, 0xDA, 0xC3, 0x2E, 
+0xEF, 0xD7, 0xD9, 0xC7, 0xC6, 0x4A, 0xF7, 0xC9, 0xB3, 0xDD, 0x42, 0x25, 0xC0, 0x15, 0x0D, 0x89, 0x29, 
+0xEF, 0x1A, 0xCB, 0x38, 0xA2, 0x61, 0xCC, 0x65, 0xDB, 0x34, 0xBE, 0x87, 0xCF, 0xB9, 0xBA, 0x95, 0xF1, 
+0xBB, 0xAA, 0x35, 0xF4, 0x97, 0xBC, 0xF0, 0x32, 0xBC, 0x75, 0x6E, 0x72, 0x9C, 0x75, 0xD7, 0xFE, 0xBA, 
+0xC6, 0xEB, 0xD5, 0x88, 0x35, 0x9E, 0x92, 0xFC, 0xCC, 0x3C, 0xD1, 0xAC, 0x51, 0x87, 0xAC, 0xED, 0xDB, 
+0x3B, 0x20, 0xFE, 0xF7, 0x44, 0x85, 0x49, 0x63, 0xF9, 0xDE, 0x37, 0xB3, 0x9F, 0x4B, 0x78, 0x8B, 0x0B, 
+0xE9, 0xF4, 0x45, 0x09, 0x7B, 0xEC, 0x74, 0xAF, 0xBC, 0xE4, 0xF8, 0x5E, 0xDD, 0x3C, 0x6E, 0xC2, 0x23, 
+0x49, 0x7F, 0x87, 0x66, 0xB3, 0xFE, 0xD4, 0x40, 0x58, 0x46, 0x7D, 0xDD, 0x8D, 0x3E, 0x7D, 0xFF, 0x5B, 
+0xB3, 0xEA, 0x0B, 0x5E, 0xA4, 0x7D, 0x53, 0xA3, 0x5E, 0xD2, 0xB6, 0x82, 0x59, 0xE3, 0x6E, 0xD5, 0xB2, 
+0x46, 0x85, 0x31, 0x71, 0x08, 0x46, 0x29, 0xE5, 0x01, 0x7E, 0xB1, 0xF5, 0x42, 0x5F, 0x91, 0x51, 0x80, 
+0xB7, 0xDA, 0x2F, 0xB7, 0xEF, 0xB5, 0xF0, 0x70, 0x73, 0xA3, 0x5C, 0x41, 0xAE, 0x11, 0x35, 0x9C, 0x92, 
+0x63, 0x18, 0x4B, 0x68, 0x39, 0x16, 0x41, 0x9F, 0x52, 0xD9, 0x78, 0x6E, 0x4E, 0xF0, 0xD6, 0xF9, 0x39, 
+0x69, 0x5D, 0x9B, 0xA3, 0x13, 0x55, 0xCB, 0xD3, 0xCD, 0xF6, 0xBD, 0x72, 0xB3, 0x67, 0xB3, 0x27, 0x7A, 
+0x27, 0x9A, 0xFB, 0x08, 0xE6, 0x0A, 0x80, 0xD3, 0x73, 0x21, 0xE7, 0x72, 0x72, 0x82, 0xF0, 0xE1, 0x53, 
+0x51, 0x02, 0x83, 0x50, 0x59, 0xF6, 0xD5, 0x51, 0x39, 0xE6, 0x2D, 0xC2, 0x39, 0x26, 0xDB, 0xBA, 0xD9, 
+0x5E, 0x64, 0xE6, 0x39, 0x61, 0x4C, 0xE0, 0x36, 0xEE, 0xB6, 0x91, 0x87, 0x76, 0x15, 0x4A, 0x85, 0x54, 
+0x48, 0xF0, 0x10, 0x3A, 0xBE, 0x13, 0xF9, 0x7F, 0x86, 0x37, 0x71, 0x77, 0xD3, 0x19, 0x66, 0x40, 0x6E, 
+0xD5, 0xF2, 0x16, 0xEE, 0x6E, 0x69, 0xCB, 0xFB, 0x23, 0x12, 0x2A, 0x76, 0x71, 0x53, 0xC3, 0xBA, 0xBA, 
+0xB1, 0x5E, 0xBF, 0xFF, 0x20, 0xCC, 0xC1, 0xBC, 0xE8, 0x6F, 0x7A, 0x1C, 0x3A, 0x14, 0xCB, 0x42, 0xD1, 
+0x49, 0x3C, 0xF6, 0x8A, 0x7D, 0xC6, 0x5D, 0x53, 0x31, 0x3E, 0x6E, 0x7C, 0xB4, 0x15, 0x7C, 0x4F, 0x11, 
+0x55, 0xC8, 0x66, 0xA7, 0x25, 0x0B, 0x61, 0x71, 0x5A, 0xBA, 0x44, 0xD8, 0xAC, 0xB4, 0x54, 0x43, 0x55, 
+0x51, 0x76, 0x01, 0xCE, 0xAF, 0x69, 0xA9, 0xF1, 0x69, 0xC9, 0x51, 0xB4, 0xE9, 0x69, 0xC9, 0xF1, 0x73, 
+0x59, 0x5A, 0xAA, 0xE3, 0x7C, 0xF4, 0x69, 0x69, 0xDA, 0x5D, 0x53, 0x31, 0xFE, 0xE8, 0xD3, 0xD2, 0x1B, 
+0x91, 0xA6, 0x84, 0x47, 0xCD, 0x4E, 0x4C, 0xA1, 0x03, 0xB1, 0x30, 0x33, 0xD5, 0x41, 0x36, 0x2A, 0x37, 
+0x4D, 0x01, 0x73, 0xC4, 0x5D, 0x88, 0xF5, 0x6B, 0x76, 0x6A, 0x7A, 0x76, 0xDA, 0xE7, 0xA1, 0x88, 0x28, 
+0x8F, 0x1B, 0x1B, 0x87, 0x50, 0x01, 0x98, 0x1B, 0x84, 0x63, 0x74, 0x8D, 0x0A, 0xC0, 0x09, 0x22, 0x17, 
+0x7D, 0xF3, 0x11, 0xDE, 0x5A, 0xE8, 0xFD, 0xD4, 0x3B, 0x3A, 0xBC, 0xB5, 0x70, 0x7B, 0x0B, 0x52, 0x92, 
+0x18, 0x8E, 0x49, 0x78, 0xD6, 0xC0, 0x78, 0xB8, 0x21, 0xBD, 0xEB, 0x65, 0x80, 0x2C, 0xFA, 0x29, 0x9D, 
+0x7C, 0x05, 0xD9, 0x57, 0x1C, 0xE9, 0x3F, 0xAF, 0x6F, 0xBE, 0x0B, 0xB6, 0x57, 0x69, 0x64, 0xFF, 0x89, 
+0x9C, 0xF0, 0x78, 0xF2, 0x72, 0xBE, 0x47, 0x4A, 0xC0, 0xB7, 0x04, 0xE5, 0x3A, 0x99, 0x8E, 0x7F, 0xCD, 
+0x77, 0x97, 0x5A, 0x40, 0x33, 0xEC, 0xB6, 0xBE, 0x68, 0xAD, 0x39, 0x75, 0x20, 0x84, 0x82, 0x1C, 0xA5, 
+0xCA, 0x7B, 0xD5, 0xFE, 0xD2, 0xC7, 0x1D, 0x26, 0xDF, 0xB5, 0xB6, 0xDD, 0xAE, 0x13, 0x82, 0x79, 0x85, 
+0xEC, 0x8D, 0xE4, 0xD2, 0x4F, 0x54, 0x33, 0x64, 0xCF, 0x99, 0x98, 0x2F, 0x36, 0x22, 0xBB, 0x4F, 0x2A, 
+0x91, 0xED, 0xA0, 0xCD, 0x76, 0x36, 0x7A, 0xAD, 0x2B, 0x2F, 0xA9, 0x43, 0x90, 0xC7, 0xF6, 0x24, 0x8C, 
+0xE6, 0xAE, 0xBB, 0x41, 0x43, 0x22, 0x51, 0x04, 0x92, 0xC6, 0x1C, 0x22, 0xA4, 0xD3, 0x26, 0xEA, 0x17, 
+0x94, 0x29, 0xD4, 0xBF, 0x40, 0x47, 0x39, 0xA3, 0x1C, 0xED, 0x51, 0xCD, 0x90, 0x5C, 0x94, 0xAD, 0x8E, 
+0x9F, 0x7D, 0x89, 0x4F, 0x8A, 0x65, 0x98, 0xD3, 0x4C, 0xD9, 0x23, 0x48, 0x85, 0x8E, 0xCD, 0x00, 0x7F, 
+0x26, 0x25, 0x71, 0x8D, 0x53, 0x27, 0x67, 0xEA, 0xCD, 0xF6, 0x94, 0x87, 0x9F, 0xD2, 0x30, 0x17, 0xE4, 
+0x33, 0x19, 0xB5, 0x3E, 0x4B, 0x5B, 0x67, 0xDA, 0xDE, 0xDB, 0xB1, 0x1D, 0x41, 0x79, 0xEA, 0x0A, 0xE2, 
+0x95, 0x8D, 0x6F, 0x4C, 0xAC, 0x6C, 0x38, 0xE3, 0x1B, 0x33, 0xC6, 0x37, 0x2E, 0x4F, 0xFE, 0x8C, 0x7F, 
+0x06, 0x05, 0xB7, 0xDF, 0x21, 0xA3, 0x18, 0xD4, 0xDB, 0x73, 0xA5, 0x3E, 0x9A, 0x78, 0x93, 0x4F, 0x9F, 
+0xA1, 0x3F, 0xAE, 0x7A, 0xD7, 0xF7, 0xD1, 0x9E, 0x3D, 0x03, 0x65, 0x37, 0x5E, 0xBB, 0x74, 0x25, 0xE4, 
+0x52, 0x6B, 0xB7, 0xAE, 0x0A, 0xEB, 0xF0, 0xA9, 0x6C, 0x6D, 0xF8, 0x24, 0xA3, 0x7E, 0xB9, 0x69, 0x0F, 
+0x66, 0x6C, 0x3C, 0x7B, 0x3D, 0x2D, 0xFB, 0xD7, 0xEC, 0x8C, 0x86, 0x94, 0x47, 0x62, 0xD8, 0x12, 0x9C, 
+0x09, 0x12, 0xA1, 0x60, 0x32, 0xC3, 0xF9, 0x93, 0x2A, 0x49, 0x8E, 0x8A, 0x9C, 0x69, 0x41, 0x3C, 0x1E, 
+0x07, 0x4A, 0x4D, 0x5D, 0x89, 0x5F, 0xCF, 0x17, 0x76, 0xC7, 0xB8, 0xAA, 0xA7, 0xB1, 0x00, 0x71, 0x18, 
+0x56, 0xA8, 0x5C, 0xD3, 0x53, 0x6D, 0xEC, 0xD9, 0x1C, 0xD5, 0xBA, 0x5A, 0xCB, 0x1C, 0xFE, 0x7A, 0x6A, 
+0xA4, 0xE6, 0xE2, 0x3E, 0xA1, 0x29, 0x88, 0x42, 0x3D, 0x9D, 0x72, 0xE9, 0x73, 0xF4, 0xAA, 0xDD, 0x9E, 
+0x03, 0xBE, 0xB6, 0xB7, 0xD7, 0x17, 0xB8, 0xE3, 0x9B, 0xD3, 0x58, 0xE6, 0x7C, 0x9C, 0x5F, 0x1D, 0x94, 
+0xFB, 0x0F, 0x78, 0x99, 0xF0, 0x31, 0x3D, 0x37, 0x00, 0x00};#endif // _BZF_MQTT_H
\ No newline at end of file
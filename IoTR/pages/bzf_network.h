@@ -1,143 +1,147 @@
-// // bzf_network.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_NETWORK_H#define _BZF_NETWORK_H #define BZF_NETWORK_MT "text/html"#define BZF_NETWORK_PATH "/network.html"#define BZF_NETWORK_SIZE 2414const uint8_t bzf_network[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0xED, 0x1C, 0x6D, 0x6F, 0xDB, 0xB8, 0xF9, 
-0xFB, 0x80, 0xFD, 0x07, 0x56, 0x5F, 0xE4, 0xA0, 0x91, 0x65, 0x3B, 0x57, 0x5C, 0xD1, 0xD8, 0x06, 0xBA, 
-0x24, 0x68, 0x33, 0xB4, 0x69, 0x56, 0x7B, 0xB7, 0x1B, 0xEE, 0x0E, 0x05, 0x2D, 0xD1, 0x12, 0x1B, 0x89, 
-0x54, 0x49, 0xCA, 0x4E, 0xB0, 0xE6, 0xBF, 0xEF, 0xA1, 0x24, 0xDB, 0xB2, 0x2D, 0xD9, 0x52, 0x9A, 0x34, 
-0xB1, 0x11, 0xA3, 0x45, 0x28, 0x8A, 0xCF, 0xFB, 0x0B, 0x1F, 0x8A, 0x94, 0xBA, 0x2F, 0x4E, 0x3F, 0x9D, 
-0x0C, 0xFF, 0x7B, 0x79, 0x86, 0x7C, 0x15, 0x06, 0xFD, 0xBF, 0xFF, 0xAD, 0xAB, 0xFF, 0xA2, 0x00, 0x33, 
-0xAF, 0x67, 0x10, 0x66, 0x40, 0x0F, 0x82, 0x5F, 0xD7, 0x27, 0xD8, 0xCD, 0xDA, 0xC9, 0x75, 0x48, 0x14, 
-0x46, 0x8E, 0x8F, 0x85, 0x24, 0xAA, 0x67, 0xC4, 0x6A, 0x6C, 0xBD, 0x36, 0xD6, 0xEE, 0xFB, 0x4A, 0x45, 
-0x16, 0xF9, 0x16, 0xD3, 0x49, 0xCF, 0xF8, 0xDD, 0xFA, 0xF7, 0x5B, 0xEB, 0x84, 0x87, 0x11, 0x56, 0x74, 
-0x14, 0x10, 0x03, 0x39, 0x9C, 0x29, 0xC2, 0x00, 0xF8, 0xFC, 0xAC, 0x47, 0x5C, 0x8F, 0xAC, 0x83, 0x33, 
-0x1C, 0x92, 0x9E, 0x31, 0xA1, 0x64, 0x1A, 0x71, 0xA1, 0x72, 0x10, 0x53, 0xEA, 0x2A, 0xBF, 0xE7, 0x92, 
-0x09, 0x75, 0x88, 0x95, 0x5C, 0x1C, 0x22, 0xCA, 0xA8, 0xA2, 0x38, 0xB0, 0xA4, 0x83, 0x03, 0xD2, 0x6B, 
-0x2F, 0x61, 0x53, 0x54, 0x05, 0xA4, 0x7F, 0xCE, 0x87, 0x9F, 0x91, 0x85, 0x06, 0x67, 0xC3, 0xE1, 0xF9, 
-0xC5, 0xBB, 0x41, 0xD7, 0x4E, 0xBB, 0x73, 0xE3, 0x02, 0xCA, 0xAE, 0x90, 0x2F, 0xC8, 0xB8, 0x67, 0x08, 
-0x02, 0x82, 0x35, 0x1D, 0x29, 0x0D, 0x24, 0x48, 0xD0, 0x33, 0xA4, 0xBA, 0x09, 0x88, 0xF4, 0x09, 0x01, 
-0x3E, 0xD4, 0x4D, 0x04, 0x7C, 0x29, 0x72, 0xAD, 0x6C, 0x3D, 0xA0, 0x04, 0x43, 0x02, 0x51, 0x19, 0x43, 
-0xA6, 0x66, 0x3B, 0xA7, 0xE7, 0xEE, 0x88, 0xBB, 0x37, 0xC8, 0x09, 0xB0, 0x94, 0x5A, 0x64, 0xE5, 0x5B, 
-0x63, 0x7A, 0x4D, 0x5C, 0x2B, 0x24, 0x2C, 0x5E, 0x22, 0x4A, 0x59, 0x14, 0xAB, 0x0C, 0xA7, 0xE3, 0x13, 
-0xE7, 0x6A, 0xC4, 0xAF, 0x8D, 0x19, 0xA0, 0x4F, 0x5D, 0x17, 0xEC, 0x88, 0xA8, 0xDB, 0x33, 0x18, 0x9E, 
-0x58, 0x8A, 0x7B, 0x9E, 0x56, 0x3F, 0x8E, 0x15, 0x77, 0xC0, 0x1C, 0x01, 0x51, 0x00, 0xC6, 0xC7, 0xE3, 
-0x25, 0x94, 0x2E, 0x9D, 0xCC, 0x10, 0x00, 0x10, 0x4A, 0x08, 0x23, 0x4F, 0x50, 0xD7, 0xD2, 0x46, 0xC0, 
-0x94, 0x11, 0x91, 0x1F, 0xBF, 0x0A, 0x53, 0x3A, 0x68, 0x75, 0xA0, 0xE0, 0xD3, 0xA2, 0x21, 0xEB, 0xF8, 
-0x02, 0xB0, 0x7E, 0x60, 0xB1, 0x08, 0x5D, 0x4B, 0xAB, 0xDD, 0x41, 0x32, 0xB4, 0x5E, 0xA3, 0xD0, 0xB5, 
-0x7E, 0x2D, 0x83, 0x4E, 0x15, 0x13, 0x7A, 0x48, 0x0A, 0xA7, 0x67, 0x04, 0xDC, 0xE3, 0x5F, 0xA6, 0x3E, 
-0x55, 0xA4, 0x19, 0x31, 0x6F, 0xAE, 0x1B, 0xDD, 0x0D, 0x9A, 0x08, 0xB4, 0x13, 0x82, 0x73, 0x6C, 0xC4, 
-0x15, 0x07, 0x1B, 0xEE, 0x66, 0xB6, 0xEF, 0x77, 0x71, 0x66, 0x7C, 0xDB, 0xC5, 0xD2, 0x1F, 0x71, 0x2C, 
-0xDC, 0x05, 0x31, 0x70, 0x0D, 0xA3, 0x7F, 0x3A, 0xEB, 0xEF, 0xDA, 0xB8, 0xDF, 0xB5, 0x01, 0xA6, 0x0E, 
-0x56, 0xF0, 0x49, 0x45, 0x99, 0x27, 0x57, 0x90, 0x0E, 0xB2, 0xEE, 0xEA, 0x38, 0x67, 0xF0, 0xD8, 0x51, 
-0x74, 0x02, 0xA1, 0xB7, 0x20, 0xC1, 0x88, 0x9A, 0x72, 0x71, 0xB5, 0x42, 0xE1, 0x22, 0xED, 0xBD, 0x13, 
-0xD3, 0xE1, 0x37, 0xA5, 0x56, 0xD0, 0x7D, 0xFC, 0xD7, 0x70, 0x78, 0x27, 0x5C, 0x3E, 0x09, 0xA2, 0x15, 
-0x5C, 0xEF, 0xA1, 0xEB, 0x4E, 0xB8, 0xB4, 0xF5, 0xE3, 0x55, 0xCE, 0x3E, 0x24, 0x9D, 0x15, 0xF0, 0x75, 
-0xED, 0x52, 0x8F, 0xE8, 0xDA, 0xE0, 0xBA, 0x77, 0xF4, 0xEA, 0x5F, 0xB4, 0x57, 0xBF, 0x42, 0x3A, 0x35, 
-0x58, 0x82, 0x7A, 0xBE, 0xDA, 0xE8, 0x94, 0x39, 0x64, 0x3A, 0x71, 0x6C, 0x87, 0x48, 0xA0, 0x64, 0x84, 
-0x59, 0x92, 0x0F, 0x7C, 0xCB, 0x09, 0xB8, 0x03, 0x52, 0xB7, 0x5A, 0xCD, 0xE4, 0x5F, 0xAB, 0x65, 0xB7, 
-0x5A, 0x6F, 0x92, 0x7F, 0x5D, 0x5B, 0x0F, 0xAB, 0x82, 0xAA, 0xFF, 0xBD, 0xFA, 0xD8, 0x8C, 0xAC, 0x94, 
-0xD4, 0x05, 0xB7, 0x1D, 0x9C, 0x9F, 0x3E, 0x28, 0x19, 0x01, 0x74, 0x8C, 0xFE, 0x67, 0xA0, 0xF3, 0xA0, 
-0x64, 0x26, 0x3C, 0x50, 0x58, 0x4F, 0x60, 0xA0, 0xC2, 0xDF, 0x1E, 0x94, 0x52, 0x12, 0x4A, 0xFD, 0x8B, 
-0x4F, 0x5B, 0x01, 0x37, 0xBA, 0x60, 0xC9, 0xBD, 0xA2, 0xFE, 0xD5, 0xBE, 0xB5, 0xEB, 0x00, 0x8F, 0x48, 
-0x80, 0xC6, 0x5C, 0x2C, 0xCD, 0x2E, 0x3A, 0x78, 0xF4, 0x8D, 0x92, 0x29, 0xA5, 0xD2, 0x1C, 0x52, 0x32, 
-0x35, 0xAC, 0x06, 0x50, 0x1A, 0x39, 0x10, 0x34, 0xED, 0x4E, 0xE9, 0x4C, 0x02, 0xEC, 0x85, 0x48, 0xA7, 
-0x3A, 0xCE, 0x7A, 0x86, 0x81, 0xA0, 0xB8, 0xF0, 0x39, 0xE8, 0x33, 0xE2, 0x72, 0x11, 0xFE, 0x92, 0x24, 
-0xF7, 0x37, 0x86, 0xDB, 0x98, 0x92, 0xC0, 0x85, 0x1C, 0xBC, 0x35, 0xCD, 0x10, 0x8F, 0x30, 0xB7, 0x7F, 
-0xCE, 0xC6, 0x1C, 0x14, 0x91, 0x5E, 0x6C, 0x01, 0xC9, 0x49, 0xB5, 0x79, 0x9A, 0xDD, 0x06, 0xBD, 0x61, 
-0x46, 0xAD, 0xAC, 0xCA, 0xA3, 0x8A, 0xF9, 0xA7, 0xD8, 0x55, 0x33, 0x8C, 0x5A, 0xE9, 0x56, 0xE2, 0x05, 
-0x69, 0xA4, 0xBF, 0xA9, 0xE4, 0xED, 0x55, 0x1C, 0xB8, 0xB2, 0x1C, 0xAF, 0x6B, 0x31, 0xAF, 0xB1, 0xE8, 
-0x30, 0xBB, 0xFE, 0x92, 0xA4, 0xA7, 0x22, 0x39, 0x6A, 0x71, 0x55, 0x71, 0x6C, 0xE5, 0x71, 0x4F, 0xDD, 
-0xC8, 0xE7, 0x97, 0x3B, 0x64, 0x62, 0x1A, 0x3D, 0x1B, 0xB8, 0xAE, 0x81, 0xA1, 0x08, 0x44, 0x1F, 0xB1, 
-0xBC, 0xDA, 0x21, 0x33, 0x43, 0x35, 0x1B, 0x02, 0xC7, 0xCF, 0xB6, 0xAE, 0x6B, 0xEB, 0x77, 0x58, 0x91, 
-0x29, 0xBE, 0xD9, 0x21, 0x53, 0x7B, 0x29, 0xC7, 0xCF, 0xA6, 0xAE, 0x6B, 0xEA, 0xD3, 0x8B, 0xC1, 0x0E, 
-0x99, 0xD9, 0x65, 0xF2, 0xD9, 0xC4, 0x75, 0x4D, 0xFC, 0xF1, 0xED, 0xC9, 0x0E, 0x99, 0x38, 0xC4, 0xCE, 
-0x93, 0x32, 0xF1, 0xB6, 0x31, 0x5D, 0x7B, 0xCB, 0xC2, 0x00, 0x06, 0x80, 0x18, 0x4F, 0x6C, 0x75, 0x32, 
-0x7F, 0xA4, 0xF3, 0x33, 0x16, 0x28, 0x2F, 0x2C, 0xEB, 0x84, 0x33, 0x96, 0x4A, 0x81, 0x06, 0x0A, 0x72, 
-0xB5, 0x65, 0xED, 0x52, 0x64, 0xA5, 0xEB, 0xDC, 0xA2, 0xA5, 0x8D, 0x96, 0xE5, 0xCD, 0xFA, 0x7A, 0xF7, 
-0x89, 0x46, 0x97, 0x33, 0xB7, 0x82, 0xD4, 0x8C, 0x17, 0xC6, 0xD9, 0x85, 0xFD, 0xF6, 0x51, 0xB3, 0x29, 
-0x38, 0x4B, 0xE6, 0x9C, 0x72, 0x4F, 0x9C, 0x64, 0x26, 0xCE, 0xD3, 0xF7, 0x93, 0xF9, 0xC3, 0x26, 0x16, 
-0x87, 0xC0, 0x75, 0xF1, 0x5C, 0xDB, 0x7A, 0x90, 0xB9, 0xA4, 0x8E, 0x7F, 0x0C, 0xF1, 0x28, 0x20, 0xE8, 
-0xA7, 0x78, 0x89, 0x4A, 0x48, 0xE5, 0xB5, 0xA0, 0x53, 0x9F, 0xE0, 0x41, 0x2D, 0xBD, 0x2A, 0xFD, 0x7C, 
-0xF6, 0x47, 0xB1, 0xA4, 0x98, 0x44, 0x4D, 0x88, 0x8C, 0x7E, 0xF6, 0xB8, 0x15, 0x1A, 0x77, 0x03, 0x3F, 
-0xF1, 0x31, 0xA4, 0x8E, 0xE0, 0x07, 0x30, 0x0C, 0x88, 0x13, 0x0B, 0xF2, 0x03, 0x08, 0xD2, 0x27, 0xB9, 
-0xB5, 0xC1, 0x01, 0xA4, 0x8E, 0xCE, 0x34, 0x85, 0xE5, 0xDD, 0xCE, 0xED, 0xBC, 0x25, 0x5B, 0x75, 0x49, 
-0xD8, 0x64, 0x2E, 0xA9, 0xAB, 0x95, 0xA4, 0xB7, 0x72, 0x90, 0x24, 0x7E, 0x76, 0xCF, 0x61, 0x82, 0x3E, 
-0x93, 0xB1, 0x20, 0xD2, 0x47, 0x19, 0x5B, 0x28, 0xA0, 0x52, 0x35, 0xD1, 0xA3, 0x64, 0xD5, 0x7A, 0x79, 
-0x68, 0xB6, 0x4B, 0xF3, 0x15, 0x4F, 0xB0, 0x74, 0x04, 0x8D, 0xD4, 0x1B, 0x8F, 0xA8, 0x45, 0x0D, 0x91, 
-0x4C, 0xBB, 0x8D, 0x83, 0x63, 0x04, 0xBD, 0x59, 0x1A, 0x80, 0xAB, 0x79, 0xB6, 0x1A, 0x29, 0x86, 0xE0, 
-0xBF, 0x35, 0x0A, 0x62, 0x62, 0xF4, 0x33, 0x2D, 0xE8, 0x5D, 0x9D, 0xC7, 0x4B, 0x59, 0xE8, 0x3D, 0x14, 
-0x74, 0x7A, 0x4B, 0x1B, 0xED, 0xD6, 0xA4, 0x56, 0xB6, 0xA6, 0x98, 0x89, 0xF3, 0xE4, 0x17, 0x16, 0xF9, 
-0xED, 0x71, 0xAD, 0x83, 0x74, 0x2F, 0xDC, 0xCF, 0xD8, 0x37, 0xB2, 0x63, 0x06, 0x8B, 0xEB, 0x09, 0x06, 
-0xA7, 0xD1, 0x95, 0x78, 0x51, 0xB6, 0x46, 0x51, 0x80, 0x1D, 0xE2, 0xF3, 0xC0, 0x25, 0xA2, 0x67, 0x7C, 
-0xE6, 0x23, 0xAE, 0xD0, 0xF9, 0xA9, 0xDE, 0xE2, 0xFF, 0x16, 0x53, 0x41, 0x5C, 0x7D, 0x72, 0x20, 0x6D, 
-0x19, 0xF6, 0x23, 0x3A, 0x9B, 0xCE, 0xF5, 0xBB, 0x58, 0x3B, 0x25, 0x1B, 0x49, 0xA5, 0x8F, 0xDF, 0xB3, 
-0x6D, 0x84, 0x27, 0x5E, 0x42, 0x15, 0xFB, 0x5B, 0x2A, 0x54, 0xEA, 0x6B, 0xEB, 0x02, 0x16, 0xBB, 0x97, 
-0x96, 0xF7, 0xC9, 0xB9, 0xD6, 0xE5, 0xDB, 0xC1, 0x60, 0x67, 0x5D, 0x2B, 0x02, 0xB4, 0x30, 0x57, 0x14, 
-0xBB, 0xD7, 0x65, 0x76, 0x73, 0xA7, 0x3C, 0x6C, 0x21, 0x91, 0xF6, 0xB2, 0xC5, 0x55, 0xEA, 0x69, 0xC5, 
-0xF2, 0x16, 0x7B, 0xDB, 0x4C, 0xFC, 0x47, 0xF5, 0x2E, 0x34, 0xC0, 0x93, 0x07, 0x9E, 0x21, 0xF3, 0xDA, 
-0x93, 0xF1, 0x28, 0xA4, 0xAA, 0xA0, 0x6C, 0xE0, 0xCE, 0x55, 0xD2, 0x0A, 0xDD, 0xE4, 0x0F, 0x17, 0x98, 
-0x79, 0x8B, 0xB9, 0x41, 0x33, 0x69, 0x3C, 0x3F, 0x5D, 0xDA, 0xF0, 0x74, 0x49, 0xD7, 0x67, 0xD4, 0x41, 
-0x3F, 0xFB, 0x21, 0xD3, 0xE9, 0xFB, 0x93, 0xCB, 0x9D, 0x4D, 0x4E, 0xAE, 0xEF, 0x14, 0xEF, 0x4A, 0x6A, 
-0xA9, 0x76, 0xE3, 0x11, 0xD3, 0x0C, 0xCB, 0xEC, 0x14, 0x62, 0xDD, 0x95, 0x5A, 0xF1, 0x51, 0x46, 0x9D, 
-0xD9, 0x52, 0xE5, 0xA4, 0x59, 0x2D, 0x6D, 0xDB, 0x75, 0x91, 0xE7, 0x2B, 0xD9, 0x04, 0x79, 0x88, 0xC5, 
-0x95, 0x5E, 0xA8, 0xD5, 0xA8, 0x5F, 0x6B, 0xEB, 0xF6, 0x01, 0x72, 0xE4, 0xF9, 0xE5, 0x9E, 0x3C, 0x16, 
-0x3B, 0x7F, 0x14, 0xAF, 0xEE, 0xDC, 0x43, 0x35, 0x47, 0xA3, 0x2F, 0xAD, 0x99, 0x37, 0xA6, 0xED, 0xC2, 
-0xF9, 0xB5, 0xA0, 0x74, 0xDB, 0x41, 0x49, 0xDB, 0x39, 0x49, 0xDB, 0x7B, 0x2D, 0x69, 0x27, 0x27, 0x69, 
-0x67, 0xAF, 0x25, 0x3D, 0xCA, 0x49, 0x7A, 0xF4, 0x68, 0x92, 0xD6, 0xDC, 0x12, 0x48, 0x4E, 0x9F, 0xEC, 
-0xCF, 0x96, 0xC0, 0xEC, 0x30, 0xCD, 0x4E, 0x66, 0x40, 0x16, 0x2E, 0x32, 0x60, 0xDA, 0xDE, 0xD7, 0x68, 
-0x01, 0xE9, 0xDA, 0x39, 0x49, 0xDB, 0x7B, 0x2D, 0x69, 0x27, 0x27, 0x69, 0x67, 0xAF, 0x25, 0x3D, 0xCA, 
-0x49, 0xBA, 0x1B, 0x19, 0x30, 0x3B, 0x93, 0xB5, 0x27, 0x09, 0x70, 0x71, 0xC2, 0x6C, 0x27, 0xF3, 0x9F, 
-0x37, 0x5D, 0xE4, 0xBF, 0xB4, 0xBD, 0xAF, 0xB1, 0x02, 0xD2, 0xB5, 0x73, 0x92, 0xB6, 0xF7, 0x5A, 0xD2, 
-0x4E, 0x4E, 0xD2, 0xCE, 0x5E, 0x4B, 0x7A, 0x94, 0x93, 0x74, 0x37, 0xF2, 0xDF, 0xE9, 0xC5, 0x60, 0x4F, 
-0x72, 0x5F, 0x7A, 0xE4, 0x72, 0x27, 0xF3, 0x9E, 0xCB, 0xE4, 0x22, 0xF1, 0x65, 0x17, 0xFB, 0x1A, 0x25, 
-0x5A, 0xBC, 0x76, 0x5E, 0xD6, 0xF6, 0x7E, 0xCB, 0xDA, 0xC9, 0xCB, 0xDA, 0xD9, 0x6F, 0x59, 0x8F, 0xF2, 
-0xB2, 0xEE, 0x46, 0xFE, 0x7B, 0xDE, 0x1B, 0xB9, 0xBF, 0xBD, 0x91, 0x3B, 0xBD, 0xEC, 0x98, 0x53, 0xEA, 
-0x98, 0x73, 0x45, 0x04, 0x0A, 0x95, 0xF5, 0xAA, 0xF5, 0xB3, 0xDF, 0x84, 0x5F, 0xBC, 0xF2, 0xD8, 0x4A, 
-0x67, 0x26, 0x87, 0x30, 0x60, 0xC6, 0xBA, 0x96, 0x1B, 0x77, 0x70, 0x22, 0x94, 0x7C, 0x82, 0x40, 0x6F, 
-0x0A, 0xBA, 0x2E, 0x65, 0x9E, 0xA5, 0x78, 0xF4, 0x06, 0xB5, 0x5B, 0xD1, 0xF5, 0xB1, 0xD1, 0xEF, 0x4A, 
-0xF0, 0x78, 0xE6, 0x25, 0x1F, 0x49, 0xE8, 0xDA, 0xD9, 0x05, 0x9A, 0x62, 0x89, 0x5C, 0x22, 0xA9, 0xC7, 
-0x88, 0x8B, 0x30, 0x03, 0x7B, 0xC7, 0x34, 0x50, 0x68, 0x74, 0x83, 0x3E, 0x89, 0x80, 0x32, 0x74, 0x4A, 
-0xC1, 0x43, 0x04, 0x9F, 0x34, 0xBB, 0x76, 0xF4, 0x33, 0xDE, 0x36, 0x4D, 0x4F, 0x02, 0x25, 0x5F, 0xA7, 
-0x88, 0xB1, 0x47, 0xF2, 0xC7, 0x83, 0x96, 0x3E, 0xAA, 0x90, 0xEF, 0x4E, 0x3E, 0x00, 0x60, 0x87, 0xD4, 
-0x11, 0x1C, 0x7F, 0xC5, 0xD7, 0xCD, 0xAF, 0xC9, 0xD9, 0xAC, 0xF4, 0xEE, 0xFD, 0xE0, 0x76, 0xC9, 0xE4, 
-0x8B, 0x3E, 0x4D, 0x1B, 0xCB, 0xCA, 0xC8, 0xCD, 0x05, 0x16, 0x33, 0x45, 0x6E, 0xAE, 0x20, 0x37, 0xE7, 
-0x1F, 0x85, 0x98, 0xFD, 0xC6, 0x31, 0x4B, 0x8F, 0x4F, 0x7B, 0x44, 0xE9, 0x57, 0x4B, 0x7F, 0xD3, 0xF1, 
-0x26, 0x1B, 0x07, 0xE8, 0x7F, 0xEB, 0xDA, 0x85, 0x88, 0xC8, 0x6E, 0x9B, 0x36, 0x8E, 0xA8, 0x3D, 0x69, 
-0xDB, 0xFA, 0xE4, 0x2F, 0x05, 0x30, 0xF3, 0xE0, 0x78, 0x79, 0xFC, 0xED, 0x26, 0x42, 0xD9, 0x06, 0x5E, 
-0x4D, 0x5A, 0x8C, 0x28, 0x67, 0xEC, 0xD5, 0xA0, 0x04, 0x38, 0xF4, 0x61, 0x87, 0x46, 0x92, 0x43, 0x0A, 
-0xA9, 0xB8, 0xDC, 0x89, 0x43, 0xF0, 0xF3, 0x26, 0x30, 0x75, 0x16, 0x10, 0xDD, 0xFC, 0xC7, 0xCD, 0xB9, 
-0xDB, 0x30, 0xF5, 0x61, 0x0A, 0xF3, 0xA0, 0x99, 0x40, 0xA2, 0x5E, 0x9A, 0x85, 0xEE, 0x20, 0x61, 0x2A, 
-0xDB, 0x3A, 0xDD, 0x1C, 0x8B, 0x4E, 0x2C, 0xA8, 0xBA, 0x19, 0x28, 0xD1, 0x98, 0xB5, 0x0B, 0x39, 0xD5, 
-0x3F, 0x3A, 0x46, 0xF3, 0x41, 0xA8, 0xD7, 0x43, 0xBF, 0x96, 0x8E, 0xD4, 0x3F, 0x41, 0x54, 0x2C, 0x18, 
-0x32, 0x3F, 0x45, 0x84, 0x99, 0xC7, 0xC5, 0xE3, 0x6E, 0x8B, 0xBB, 0x49, 0x20, 0xC9, 0x1A, 0xB5, 0x57, 
-0x95, 0xA8, 0xFD, 0xE7, 0xEC, 0xF2, 0x3E, 0x88, 0x75, 0xAA, 0x11, 0xBB, 0x7C, 0x7B, 0x1F, 0xC4, 0x7E, 
-0xA9, 0x4A, 0xAC, 0x73, 0x1F, 0xD4, 0x5E, 0x57, 0xA5, 0x66, 0xD7, 0xA4, 0x78, 0xBB, 0xC5, 0xD3, 0xB6, 
-0x05, 0xC3, 0x8F, 0x06, 0xC4, 0x76, 0x1E, 0xA6, 0x74, 0x4C, 0x07, 0x0E, 0x66, 0x0D, 0x41, 0x64, 0x29, 
-0x0B, 0x13, 0x2C, 0x10, 0x16, 0x02, 0xDF, 0x1C, 0x17, 0xE1, 0x9A, 0xC5, 0xC1, 0x0B, 0x40, 0x81, 0xBE, 
-0x7F, 0x47, 0x1A, 0x55, 0x53, 0x61, 0x01, 0xFC, 0x36, 0xA1, 0x19, 0x71, 0x26, 0xC9, 0x10, 0x92, 0x9E, 
-0xD6, 0xB4, 0xF9, 0xC7, 0x5F, 0xE6, 0xC1, 0x46, 0x6D, 0x83, 0x52, 0x86, 0x34, 0x24, 0x3C, 0x56, 0x8D, 
-0x39, 0x93, 0x3A, 0x66, 0x97, 0x0F, 0x80, 0xA2, 0xDB, 0x43, 0xF4, 0xAA, 0xD5, 0x6A, 0x1D, 0x1C, 0x6F, 
-0xB3, 0x5B, 0xB9, 0xB1, 0x8A, 0x6F, 0x24, 0x72, 0x82, 0x3A, 0xFF, 0x39, 0xF8, 0x74, 0xD1, 0x8C, 0xF4, 
-0x77, 0x8F, 0xCA, 0xE4, 0x29, 0xA3, 0x9D, 0x60, 0x68, 0x4A, 0x2E, 0xF2, 0x12, 0xE0, 0x43, 0x34, 0xD2, 
-0x52, 0x64, 0xCE, 0x84, 0x9B, 0xFA, 0x9B, 0x15, 0xC8, 0x42, 0xA3, 0xB4, 0x71, 0xBB, 0x19, 0x99, 0x20, 
-0x13, 0xA2, 0x39, 0x29, 0x1B, 0x55, 0xEA, 0x23, 0xD9, 0xE9, 0x7E, 0x70, 0x13, 0xCA, 0xA0, 0x38, 0x79, 
-0x3F, 0xFC, 0xF8, 0x01, 0x64, 0x4B, 0x91, 0x06, 0x84, 0x79, 0xCA, 0x3F, 0x2E, 0x37, 0x79, 0x7A, 0x22, 
-0xBE, 0xB7, 0x01, 0x7B, 0x76, 0x08, 0xDA, 0x2C, 0xE3, 0x2B, 0xC1, 0xB0, 0x44, 0xDA, 0x2C, 0x8B, 0x1E, 
-0xA8, 0xDF, 0x50, 0x43, 0x53, 0xA5, 0x30, 0xAA, 0x75, 0x0C, 0x7F, 0xBA, 0xCB, 0x7C, 0x22, 0xFA, 0xF2, 
-0xE5, 0x46, 0xCF, 0xD1, 0xC0, 0x50, 0x5D, 0xE5, 0x19, 0x76, 0x04, 0xC1, 0x8A, 0x64, 0x3C, 0x37, 0x4C, 
-0x25, 0xCC, 0x8D, 0x0E, 0xC3, 0xA7, 0xCB, 0xBC, 0x76, 0x95, 0xDB, 0x37, 0xD1, 0x4B, 0x68, 0x64, 0xC7, 
-0x94, 0x73, 0xA7, 0x94, 0x67, 0xC1, 0xFB, 0xA7, 0xA9, 0x47, 0x24, 0x9C, 0xFE, 0x41, 0xFF, 0x6A, 0xEA, 
-0xA0, 0xD4, 0x10, 0x7F, 0x02, 0xA5, 0x7E, 0xE1, 0x9D, 0xF4, 0x9B, 0x33, 0x1A, 0xF3, 0xCB, 0x72, 0x56, 
-0xE6, 0xA4, 0xE7, 0xE0, 0x4E, 0x7A, 0x2C, 0x3F, 0xC5, 0x50, 0x15, 0x3A, 0x3F, 0x97, 0x2D, 0x18, 0x49, 
-0x8E, 0xE7, 0x1F, 0xD4, 0xC3, 0x34, 0x87, 0x4E, 0xDC, 0x75, 0x0E, 0xBA, 0x41, 0x9B, 0xA9, 0xED, 0x71, 
-0x04, 0x73, 0x9D, 0x7B, 0xE2, 0xD3, 0xC0, 0x6D, 0x80, 0x7E, 0x0F, 0x7E, 0x20, 0x77, 0xEA, 0xA5, 0x19, 
-0x91, 0x90, 0x46, 0x10, 0x23, 0x53, 0xF4, 0xFB, 0xC7, 0x0F, 0xEF, 0x95, 0x8A, 0x3E, 0xA7, 0x9D, 0x6B, 
-0x91, 0xA1, 0x13, 0x52, 0x06, 0x50, 0xE8, 0x34, 0xD9, 0xBD, 0x26, 0x07, 0xF6, 0x1A, 0xE6, 0xBB, 0xB3, 
-0xA1, 0x79, 0x88, 0xE6, 0x65, 0x8D, 0x84, 0x84, 0x08, 0xD7, 0x4A, 0x40, 0x5A, 0x3E, 0x2E, 0x87, 0x85, 
-0xF2, 0xFA, 0x6C, 0x02, 0x8E, 0xF5, 0x81, 0x4A, 0x45, 0xC0, 0x6D, 0x1A, 0x66, 0xC0, 0xB1, 0x0B, 0x80, 
-0xB3, 0xA4, 0xBA, 0x09, 0x58, 0x82, 0x5A, 0x1A, 0x05, 0x85, 0x53, 0xA5, 0x5A, 0x66, 0xED, 0x7C, 0x7C, 
-0x8D, 0xDA, 0x30, 0x79, 0x1F, 0x6C, 0x7B, 0xC9, 0x36, 0xA5, 0xCC, 0x85, 0x78, 0xE0, 0x4C, 0xCB, 0x04, 
-0x3A, 0x5F, 0x4A, 0xC6, 0xEB, 0xC4, 0x74, 0xF0, 0xC5, 0x22, 0x80, 0x81, 0xC6, 0x8C, 0x18, 0xD1, 0xBA, 
-0x91, 0xC6, 0x71, 0xF1, 0xE0, 0xF4, 0xAB, 0x6E, 0x83, 0xA4, 0x9C, 0xCE, 0x4C, 0x7A, 0x9A, 0xEB, 0x6A, 
-0x00, 0xB2, 0x22, 0xF5, 0xE5, 0xC1, 0x9A, 0xFA, 0x5B, 0x70, 0x85, 0x39, 0x31, 0x37, 0x89, 0x2C, 0x15, 
-0xD1, 0xC9, 0xA4, 0xB1, 0x1D, 0x60, 0xA5, 0x18, 0x3E, 0x44, 0xED, 0x4A, 0x60, 0x2B, 0x56, 0x39, 0x44, 
-0x9D, 0x56, 0x0D, 0x6A, 0x30, 0xBC, 0x80, 0xCA, 0x6D, 0x7E, 0x95, 0xB4, 0xB4, 0xDE, 0xE8, 0xDA, 0xD9, 
-0x6B, 0x27, 0x5D, 0x3B, 0xFB, 0xA4, 0xDF, 0xFF, 0x01, 0x98, 0xAF, 0x88, 0xD6, 0xE4, 0x4F, 0x00, 0x00
-};#endif // _BZF_NETWORK_H
\ No newline at end of file
+// // bzf_network.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_NETWORK_H#define _BZF_NETWORK_H #define BZF_NETWORK_MT "text/html"#define BZF_NETWORK_PATH "/network.html"#define BZF_NETWORK_SIZE 2486#define BZF_NETWORK_HASH 0x275E555DULconst uint8_t bzf_network[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0x5C, 0x6F, 0x73, 0xDA, 0x38, 0x1A, 
+0x7F, 0xDF, 0x4F, 0xA1, 0xFA, 0x0D, 0x64, 0x1A, 0x63, 0x20, 0xDB, 0xD9, 0x4E, 0x03, 0xCC, 0xF4, 0x92, 
+0x4C, 0x93, 0x9B, 0x36, 0xCD, 0x15, 0x6E, 0x6F, 0x6F, 0x76, 0x77, 0x3A, 0xC2, 0x16, 0xB6, 0x1A, 0x5B, 
+0x72, 0x2D, 0x19, 0x92, 0xB9, 0xE6, 0xBB, 0xDF, 0x23, 0xCB, 0x06, 0x03, 0x22, 0x18, 0xB6, 0x69, 0x02, 
+0x93, 0x4C, 0x32, 0xB1, 0x65, 0x3D, 0xFF, 0x7F, 0xCF, 0x23, 0xD9, 0x92, 0xDD, 0x79, 0x79, 0xFA, 0xE9, 
+0x64, 0xF0, 0xDF, 0xAB, 0x33, 0x14, 0xC8, 0x28, 0xEC, 0xBD, 0xE8, 0xA8, 0x7F, 0x28, 0xC4, 0xCC, 0xEF, 
+0x5A, 0x84, 0x59, 0xBD, 0x17, 0x08, 0x7E, 0x3A, 0x01, 0xC1, 0x9E, 0x3E, 0xCC, 0x4E, 0x23, 0x22, 0x31, 
+0x72, 0x03, 0x9C, 0x08, 0x22, 0xBB, 0x56, 0x2A, 0x47, 0xF6, 0x1B, 0x6B, 0xF1, 0x72, 0x20, 0x65, 0x6C, 
+0x93, 0x6F, 0x29, 0x1D, 0x77, 0xAD, 0xDF, 0xED, 0x7F, 0xBF, 0xB3, 0x4F, 0x78, 0x14, 0x63, 0x49, 0x87, 
+0x21, 0xB1, 0x90, 0xCB, 0x99, 0x24, 0x0C, 0x68, 0x2F, 0xCE, 0xBA, 0xC4, 0xF3, 0xC9, 0x12, 0x35, 0xC3, 
+0x11, 0xE9, 0x5A, 0x63, 0x4A, 0x26, 0x31, 0x4F, 0x64, 0x89, 0x60, 0x42, 0x3D, 0x19, 0x74, 0x3D, 0x32, 
+0xA6, 0x2E, 0xB1, 0xB3, 0x93, 0x43, 0x44, 0x19, 0x95, 0x14, 0x87, 0xB6, 0x70, 0x71, 0x48, 0xBA, 0xAD, 
+0x32, 0x33, 0x49, 0x65, 0x48, 0x7A, 0x17, 0x7C, 0xF0, 0x19, 0xD9, 0xA8, 0x7F, 0x36, 0x18, 0x5C, 0x5C, 
+0xBE, 0xEF, 0x77, 0x1C, 0xDD, 0x3C, 0xEB, 0x16, 0x52, 0x76, 0x8D, 0x82, 0x84, 0x8C, 0xBA, 0x56, 0x42, 
+0xC0, 0xA8, 0x86, 0x2B, 0x84, 0x85, 0x12, 0x12, 0x76, 0x2D, 0x21, 0x6F, 0x43, 0x22, 0x02, 0x42, 0x40, 
+0x0B, 0x79, 0x1B, 0x83, 0x56, 0x92, 0xDC, 0x48, 0x47, 0x75, 0x30, 0x33, 0xC8, 0x08, 0xAA, 0x32, 0xD0, 
+0xEE, 0x75, 0x66, 0xFE, 0xED, 0x0C, 0xB9, 0x77, 0x8B, 0xDC, 0x10, 0x0B, 0xA1, 0x8C, 0x95, 0x81, 0x3D, 
+0xA2, 0x37, 0xC4, 0xB3, 0x23, 0xC2, 0xD2, 0xB2, 0x40, 0xCA, 0xE2, 0x54, 0xE6, 0xFC, 0xDC, 0x80, 0xB8, 
+0xD7, 0x43, 0x7E, 0x63, 0x15, 0x74, 0x01, 0xF5, 0x3C, 0x08, 0x1E, 0xA2, 0x5E, 0xD7, 0x62, 0x78, 0x6C, 
+0x4B, 0xEE, 0xFB, 0xCA, 0xED, 0x38, 0x95, 0xDC, 0x85, 0x30, 0x84, 0x44, 0x02, 0x19, 0x1F, 0x8D, 0xCA, 
+0x1C, 0x3D, 0x3A, 0x2E, 0xE8, 0x81, 0x06, 0x65, 0x62, 0x91, 0x9F, 0x50, 0xCF, 0x56, 0xCE, 0xC7, 0x94, 
+0x91, 0xA4, 0xD4, 0x7D, 0x91, 0x64, 0x55, 0x9F, 0xC5, 0x7E, 0x09, 0x9F, 0x18, 0x7A, 0x2C, 0x73, 0x0B, 
+0x21, 0xE4, 0xA1, 0xCD, 0x62, 0x74, 0x23, 0xEC, 0x56, 0x1B, 0x89, 0xC8, 0x7E, 0x83, 0x22, 0xCF, 0xFE, 
+0x75, 0x05, 0xB1, 0xF6, 0x49, 0xE4, 0x23, 0x91, 0xB8, 0x5D, 0x2B, 0xE4, 0x3E, 0xFF, 0x32, 0x09, 0xA8, 
+0x24, 0x8D, 0x98, 0xF9, 0x53, 0xB7, 0xA8, 0x66, 0x70, 0x42, 0xA8, 0x70, 0x07, 0x88, 0xB8, 0x8F, 0x55, 
+0x1A, 0xAE, 0xBE, 0x98, 0x07, 0xBC, 0xD7, 0xC1, 0x79, 0xC4, 0x1D, 0x0F, 0x8B, 0x60, 0xC8, 0x71, 0xE2, 
+0xCD, 0x44, 0x01, 0x1E, 0xAC, 0xDE, 0x69, 0xD1, 0xDE, 0x71, 0x70, 0xAF, 0xE3, 0x00, 0xCD, 0x06, 0x4C, 
+0x01, 0x86, 0x92, 0x32, 0x5F, 0x2C, 0xF0, 0xEC, 0xE7, 0xCD, 0x95, 0x59, 0x16, 0xE4, 0xD8, 0x95, 0x74, 
+0x0C, 0x99, 0x36, 0x93, 0xC0, 0x88, 0x9C, 0xF0, 0xE4, 0x7A, 0x41, 0xC0, 0xA5, 0x6E, 0xDD, 0x46, 0xE5, 
+0xE8, 0x9B, 0x94, 0x0B, 0xDC, 0x3E, 0xFE, 0x6B, 0x30, 0xD8, 0x86, 0x55, 0x40, 0xC2, 0x78, 0x81, 0xD5, 
+0x39, 0x34, 0x6D, 0xC3, 0x4A, 0x85, 0x3D, 0x5D, 0xD4, 0xEB, 0x43, 0xD6, 0xB8, 0x9E, 0x5D, 0xC7, 0x59, 
+0x05, 0x85, 0x8E, 0x03, 0x80, 0xDD, 0x0E, 0xCA, 0xBF, 0x28, 0x28, 0xBF, 0x46, 0xAA, 0x0E, 0xD8, 0x09, 
+0xF5, 0x03, 0x79, 0x1F, 0x14, 0x4B, 0xBC, 0x54, 0x99, 0x58, 0x4B, 0x90, 0x11, 0x89, 0x18, 0xB3, 0x2C, 
+0xFD, 0x03, 0xDB, 0x0D, 0xB9, 0x0B, 0x06, 0x37, 0x9B, 0x8D, 0xEC, 0xB7, 0xD9, 0x74, 0x9A, 0xCD, 0xB7, 
+0xD9, 0x6F, 0xC7, 0x51, 0xDD, 0x2A, 0x70, 0xEA, 0x7D, 0xAF, 0xDC, 0x35, 0x17, 0x2A, 0x04, 0xF5, 0x00, 
+0xAB, 0xFD, 0x8B, 0xD3, 0x07, 0x14, 0x92, 0x80, 0x14, 0xAB, 0xF7, 0x19, 0xA4, 0x3C, 0xA0, 0x90, 0x31, 
+0x0F, 0x25, 0x56, 0x23, 0x14, 0x38, 0xEF, 0xB7, 0x07, 0x94, 0x93, 0xE5, 0x4E, 0xEF, 0xF2, 0xD3, 0x3A, 
+0xBA, 0xFB, 0x60, 0x67, 0xBE, 0x64, 0x68, 0x5E, 0x68, 0x5A, 0x3C, 0x0D, 0xF1, 0x90, 0x84, 0x68, 0xC4, 
+0x93, 0xB9, 0xE1, 0x43, 0x65, 0x8A, 0xBA, 0x60, 0x1E, 0x33, 0xAA, 0x0C, 0x12, 0xE6, 0xE2, 0xBF, 0x98, 
+0x2D, 0x3A, 0x4D, 0x20, 0x43, 0x5A, 0xED, 0x55, 0x43, 0x05, 0xA8, 0x16, 0x21, 0x55, 0xD0, 0x38, 0xEB, 
+0x5A, 0x16, 0x82, 0x29, 0x43, 0xC0, 0xC1, 0x8B, 0x31, 0x17, 0xB3, 0x3C, 0x17, 0x24, 0xBB, 0x7E, 0x5F, 
+0x6A, 0x8D, 0x28, 0x09, 0x3D, 0xA8, 0xB3, 0xEB, 0xAA, 0x09, 0xF1, 0x09, 0xF3, 0x7A, 0x17, 0x6C, 0xC4, 
+0xC1, 0x05, 0xFA, 0xE4, 0x7E, 0x8A, 0x92, 0x45, 0xF7, 0x8E, 0xA0, 0xEB, 0x88, 0x57, 0x8F, 0x96, 0x95, 
+0x9D, 0x78, 0x54, 0xAD, 0xCC, 0x98, 0xA1, 0x99, 0x33, 0x54, 0xEE, 0xB6, 0xB3, 0xD8, 0xEB, 0x9C, 0x7E, 
+0x5B, 0x05, 0xDC, 0x15, 0x00, 0x5B, 0xD9, 0x88, 0x37, 0x9B, 0x68, 0xAE, 0x98, 0xA8, 0x9C, 0xBA, 0xF9, 
+0x92, 0x55, 0x21, 0x93, 0x11, 0x9B, 0xE8, 0x54, 0xAD, 0x6B, 0xD5, 0x6E, 0x4F, 0x3B, 0xB8, 0x17, 0x57, 
+0xBB, 0x12, 0x5A, 0x1A, 0x3F, 0x07, 0x76, 0x83, 0xC0, 0xC2, 0xA4, 0x0E, 0x7D, 0xC4, 0xE2, 0x7A, 0x57, 
+0xC2, 0x0B, 0x53, 0xD3, 0x08, 0xD4, 0x7D, 0x8E, 0xF1, 0x06, 0x31, 0x7E, 0x8F, 0x25, 0x99, 0xE0, 0xDB, 
+0x5D, 0x09, 0xB1, 0xAF, 0xD5, 0x7D, 0x0E, 0xF1, 0x06, 0x21, 0x3E, 0xBD, 0xEC, 0xEF, 0x4A, 0x78, 0x3D, 
+0x26, 0x9E, 0x43, 0xBB, 0x41, 0x68, 0x3F, 0xBE, 0x3B, 0xD9, 0x95, 0xD0, 0x46, 0xD8, 0x7D, 0x3A, 0xA1, 
+0x5D, 0xD3, 0xA5, 0xE3, 0xDC, 0x3F, 0xC9, 0x87, 0xEB, 0x60, 0xC1, 0x53, 0xBA, 0xCD, 0x98, 0x3E, 0x7F, 
+0x79, 0xF8, 0x3B, 0x8D, 0x97, 0xB6, 0x7D, 0xC2, 0x19, 0xD3, 0x16, 0xA0, 0xBE, 0x84, 0x8A, 0x6C, 0xDB, 
+0x3B, 0x93, 0x49, 0xFA, 0x2E, 0xD5, 0x74, 0x8B, 0xA2, 0x0C, 0x79, 0xBB, 0x74, 0xB7, 0xFA, 0x24, 0xB3, 
+0xC9, 0x9D, 0xFA, 0x5F, 0x28, 0xAD, 0x8D, 0x79, 0x75, 0xE9, 0xBC, 0x7B, 0xBC, 0xAA, 0x09, 0x18, 0xC9, 
+0x11, 0x29, 0xF6, 0x01, 0x1B, 0x85, 0x2D, 0x4F, 0x1C, 0x1E, 0xD3, 0x07, 0x43, 0x2C, 0x8D, 0x40, 0x65, 
+0xF3, 0x50, 0xDA, 0x7C, 0x80, 0xF1, 0x62, 0x03, 0x58, 0x0C, 0xF0, 0x30, 0x24, 0xE8, 0x27, 0x80, 0x43, 
+0x66, 0x82, 0xCA, 0x0E, 0x50, 0x55, 0x2E, 0xE1, 0xE1, 0x26, 0x1E, 0x95, 0xEA, 0xE1, 0xE9, 0xDF, 0x64, 
+0xA2, 0x19, 0x25, 0x9B, 0x11, 0xE4, 0xD2, 0xF3, 0x87, 0xA1, 0x70, 0xB0, 0x15, 0xF5, 0x49, 0x80, 0xA1, 
+0x50, 0x84, 0xDB, 0x33, 0xE8, 0x13, 0x37, 0x4D, 0xC8, 0xF6, 0xF4, 0xFA, 0x31, 0xEB, 0xA6, 0xD4, 0x40, 
+0xB1, 0x81, 0xBB, 0x14, 0xFF, 0xB9, 0x95, 0xC6, 0xF5, 0x8A, 0x65, 0xCB, 0x65, 0x59, 0xA2, 0xE4, 0x38, 
+0x54, 0xD3, 0x90, 0xAC, 0xB5, 0x6A, 0x5A, 0x64, 0xE8, 0xFA, 0xA1, 0x89, 0x81, 0x3E, 0x93, 0x51, 0x42, 
+0x44, 0x80, 0x72, 0x9D, 0x50, 0x48, 0x85, 0x6C, 0xA0, 0x47, 0x28, 0x9F, 0x1B, 0xD5, 0x9C, 0x62, 0xC1, 
+0xE4, 0x2B, 0x1E, 0x63, 0xE1, 0x26, 0x34, 0x96, 0x6F, 0x7D, 0x22, 0x67, 0x13, 0x84, 0x6C, 0x58, 0xAD, 
+0x1F, 0x1C, 0x23, 0x68, 0xCD, 0xB3, 0x1E, 0xCE, 0xA6, 0x95, 0x69, 0x28, 0x19, 0x82, 0x3F, 0x7B, 0x18, 
+0xA6, 0xC4, 0xEA, 0xE5, 0x2E, 0x50, 0x0B, 0x2C, 0x8F, 0x54, 0x9E, 0xD0, 0x39, 0x4C, 0xD3, 0xD4, 0x3A, 
+0x32, 0xDA, 0xA1, 0x71, 0x6B, 0xD5, 0xDD, 0x41, 0x61, 0xCB, 0xD3, 0xBE, 0x45, 0x28, 0x2F, 0x4A, 0x2B, 
+0xFB, 0xF5, 0x0A, 0x74, 0x90, 0xEB, 0x6E, 0xE5, 0xAB, 0xFA, 0xB3, 0xF3, 0x31, 0x06, 0xAC, 0xA8, 0x99, 
+0xB5, 0xA9, 0x2C, 0xA3, 0x38, 0xC4, 0x2E, 0x09, 0x78, 0xE8, 0x91, 0xA4, 0x6B, 0x7D, 0xE6, 0x43, 0x2E, 
+0xD1, 0xC5, 0xA9, 0x5A, 0x54, 0xFF, 0x96, 0xD2, 0x84, 0x78, 0x6A, 0xA9, 0x5E, 0x1F, 0x59, 0xCE, 0x63, 
+0x61, 0x4C, 0xD5, 0xF4, 0x9D, 0x9B, 0x15, 0x65, 0xEB, 0x3A, 0x2B, 0x1F, 0x8D, 0xE7, 0xCF, 0xF7, 0x9F, 
+0xF2, 0xE4, 0xC8, 0x0C, 0x33, 0x6D, 0x91, 0x86, 0xD8, 0xB2, 0x75, 0x66, 0x54, 0x29, 0x63, 0x9F, 0x16, 
+0xA2, 0xAE, 0xDE, 0xF5, 0xFB, 0xBB, 0x89, 0xA8, 0x18, 0xB8, 0xC2, 0x98, 0x60, 0x46, 0xD5, 0x55, 0x7E, 
+0x71, 0x77, 0x80, 0x35, 0x33, 0x47, 0x81, 0x6B, 0x76, 0xA6, 0x01, 0x66, 0x36, 0xD6, 0x0C, 0xB2, 0xC2, 
+0xF6, 0xC7, 0x03, 0x15, 0xEA, 0xE3, 0xF1, 0x83, 0x0E, 0x83, 0x65, 0xC7, 0x89, 0x74, 0x18, 0x51, 0x69, 
+0x98, 0x16, 0x70, 0xF7, 0x3A, 0x3B, 0x8A, 0xBC, 0xEC, 0x1F, 0x4F, 0x30, 0xF3, 0x67, 0x83, 0x80, 0x52, 
+0xD1, 0x7A, 0x7E, 0x22, 0x64, 0x7A, 0x22, 0xA4, 0x26, 0x5E, 0xD4, 0x45, 0x3F, 0xF7, 0xC1, 0xD0, 0xE9, 
+0xF9, 0xC9, 0xD5, 0x6E, 0x16, 0x22, 0x2F, 0x70, 0xCD, 0x8B, 0x83, 0xCA, 0xA4, 0x1D, 0x78, 0x2C, 0x54, 
+0x30, 0x29, 0x76, 0xF5, 0x6D, 0x78, 0xC7, 0x65, 0xDE, 0x19, 0xA8, 0x8A, 0x98, 0x76, 0x8C, 0x2E, 0x60, 
+0xFA, 0xD8, 0xD9, 0x90, 0x77, 0x79, 0x7A, 0x9A, 0xF1, 0x8E, 0x70, 0x72, 0xAD, 0xEE, 0xB8, 0xAA, 0x4F, 
+0x4A, 0x37, 0x75, 0xEB, 0x0F, 0x2F, 0x86, 0x17, 0x57, 0xFB, 0xF0, 0x1C, 0xEB, 0xE2, 0x11, 0x90, 0xDC, 
+0xFE, 0xFB, 0x93, 0x34, 0x1A, 0x7F, 0x69, 0x16, 0x10, 0xD4, 0xC7, 0xC6, 0xF1, 0xD3, 0x30, 0x23, 0xDB, 
+0x35, 0x33, 0x5B, 0x25, 0x33, 0x5B, 0xFB, 0x6B, 0x66, 0xBB, 0x64, 0x66, 0x7B, 0x7F, 0xCD, 0x3C, 0x2A, 
+0x99, 0x79, 0xF4, 0x48, 0x66, 0x6E, 0xF6, 0xC4, 0x3E, 0xDB, 0xEE, 0xB1, 0x27, 0x4F, 0xEC, 0x8B, 0xAD, 
+0x2B, 0xBB, 0x57, 0xEF, 0x58, 0x34, 0xAB, 0x77, 0xFA, 0x78, 0x2F, 0x33, 0x04, 0x4C, 0x6B, 0x95, 0xCC, 
+0x6C, 0xED, 0xAF, 0x99, 0xED, 0x92, 0x99, 0xED, 0xFD, 0x35, 0xF3, 0xA8, 0x64, 0xE6, 0x0E, 0xD4, 0xBB, 
+0x7C, 0xEB, 0xD3, 0x3E, 0x94, 0xBB, 0xD9, 0x2E, 0xAE, 0xDD, 0xAB, 0x76, 0xFE, 0x64, 0x56, 0xED, 0xF4, 
+0xF1, 0x5E, 0xE6, 0x07, 0x98, 0xD6, 0x2A, 0x99, 0xD9, 0xDA, 0x5F, 0x33, 0xDB, 0x25, 0x33, 0xDB, 0xFB, 
+0x6B, 0xE6, 0x51, 0xC9, 0xCC, 0x1D, 0xA8, 0x76, 0xA7, 0x97, 0xFD, 0x7D, 0xA8, 0x74, 0x7A, 0x33, 0xE3, 
+0xEE, 0x55, 0x39, 0x8F, 0x89, 0x59, 0x99, 0xCB, 0x4F, 0xF6, 0x32, 0x33, 0x94, 0x6D, 0xAD, 0xB2, 0xA1, 
+0xAD, 0x3D, 0x36, 0xB4, 0x5D, 0x36, 0xB4, 0xBD, 0xC7, 0x86, 0x1E, 0x95, 0x0D, 0xDD, 0x81, 0x6A, 0xF7, 
+0xBC, 0x78, 0xF1, 0x03, 0x16, 0x2F, 0x36, 0x7F, 0x07, 0xB0, 0xE4, 0xCB, 0x11, 0xE7, 0x92, 0x24, 0x28, 
+0x92, 0xF6, 0xEB, 0xE6, 0x4F, 0x7D, 0x05, 0x7C, 0xF6, 0x26, 0x60, 0x53, 0x0F, 0x3E, 0x2E, 0x61, 0xA0, 
+0x89, 0x7D, 0x23, 0xEE, 0x5B, 0x5C, 0x89, 0x51, 0xF6, 0xCA, 0xBD, 0x5A, 0xA4, 0xF3, 0x3C, 0xCA, 0x7C, 
+0x5B, 0xF2, 0xF8, 0x2D, 0x6A, 0x35, 0xE3, 0x9B, 0x63, 0xAB, 0xD7, 0x11, 0x00, 0x70, 0xE6, 0x67, 0x9F, 
+0x04, 0xE8, 0x38, 0xF9, 0x09, 0x9A, 0x60, 0x81, 0x3C, 0x22, 0xA8, 0xCF, 0x88, 0x87, 0x30, 0x83, 0x18, 
+0xA7, 0x34, 0x94, 0x68, 0x78, 0x8B, 0x3E, 0x25, 0x21, 0x65, 0xE8, 0x94, 0x02, 0x2A, 0x12, 0x3E, 0x6E, 
+0x74, 0x9C, 0xF8, 0x81, 0xDF, 0xBD, 0xD4, 0x3B, 0x6F, 0xB2, 0x2F, 0x30, 0xA4, 0xD8, 0x27, 0xE5, 0xED, 
+0x38, 0x73, 0xDF, 0x0F, 0x28, 0x37, 0x67, 0x2F, 0xBD, 0x3B, 0x11, 0x75, 0x13, 0x8E, 0xBF, 0xE2, 0x9B, 
+0xC6, 0xD7, 0x6C, 0x17, 0x94, 0xBE, 0xFA, 0x43, 0x58, 0x7B, 0x64, 0xFC, 0x45, 0xED, 0x4F, 0x4D, 0x45, 
+0x55, 0xDE, 0xB5, 0x19, 0x93, 0x9A, 0xE6, 0x5D, 0x5B, 0xE0, 0x5D, 0xCB, 0xBF, 0x7E, 0x50, 0xFC, 0x8C, 
+0x52, 0xA6, 0xF7, 0x21, 0xFB, 0x44, 0xAA, 0x57, 0x2D, 0x7F, 0x53, 0xA9, 0x25, 0xEA, 0x07, 0xE8, 0x7F, 
+0x4B, 0x5E, 0x05, 0xF8, 0xE7, 0x57, 0x6B, 0x0E, 0x8E, 0xA9, 0x33, 0x6E, 0x39, 0x6A, 0x1F, 0x2D, 0x05, 
+0xAA, 0xDA, 0xC1, 0xF1, 0x5C, 0xF7, 0xBB, 0xD5, 0x42, 0xF2, 0xF5, 0xB4, 0xCD, 0xE4, 0x30, 0x22, 0xDD, 
+0x91, 0x5F, 0x55, 0x0A, 0x30, 0x50, 0x5B, 0x0C, 0xEA, 0x59, 0x99, 0x30, 0x49, 0xF0, 0xB8, 0x9B, 0x46, 
+0x00, 0xEA, 0x06, 0xE8, 0x73, 0x16, 0x12, 0x75, 0xF8, 0x8F, 0xDB, 0x0B, 0xAF, 0x5E, 0x53, 0x3B, 0x18, 
+0x6A, 0x07, 0x8D, 0x8C, 0x10, 0x75, 0x75, 0x9D, 0xA9, 0x2A, 0xD3, 0x4D, 0x13, 0x2A, 0x6F, 0xFB, 0x32, 
+0xA9, 0x17, 0xC7, 0x26, 0xD1, 0x74, 0x84, 0xA6, 0xD7, 0x51, 0xB7, 0x8B, 0x7E, 0x35, 0x75, 0x52, 0x3F, 
+0x09, 0x91, 0x69, 0xC2, 0x50, 0xED, 0x53, 0x4C, 0x58, 0xED, 0x78, 0xA9, 0xCB, 0xDD, 0x52, 0x0B, 0x09, 
+0x05, 0x59, 0x62, 0xFF, 0x7A, 0x1D, 0xFB, 0xFF, 0x9C, 0x5D, 0x6D, 0xCF, 0xBD, 0xBD, 0x96, 0xFB, 0xD5, 
+0xBB, 0xED, 0xB9, 0xFF, 0x52, 0x81, 0x7B, 0x7B, 0x7B, 0xF6, 0x6F, 0x2A, 0xB0, 0x77, 0x2A, 0x89, 0x58, 
+0x89, 0x89, 0x80, 0x4F, 0x8A, 0x8D, 0xBA, 0x75, 0x95, 0x87, 0x26, 0x89, 0x63, 0x9C, 0x20, 0x9C, 0x24, 
+0x18, 0x74, 0x42, 0xFF, 0xEC, 0x7F, 0xBA, 0x6C, 0xC4, 0xEA, 0x03, 0x2F, 0xBA, 0xFB, 0xB2, 0xE0, 0xAC, 
+0x67, 0x43, 0xF0, 0x44, 0xD6, 0xA7, 0x62, 0xEA, 0xF8, 0x10, 0x0D, 0x81, 0x75, 0xA1, 0x38, 0x6E, 0xA8, 
+0x57, 0xF4, 0x91, 0x8D, 0x86, 0xFA, 0xE0, 0x6E, 0x25, 0x9F, 0x84, 0x8C, 0x89, 0x12, 0x66, 0xE8, 0xB0, 
+0x32, 0x45, 0xF2, 0xAD, 0xD1, 0x90, 0x25, 0x94, 0xC1, 0xA8, 0x73, 0x3E, 0xF8, 0xF8, 0x01, 0x34, 0xD7, 
+0xFC, 0x42, 0xC2, 0x7C, 0x19, 0x1C, 0x1B, 0x6D, 0xD4, 0xDB, 0x89, 0xBB, 0xF7, 0x30, 0xCE, 0x3D, 0x55, 
+0x33, 0x68, 0x93, 0x11, 0xCF, 0x09, 0xAC, 0x19, 0xA2, 0x02, 0x83, 0x30, 0xAA, 0x2B, 0x59, 0x14, 0x3A, 
+0x34, 0x8F, 0xE1, 0x5F, 0x67, 0x5E, 0x31, 0x44, 0x5F, 0xBD, 0x5A, 0x15, 0x75, 0x45, 0x07, 0x63, 0x64, 
+0x59, 0x43, 0x37, 0x21, 0x58, 0x92, 0x5C, 0xC9, 0x7A, 0x4D, 0x26, 0x26, 0xD5, 0x32, 0xC4, 0xF0, 0xC9, 
+0xBC, 0x72, 0x1D, 0xE9, 0xF5, 0x6A, 0xE8, 0x15, 0x1C, 0xE4, 0xDB, 0x3B, 0x4B, 0xBB, 0x3B, 0x8B, 0xEA, 
+0xF4, 0x67, 0x4D, 0xF5, 0xC8, 0xF4, 0xFB, 0x83, 0xFE, 0xD5, 0x50, 0xA5, 0x47, 0x51, 0xFC, 0x09, 0x42, 
+0x7A, 0xC6, 0x2B, 0xFA, 0xB3, 0x19, 0x8A, 0xF3, 0x2B, 0xA3, 0x16, 0x53, 0xA9, 0x53, 0x4A, 0x57, 0x6F, 
+0x5F, 0xD6, 0xC4, 0x15, 0x08, 0xCB, 0x45, 0x6C, 0x26, 0x3E, 0xDB, 0xC2, 0x7C, 0x50, 0x99, 0xC9, 0x94, 
+0x30, 0x03, 0xDF, 0x94, 0xCA, 0xEC, 0x39, 0x1D, 0x58, 0x1C, 0x43, 0x91, 0xF3, 0x4E, 0x02, 0x1A, 0x7A, 
+0x75, 0xF0, 0xE5, 0xC1, 0xB6, 0x09, 0x57, 0xDE, 0x22, 0x0B, 0x61, 0x5E, 0x06, 0x48, 0xD1, 0x71, 0x42, 
+0x47, 0xB4, 0xEF, 0x62, 0x56, 0x4F, 0x88, 0x58, 0x05, 0x08, 0xC7, 0x41, 0x97, 0x1C, 0x72, 0x4A, 0xA4, 
+0x30, 0x27, 0xB9, 0x25, 0xF2, 0x10, 0x51, 0x89, 0x5C, 0x1E, 0x11, 0x81, 0xD4, 0x17, 0x82, 0x90, 0x0C, 
+0x08, 0x82, 0xFC, 0x61, 0x52, 0x20, 0xC0, 0x9D, 0x3A, 0x63, 0x90, 0xB3, 0xD9, 0x1C, 0x9E, 0x08, 0xD9, 
+0x30, 0xF2, 0x54, 0x35, 0xE8, 0x25, 0xB0, 0x44, 0xDF, 0xBF, 0x23, 0x25, 0xBB, 0x21, 0x71, 0x02, 0x4A, 
+0x43, 0x22, 0x8A, 0x98, 0x33, 0x41, 0x06, 0x8A, 0x03, 0xD4, 0xA6, 0xDA, 0x1F, 0x7F, 0xD5, 0x0E, 0x56, 
+0x29, 0x96, 0x8F, 0x91, 0x03, 0x1A, 0x11, 0x9E, 0x96, 0xEB, 0x80, 0xAA, 0x01, 0x73, 0xBB, 0x84, 0xD1, 
+0xDD, 0x21, 0x7A, 0xDD, 0x6C, 0x36, 0x57, 0xC0, 0x76, 0x56, 0xEC, 0xCC, 0xD7, 0xEF, 0x5E, 0x18, 0x9B, 
+0xE7, 0xCA, 0xDA, 0x0A, 0x23, 0x8C, 0x21, 0x7C, 0x31, 0x2F, 0x38, 0xF3, 0x13, 0x64, 0x0B, 0x23, 0x13, 
+0xF4, 0xFB, 0xC7, 0x0F, 0xE7, 0x52, 0xC6, 0x9F, 0x75, 0xE3, 0x62, 0x41, 0x52, 0x6E, 0xCB, 0xFB, 0x9B, 
+0x9C, 0x52, 0xB8, 0x9C, 0x03, 0x8A, 0xEA, 0xB5, 0xF7, 0x67, 0x83, 0xDA, 0x21, 0x9A, 0x4E, 0x1D, 0x04, 
+0x84, 0x19, 0xCE, 0x65, 0x02, 0x53, 0x81, 0xE3, 0x95, 0xA4, 0x30, 0x67, 0x3D, 0x53, 0xB1, 0xFC, 0x40, 
+0x85, 0x24, 0x90, 0xC8, 0xF5, 0x5A, 0xC8, 0xB1, 0x07, 0x74, 0x05, 0x52, 0xEE, 0xA1, 0x15, 0x80, 0xDD, 
+0xFA, 0xD2, 0xD4, 0xA4, 0x02, 0x56, 0x97, 0x36, 0x79, 0x57, 0x9F, 0x74, 0x65, 0xAF, 0x2D, 0xAD, 0x99, 
+0x0F, 0x4D, 0x28, 0xF3, 0xA0, 0x30, 0x71, 0xA6, 0x4C, 0x01, 0x3F, 0xCF, 0x01, 0xC5, 0x58, 0xA3, 0xD3, 
+0x24, 0x84, 0x7E, 0x56, 0x21, 0x48, 0xA3, 0xDB, 0x32, 0xD7, 0x73, 0xFD, 0x31, 0xB0, 0x7E, 0x36, 0x3D, 
+0xCD, 0x83, 0x78, 0x5A, 0x6A, 0xAA, 0x03, 0x2F, 0xD3, 0xB0, 0x52, 0xEA, 0xD2, 0x50, 0x5F, 0x10, 0xAB, 
+0xAF, 0xEB, 0xB4, 0x1C, 0x99, 0x22, 0x24, 0x10, 0x9D, 0x99, 0x49, 0x64, 0x55, 0xB6, 0x28, 0xEC, 0x90, 
+0x86, 0x87, 0x25, 0xBE, 0x37, 0x9F, 0xCA, 0x98, 0xCE, 0xBB, 0xAF, 0x4A, 0x8A, 0xA5, 0x16, 0x43, 0xCF, 
+0x52, 0x7E, 0xCE, 0x4D, 0xAC, 0xB3, 0x7C, 0x5C, 0xDB, 0x7F, 0x61, 0x8E, 0x7C, 0x88, 0x5A, 0x55, 0xA8, 
+0x16, 0xE0, 0x74, 0x88, 0xDA, 0xCD, 0xEA, 0xB2, 0xA0, 0xF7, 0xB2, 0x8C, 0xBB, 0xD2, 0xFD, 0x52, 0xF9, 
+0xDE, 0xA3, 0xE3, 0xE8, 0x57, 0x3D, 0x3A, 0x8E, 0xFE, 0x7C, 0xDD, 0xFF, 0x01, 0x11, 0x13, 0xC5, 0x0E, 
+0xCF, 0x4E, 0x00, 0x00};#endif // _BZF_NETWORK_H
\ No newline at end of file
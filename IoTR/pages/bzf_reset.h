@@ -1,4 +1,4 @@
-// // bzf_reset.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_RESET_H#define _BZF_RESET_H #define BZF_RESET_MT "text/css"#define BZF_RESET_PATH "/reset.css"#define BZF_RESET_SIZE 488const uint8_t bzf_reset[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0x95, 0x54, 0xDB, 0x6E, 0xDB, 0x30, 0x0C, 
+// // bzf_reset.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_RESET_H#define _BZF_RESET_H #define BZF_RESET_MT "text/css"#define BZF_RESET_PATH "/reset.css"#define BZF_RESET_SIZE 488#define BZF_RESET_HASH 0x9702B5ACULconst uint8_t bzf_reset[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x54, 0xDB, 0x6E, 0xDB, 0x30, 0x0C, 
 0x7D, 0x2F, 0xD0, 0x7F, 0xF0, 0x5B, 0x81, 0x62, 0x41, 0xBB, 0xEB, 0x83, 0xFB, 0x38, 0xF4, 0x07, 0x9A, 
 0xFD, 0x00, 0x65, 0xC9, 0x8E, 0x16, 0x59, 0xB4, 0x75, 0x09, 0x10, 0x0C, 0xFB, 0xF7, 0x49, 0x87, 0x8E, 
 0xEB, 0x04, 0xD8, 0x80, 0x05, 0x08, 0x49, 0x53, 0xBC, 0x9C, 0x43, 0xD1, 0x6E, 0x9E, 0x1E, 0x9B, 0xEF, 
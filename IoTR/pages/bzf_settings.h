@@ -1,121 +1,124 @@
-// // bzf_settings.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_SETTINGS_H#define _BZF_SETTINGS_H #define BZF_SETTINGS_MT "text/html"#define BZF_SETTINGS_PATH "/settings.html"#define BZF_SETTINGS_SIZE 2055const uint8_t bzf_settings[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0xED, 0x5B, 0x51, 0x73, 0xDB, 0x36, 0x12, 
-0x7E, 0xEF, 0xCC, 0xFD, 0x07, 0x84, 0x2F, 0x96, 0x47, 0xA6, 0x28, 0x39, 0x76, 0xE2, 0xD8, 0x94, 0x66, 
-0x52, 0xDB, 0x6D, 0x3D, 0xD3, 0xB3, 0x7D, 0x96, 0x9A, 0xBB, 0x3E, 0x75, 0x20, 0x12, 0x22, 0x91, 0x80, 
-0x04, 0x03, 0x80, 0x92, 0xDD, 0x5E, 0x7E, 0x59, 0x1F, 0xFA, 0x93, 0xEE, 0x2F, 0xDC, 0x02, 0xA4, 0x22, 
-0x4A, 0xA2, 0x24, 0x4A, 0x61, 0x3A, 0xF6, 0xC4, 0x1A, 0x9B, 0x14, 0x41, 0xEC, 0x87, 0xDD, 0xC5, 0xB7, 
-0x0B, 0x80, 0x84, 0xFE, 0xF7, 0xE7, 0x5F, 0xEE, 0x8B, 0x8B, 0x9B, 0xF3, 0xC1, 0xAF, 0xB7, 0x97, 0x28, 
-0x54, 0x11, 0xEB, 0xFD, 0xE3, 0x3B, 0x57, 0x9F, 0x11, 0xC3, 0x71, 0xD0, 0xB5, 0x48, 0x6C, 0x41, 0x09, 
-0x82, 0x8F, 0x1B, 0x12, 0xEC, 0xE7, 0xDF, 0xCD, 0x75, 0x44, 0x14, 0x46, 0x5E, 0x88, 0x85, 0x24, 0xAA, 
-0x6B, 0xA5, 0x6A, 0x64, 0x9F, 0x58, 0x4B, 0xF7, 0x43, 0xA5, 0x12, 0x9B, 0x7C, 0x4C, 0xE9, 0xB8, 0x6B, 
-0xFD, 0xC7, 0xFE, 0xE5, 0xAD, 0x7D, 0xCE, 0xA3, 0x04, 0x2B, 0x3A, 0x64, 0xC4, 0x42, 0x1E, 0x8F, 0x15, 
-0x89, 0x41, 0xF8, 0xEA, 0xB2, 0x4B, 0xFC, 0x80, 0x2C, 0x8B, 0xC7, 0x38, 0x22, 0x5D, 0x6B, 0x4C, 0xC9, 
-0x24, 0xE1, 0x42, 0x15, 0x24, 0x26, 0xD4, 0x57, 0x61, 0xD7, 0x27, 0x63, 0xEA, 0x11, 0xDB, 0x5C, 0x1C, 
-0x20, 0x1A, 0x53, 0x45, 0x31, 0xB3, 0xA5, 0x87, 0x19, 0xE9, 0x76, 0xE6, 0xD0, 0x14, 0x55, 0x8C, 0xF4, 
-0xAE, 0xF8, 0xE0, 0x0E, 0xD9, 0xA8, 0x7F, 0x39, 0x18, 0x5C, 0x5D, 0xFF, 0xD8, 0x77, 0x9D, 0xAC, 0xB8, 
-0x50, 0x8F, 0xD1, 0xF8, 0x03, 0x0A, 0x05, 0x19, 0x75, 0x2D, 0x41, 0xC0, 0xB0, 0x96, 0x27, 0xA5, 0x85, 
-0x04, 0x61, 0x5D, 0x4B, 0xAA, 0x07, 0x46, 0x64, 0x48, 0x08, 0xE8, 0xA1, 0x1E, 0x12, 0xD0, 0x4B, 0x91, 
-0x7B, 0xE5, 0xE8, 0x0A, 0x2B, 0x10, 0x8C, 0xC4, 0x56, 0x08, 0xAE, 0x53, 0xF0, 0xB2, 0x3B, 0xE4, 0xFE, 
-0x03, 0xF2, 0x18, 0x96, 0x52, 0x1B, 0xAC, 0x42, 0x7B, 0x44, 0xEF, 0x89, 0x6F, 0x47, 0x24, 0x4E, 0xE7, 
-0x9A, 0xA4, 0x71, 0x92, 0xAA, 0x1C, 0xD1, 0x0B, 0x89, 0xF7, 0x61, 0xC8, 0xEF, 0xAD, 0xA9, 0x60, 0x48, 
-0x7D, 0x1F, 0x7A, 0x11, 0x51, 0xBF, 0x6B, 0xC5, 0x78, 0x6C, 0x2B, 0x1E, 0x04, 0xDA, 0xF9, 0x38, 0x55, 
-0xDC, 0x83, 0xCE, 0x60, 0x44, 0x81, 0x18, 0x1F, 0x8D, 0xE6, 0x20, 0x7D, 0x3A, 0x9E, 0x02, 0x80, 0x10, 
-0x32, 0x0D, 0xA3, 0x40, 0x50, 0xDF, 0xD6, 0x5D, 0x80, 0x69, 0x4C, 0x44, 0xB1, 0xFE, 0xA2, 0xCC, 0xCA, 
-0x4A, 0x8B, 0x15, 0x05, 0x9F, 0x94, 0x55, 0x59, 0xC6, 0x63, 0xD0, 0xF7, 0xCC, 0x8E, 0x13, 0x74, 0x2F, 
-0xED, 0xCE, 0x21, 0x92, 0x91, 0x7D, 0x82, 0x22, 0xDF, 0x7E, 0xBD, 0x4A, 0x3A, 0x73, 0x4C, 0x14, 0x20, 
-0x29, 0xBC, 0xAE, 0xC5, 0x78, 0xC0, 0x7F, 0x9B, 0x84, 0x54, 0x91, 0x56, 0x12, 0x07, 0x9F, 0x7D, 0xA3, 
-0x8B, 0xC1, 0x13, 0x4C, 0x53, 0x10, 0xA8, 0xB1, 0x16, 0x2B, 0x65, 0x6B, 0xEE, 0xE6, 0x3D, 0xDF, 0x73, 
-0x71, 0xDE, 0xF5, 0x8E, 0x8F, 0x65, 0x38, 0xE4, 0x58, 0xF8, 0xB3, 0xC6, 0x80, 0x18, 0x56, 0xEF, 0x62, 
-0x5A, 0xEE, 0x3A, 0xB8, 0xE7, 0x3A, 0x20, 0xB3, 0x11, 0x75, 0x0A, 0x80, 0x3D, 0x45, 0xC7, 0x10, 0x24, 
-0xB3, 0x46, 0x80, 0xA0, 0x8A, 0xC6, 0x81, 0x5C, 0x68, 0xA3, 0x9F, 0x17, 0x57, 0x6F, 0xA2, 0x80, 0x19, 
-0x13, 0x35, 0xE1, 0xE2, 0xC3, 0x02, 0xE4, 0x75, 0x56, 0xBA, 0x13, 0x62, 0xF4, 0x51, 0xA9, 0x05, 0xB8, 
-0x7F, 0xFE, 0x6B, 0x30, 0xD8, 0x09, 0x2B, 0x24, 0x2C, 0x59, 0xC0, 0xFA, 0x09, 0x8A, 0x76, 0xC2, 0xD2, 
-0xBD, 0x9F, 0x2E, 0x6A, 0xF6, 0xB3, 0x29, 0xAC, 0x80, 0xE7, 0x3A, 0x2B, 0x19, 0xE1, 0x3A, 0x40, 0xDD, 
-0x1D, 0x59, 0x7D, 0xA4, 0x59, 0x7D, 0x8C, 0x74, 0x62, 0xB0, 0x05, 0x0D, 0x42, 0xB5, 0x96, 0x94, 0x05, 
-0x30, 0x9D, 0x38, 0x36, 0x4B, 0x18, 0x29, 0x99, 0xE0, 0xD8, 0xE4, 0x83, 0xD0, 0xF6, 0x18, 0xF7, 0xC0, 
-0xEA, 0x76, 0xBB, 0x65, 0xFE, 0xDA, 0x6D, 0xA7, 0xDD, 0x3E, 0x35, 0x7F, 0xAE, 0xA3, 0xAB, 0x55, 0x81, 
-0xEA, 0xFD, 0xB7, 0x7A, 0xDD, 0xBC, 0x59, 0x29, 0xA9, 0x0F, 0x3C, 0xED, 0x5F, 0x5D, 0x7C, 0xD5, 0x66, 
-0x04, 0xB4, 0x63, 0xF5, 0xEE, 0xA0, 0x9D, 0xAF, 0xDA, 0xCC, 0x98, 0x33, 0x85, 0xF5, 0xF0, 0x05, 0x2E, 
-0x7C, 0xF7, 0x55, 0x5B, 0x32, 0xA1, 0xD4, 0xBB, 0xBE, 0xD9, 0x28, 0xB8, 0x96, 0x82, 0x2B, 0xEE, 0x95, 
-0x95, 0x2F, 0x96, 0x2D, 0x5D, 0x33, 0x3C, 0x24, 0x0C, 0x8D, 0xB8, 0x98, 0x1B, 0x5D, 0x74, 0xF0, 0xE8, 
-0x1B, 0x2B, 0x86, 0x94, 0x4A, 0x63, 0xC8, 0x8A, 0xA1, 0x61, 0x31, 0x80, 0xB2, 0xC8, 0x81, 0xA0, 0xE9, 
-0x1C, 0xAE, 0x1C, 0x49, 0x5E, 0xD8, 0x30, 0xE8, 0x3F, 0x48, 0x45, 0x22, 0x64, 0xDB, 0xAB, 0x2A, 0x81, 
-0x0D, 0x11, 0xD2, 0x39, 0x96, 0xC7, 0x5D, 0xCB, 0x42, 0x30, 0xFF, 0x08, 0x39, 0x38, 0x3D, 0xE1, 0x72, 
-0x96, 0x23, 0x24, 0x31, 0xF7, 0xD7, 0xC6, 0xE4, 0x88, 0x12, 0xE6, 0x43, 0x66, 0xDE, 0x98, 0x8B, 0x48, 
-0x40, 0x62, 0xBF, 0x97, 0xE9, 0x05, 0xFE, 0xCA, 0x2E, 0x37, 0x08, 0x15, 0x8C, 0x5F, 0x3F, 0x1A, 0x6F, 
-0x92, 0x5E, 0x33, 0xF0, 0x56, 0xF6, 0xF8, 0xCB, 0x8A, 0x69, 0xAA, 0x9C, 0xD1, 0x39, 0xA2, 0x76, 0xBB, 
-0x6D, 0xC8, 0x62, 0xF5, 0x7E, 0xF8, 0x37, 0x7A, 0x47, 0x84, 0x04, 0x0F, 0x9F, 0x56, 0x0A, 0x8D, 0x2A, 
-0x6C, 0xAF, 0x6C, 0xCD, 0xC9, 0x56, 0x26, 0x68, 0x14, 0x1D, 0x93, 0xA9, 0x24, 0x62, 0x9C, 0xE9, 0x6C, 
-0xE5, 0xD3, 0xD5, 0xB9, 0xA2, 0x12, 0x2B, 0xB7, 0xD2, 0xB6, 0x62, 0xDD, 0xCA, 0xF5, 0x1E, 0x0B, 0x05, 
-0x0A, 0x79, 0x63, 0x88, 0x53, 0x5F, 0x60, 0x45, 0x4A, 0x9D, 0xF5, 0x7D, 0x7E, 0xF3, 0x74, 0x39, 0xA3, 
-0x3C, 0x32, 0x46, 0x48, 0xC2, 0x20, 0x3B, 0x18, 0x52, 0xCC, 0x2C, 0xCA, 0x18, 0x51, 0x6E, 0xA1, 0x8E, 
-0x5D, 0xC1, 0x99, 0x85, 0x12, 0x86, 0x3D, 0x12, 0x72, 0xE6, 0x13, 0xF0, 0xC6, 0x9B, 0x57, 0xED, 0xF6, 
-0x36, 0xED, 0x9A, 0xB6, 0x79, 0xA2, 0xD3, 0x12, 0x1A, 0x63, 0x96, 0x42, 0x73, 0x87, 0x47, 0x1A, 0x42, 
-0x1F, 0x5D, 0x27, 0xBB, 0xF3, 0x65, 0x78, 0x47, 0x27, 0x1A, 0x4F, 0x1F, 0xEB, 0xC1, 0xCB, 0x4C, 0xD4, 
-0xC7, 0x7A, 0xF0, 0x3A, 0x6F, 0x0E, 0x35, 0xA0, 0x39, 0xD5, 0x83, 0xF8, 0xF2, 0xC4, 0xB8, 0xD0, 0x9C, 
-0xEA, 0x41, 0x3C, 0x7E, 0x6D, 0x8C, 0x36, 0xA7, 0x9A, 0xAC, 0xEE, 0x1C, 0x67, 0x66, 0x9B, 0xF3, 0x4E, 
-0x98, 0x90, 0x64, 0x0D, 0x69, 0x9F, 0x93, 0x91, 0x4E, 0x46, 0x25, 0xD9, 0xE7, 0xAD, 0x5E, 0x72, 0x61, 
-0xE3, 0x75, 0x8F, 0xFB, 0x4F, 0x20, 0x09, 0x15, 0x1F, 0x05, 0x68, 0x67, 0x64, 0xEB, 0x7E, 0xEC, 0xE1, 
-0xA9, 0x1D, 0xB6, 0xB6, 0x63, 0x9A, 0x97, 0x96, 0xCB, 0x73, 0x6E, 0x55, 0x49, 0x54, 0x05, 0xDF, 0x9C, 
-0x1B, 0x59, 0xA1, 0x9F, 0xF3, 0x08, 0xE2, 0xEB, 0x47, 0x27, 0xD9, 0x37, 0xCB, 0x79, 0x66, 0xD6, 0x0A, 
-0x66, 0xDD, 0x91, 0x21, 0xE7, 0x0A, 0x65, 0x4F, 0xB0, 0x1E, 0x3F, 0xAF, 0xA6, 0x8B, 0xE6, 0xF7, 0x78, 
-0x8C, 0xA5, 0x27, 0x68, 0xA2, 0x4E, 0x85, 0xB1, 0xE0, 0xC2, 0x18, 0xD0, 0xD8, 0x3F, 0xFB, 0x4C, 0x99, 
-0xA1, 0x8A, 0x11, 0xFC, 0xDB, 0xBA, 0xFF, 0x73, 0x33, 0xF5, 0x72, 0xFA, 0x69, 0x11, 0xA1, 0x18, 0x47, 
-0x32, 0x1D, 0x46, 0x54, 0x2D, 0xD9, 0x37, 0xD4, 0x4B, 0x67, 0xF3, 0x2D, 0xF2, 0xCD, 0x89, 0x0B, 0x1C, 
-0x07, 0xB3, 0x18, 0xEA, 0xE3, 0x31, 0xB1, 0x6A, 0x32, 0x65, 0x53, 0x1D, 0xD7, 0xD9, 0xB0, 0xEA, 0x80, 
-0x0A, 0x40, 0xBE, 0x75, 0xEB, 0xA3, 0xEB, 0xC1, 0xED, 0xE3, 0x5B, 0x1C, 0x69, 0xA5, 0xFA, 0x66, 0x36, 
-0xFD, 0x6D, 0x2D, 0x90, 0x8A, 0xAB, 0x6A, 0x95, 0xD8, 0x3E, 0x8F, 0xC0, 0x86, 0xD2, 0xF9, 0xF1, 0xCC, 
-0x43, 0x4F, 0x75, 0x70, 0x2A, 0x1A, 0x98, 0x0D, 0x4B, 0xC5, 0x92, 0x2D, 0x06, 0x24, 0xED, 0x8A, 0x8B, 
-0x4C, 0xEC, 0x79, 0xDC, 0x99, 0x27, 0x90, 0xFA, 0xBD, 0x94, 0x3C, 0x03, 0x1A, 0x91, 0xDF, 0x79, 0xFC, 
-0xB4, 0x16, 0x57, 0x53, 0x7B, 0x66, 0x5C, 0x59, 0xB4, 0xAE, 0x9C, 0x1E, 0xCD, 0xC3, 0xD2, 0x29, 0xCA, 
-0x97, 0x4D, 0xC2, 0xED, 0x4E, 0xC7, 0xEA, 0xC1, 0xA1, 0x9E, 0x29, 0xBD, 0xDD, 0x69, 0x6B, 0xB4, 0x9A, 
-0x16, 0x08, 0xF6, 0x1B, 0x00, 0x7B, 0x53, 0x13, 0x16, 0x74, 0x97, 0x7D, 0x52, 0x13, 0xD6, 0x6B, 0xC0, 
-0x7A, 0x5D, 0x13, 0xD6, 0x2B, 0xC0, 0x7A, 0x55, 0x13, 0xD6, 0x31, 0x60, 0x1D, 0xD7, 0x84, 0x75, 0x04, 
-0x58, 0x47, 0x35, 0x61, 0xBD, 0x04, 0xAC, 0x97, 0x35, 0x61, 0x1D, 0x02, 0xD6, 0x61, 0x5D, 0x6C, 0xD5, 
-0x64, 0xAD, 0x07, 0x0B, 0x78, 0xDF, 0xAC, 0x6B, 0x5D, 0x0C, 0x50, 0x35, 0x69, 0x05, 0xCE, 0x6A, 0xD6, 
-0xE4, 0x2C, 0xE8, 0xC3, 0x66, 0x4D, 0x7D, 0x08, 0xD4, 0x6A, 0xD6, 0x44, 0x2D, 0x60, 0x7C, 0xB3, 0x26, 
-0xC6, 0x43, 0x20, 0x36, 0x6B, 0x0A, 0x44, 0xC8, 0x0F, 0xCD, 0x9A, 0xF2, 0x03, 0xA4, 0xAD, 0x66, 0x4D, 
-0x69, 0x0B, 0xB2, 0x69, 0xB3, 0xA6, 0x6C, 0xAA, 0xD3, 0x7C, 0xB3, 0x53, 0xDB, 0x73, 0x20, 0x0D, 0x56, 
-0x13, 0xE3, 0xF5, 0x4B, 0x94, 0x66, 0x67, 0x17, 0xCE, 0x3F, 0xD1, 0x67, 0x49, 0xDF, 0xDE, 0x42, 0xEF, 
-0x1C, 0x66, 0x3D, 0x24, 0x56, 0x94, 0xC9, 0xC7, 0xB7, 0xDE, 0x9B, 0xEA, 0x86, 0x99, 0xFC, 0x66, 0x17, 
-0x7C, 0xFA, 0xF5, 0x51, 0xE9, 0x6C, 0xFD, 0x17, 0xF9, 0x74, 0x17, 0x79, 0x99, 0x51, 0xB3, 0xF7, 0x63, 
-0x5B, 0x2D, 0xEC, 0xB4, 0xE1, 0x5A, 0xF4, 0xF9, 0x11, 0xE3, 0x06, 0xEA, 0x24, 0x00, 0x3B, 0xE1, 0x85, 
-0x3D, 0x47, 0x45, 0xFA, 0xDC, 0xE6, 0x37, 0x9F, 0x16, 0x85, 0x66, 0x26, 0x69, 0x1A, 0xCD, 0xAE, 0x32, 
-0x2A, 0xCD, 0xAE, 0xB7, 0xA0, 0xD3, 0xED, 0x67, 0x21, 0xE7, 0x79, 0xB0, 0x7A, 0x9C, 0x83, 0xD5, 0x4E, 
-0x5B, 0x51, 0x0A, 0x4E, 0x1D, 0x71, 0xAE, 0x88, 0x40, 0x91, 0xB2, 0x8F, 0xDB, 0x7F, 0xF7, 0x3E, 0xC5, 
-0xD9, 0x86, 0x94, 0x76, 0x16, 0xD2, 0x1E, 0x8C, 0x68, 0x44, 0xD8, 0xF7, 0x72, 0xED, 0x48, 0x99, 0x20, 
-0xB3, 0x3D, 0x54, 0x73, 0xDA, 0xF7, 0x69, 0x1C, 0xD8, 0x8A, 0x27, 0xA7, 0xA8, 0xD3, 0x4E, 0xEE, 0xCF, 
-0xAC, 0x9E, 0x2B, 0x81, 0xC7, 0x71, 0x60, 0x36, 0xB0, 0xC2, 0x44, 0x2B, 0xBB, 0x40, 0x13, 0x2C, 0x91, 
-0x4F, 0x24, 0x0D, 0x62, 0xE2, 0x23, 0x1C, 0x43, 0x7F, 0xA7, 0x94, 0x29, 0x34, 0x7C, 0x40, 0x37, 0x82, 
-0xD1, 0x18, 0x5D, 0x50, 0x60, 0x88, 0xE0, 0xE3, 0x96, 0xEB, 0x24, 0x7F, 0xC7, 0x5E, 0xA0, 0xEC, 0xC5, 
-0x80, 0xD9, 0x39, 0x9C, 0xE2, 0x80, 0x14, 0xDF, 0x16, 0xCC, 0x6D, 0x78, 0x2D, 0x16, 0x9B, 0xED, 0x99, 
-0x4E, 0x44, 0x3D, 0xC1, 0xF1, 0x7B, 0x7C, 0xDF, 0x7A, 0x2F, 0xF5, 0x06, 0x89, 0xEC, 0x6E, 0x3D, 0xD8, 
-0x3E, 0x19, 0xFF, 0x26, 0x15, 0x56, 0xA9, 0xAC, 0x0C, 0xBE, 0x37, 0x43, 0xD9, 0xCB, 0xC0, 0xF7, 0x16, 
-0xC0, 0xF7, 0x40, 0x7C, 0xDE, 0x3B, 0xA3, 0x34, 0x36, 0xD3, 0x21, 0x34, 0xFF, 0x5E, 0x04, 0xFD, 0xB1, 
-0xEC, 0x5C, 0xC7, 0x41, 0x3F, 0x0D, 0x06, 0xB7, 0xE8, 0x6D, 0xAA, 0x42, 0x3D, 0xDB, 0xF1, 0xCC, 0x5B, 
-0xB4, 0xD6, 0x72, 0x45, 0x88, 0x9C, 0x77, 0x3A, 0x6C, 0x65, 0x63, 0xCF, 0xC1, 0x09, 0x75, 0xC6, 0x1D, 
-0x27, 0x43, 0xDF, 0xDB, 0x3F, 0x9B, 0xAF, 0xFD, 0x69, 0xA5, 0x3A, 0x01, 0x51, 0x3F, 0x12, 0x60, 0x38, 
-0x66, 0x39, 0xD4, 0x2A, 0x95, 0x32, 0x8D, 0x4D, 0x62, 0x35, 0x64, 0xCA, 0xB7, 0xB0, 0x54, 0x53, 0x2B, 
-0xC8, 0x9A, 0xF0, 0x46, 0xC1, 0x76, 0xAA, 0x69, 0x3F, 0x68, 0x37, 0xD4, 0xEF, 0x28, 0x0C, 0x32, 0x5B, 
-0xE8, 0x72, 0x75, 0x77, 0xCE, 0xA3, 0x08, 0xEC, 0x96, 0x8D, 0x54, 0xB0, 0x03, 0x04, 0xD1, 0x47, 0xBD, 
-0x52, 0xA5, 0xC6, 0x58, 0x64, 0x77, 0x51, 0x37, 0x3B, 0x9F, 0x95, 0xD7, 0x21, 0x63, 0x50, 0xB9, 0xCF, 
-0x53, 0x01, 0x4E, 0xED, 0xA2, 0x98, 0x4C, 0xD0, 0xE5, 0xAC, 0x44, 0x37, 0xA2, 0x95, 0x5B, 0x16, 0x55, 
-0x21, 0x95, 0x2D, 0xBD, 0x95, 0x1D, 0x84, 0xA6, 0xDA, 0x35, 0xF6, 0x97, 0xEB, 0xFD, 0x51, 0x1E, 0xD0, 
-0x85, 0x56, 0x5B, 0x3C, 0xE6, 0x09, 0x89, 0x8B, 0x38, 0x64, 0x7F, 0x95, 0x9C, 0xFE, 0x40, 0x36, 0x94, 
-0x9C, 0x91, 0x16, 0xE3, 0x41, 0xC3, 0xBA, 0xBA, 0x43, 0x37, 0x20, 0x0D, 0x33, 0xAC, 0xFD, 0xB3, 0x72, 
-0x91, 0x4F, 0x67, 0x55, 0x54, 0x20, 0x42, 0x70, 0x51, 0x5D, 0x07, 0x3A, 0x42, 0x0D, 0xD2, 0x52, 0x58, 
-0x00, 0x39, 0x5A, 0x82, 0x60, 0xFF, 0xA1, 0x0F, 0xB1, 0x4B, 0xD0, 0x8B, 0x6E, 0xD1, 0x7D, 0xAD, 0x9B, 
-0xDB, 0xCB, 0xEB, 0xB5, 0x38, 0x65, 0xF6, 0x9C, 0x33, 0x2E, 0xD7, 0xD8, 0x93, 0x13, 0x64, 0x77, 0x53, 
-0x23, 0x22, 0x25, 0xA4, 0x8F, 0x1D, 0x1D, 0x6E, 0xCC, 0x3B, 0x45, 0x16, 0x6A, 0x22, 0xD2, 0xF2, 0xB1, 
-0xC2, 0x5F, 0xE2, 0x77, 0x18, 0x43, 0x0C, 0xDE, 0xCF, 0x54, 0x2A, 0x1D, 0x9A, 0x0D, 0xC3, 0xD4, 0x83, 
-0x6D, 0x7A, 0xE1, 0x45, 0xAE, 0xC5, 0xEA, 0x5A, 0x1B, 0xDC, 0x2F, 0x88, 0x4A, 0x45, 0xBC, 0xBD, 0xB3, 
-0xF5, 0xA7, 0x9A, 0xCF, 0xD6, 0xFB, 0x69, 0x1A, 0x88, 0x66, 0x12, 0x02, 0x9D, 0xE2, 0x73, 0x2F, 0x8D, 
-0xC0, 0x27, 0x2D, 0xA0, 0xD6, 0x25, 0x23, 0xFA, 0xEB, 0xF7, 0x0F, 0x57, 0x7E, 0x63, 0x79, 0x1B, 0xC4, 
-0x3A, 0x44, 0x83, 0xD6, 0x32, 0xB3, 0x29, 0xC0, 0xCC, 0x34, 0x58, 0xD5, 0x51, 0xE0, 0x6F, 0x58, 0xC9, 
-0x92, 0x32, 0xB8, 0x4F, 0x1B, 0x12, 0xD3, 0x84, 0xC6, 0x3E, 0x9F, 0x00, 0xA9, 0x18, 0xC7, 0x7E, 0x81, 
-0x51, 0xA8, 0x3C, 0x53, 0x42, 0x02, 0xD4, 0x2F, 0x73, 0x78, 0xAA, 0x1A, 0x8B, 0x09, 0xFF, 0x00, 0x1D, 
-0xB7, 0xDB, 0x65, 0x2A, 0xCC, 0xCB, 0x4C, 0x33, 0xF1, 0x01, 0xCC, 0x39, 0xCA, 0xEB, 0x6B, 0x5F, 0x42, 
-0xDA, 0x02, 0x65, 0xAC, 0x69, 0x92, 0x35, 0x94, 0x93, 0x56, 0x69, 0x22, 0xD3, 0xD5, 0xA9, 0x98, 0x66, 
-0xD5, 0x3C, 0x05, 0x2E, 0xA6, 0x59, 0xEB, 0x73, 0x8D, 0x52, 0xA7, 0xCF, 0xE4, 0x4D, 0x4A, 0x6C, 0xEC, 
-0xAF, 0x6C, 0x29, 0xDB, 0x48, 0xD1, 0x37, 0xE3, 0x7C, 0xDE, 0xD6, 0x45, 0xA1, 0x68, 0x9A, 0x6F, 0x17, 
-0x45, 0x8B, 0x62, 0xB3, 0x26, 0x56, 0xF6, 0xCC, 0xC2, 0xE4, 0xC1, 0x75, 0xF4, 0x4F, 0x74, 0xF4, 0x4F, 
-0xA6, 0x9C, 0xFC, 0xB7, 0x53, 0xFF, 0x07, 0xC1, 0xD6, 0x32, 0x48, 0x50, 0x35, 0x00, 0x00};#endif // _BZF_SETTINGS_H
\ No newline at end of file
+// // bzf_settings.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_SETTINGS_H#define _BZF_SETTINGS_H #define BZF_SETTINGS_MT "text/html"#define BZF_SETTINGS_PATH "/settings.html"#define BZF_SETTINGS_SIZE 2106#define BZF_SETTINGS_HASH 0x55E2B862ULconst uint8_t bzf_settings[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0x5B, 0x51, 0x53, 0xE3, 0x38, 0x12, 
+0x7E, 0x9F, 0x5F, 0xA1, 0xF1, 0x0B, 0xA1, 0x82, 0xE3, 0x84, 0x81, 0x19, 0x06, 0x9C, 0x54, 0xCD, 0x02, 
+0xBB, 0x4B, 0xD5, 0x1E, 0x70, 0x24, 0x33, 0x7B, 0xF7, 0xB4, 0xA5, 0x58, 0x8A, 0xAD, 0x19, 0xD9, 0xF2, 
+0x4A, 0x72, 0x02, 0xBB, 0x37, 0xBF, 0xEC, 0x1E, 0xEE, 0x27, 0xDD, 0x5F, 0xB8, 0x96, 0x9C, 0x10, 0x93, 
+0x38, 0xC1, 0xC9, 0x7A, 0xAE, 0xA0, 0x06, 0x0A, 0xE2, 0x58, 0x52, 0x7F, 0xEA, 0x6E, 0x7D, 0x6A, 0xB5, 
+0x65, 0xF1, 0xDF, 0x7F, 0xFF, 0xC7, 0x7F, 0x7D, 0x76, 0x75, 0x3A, 0xF8, 0xE7, 0xF5, 0x39, 0x8A, 0x74, 
+0xCC, 0x7B, 0xAF, 0x7C, 0x73, 0x41, 0x1C, 0x27, 0x61, 0xD7, 0xA1, 0x89, 0xD3, 0x7B, 0x85, 0xE0, 0xC7, 
+0x8F, 0x28, 0x26, 0xF9, 0x57, 0x7B, 0x1B, 0x53, 0x8D, 0x51, 0x10, 0x61, 0xA9, 0xA8, 0xEE, 0x3A, 0x99, 
+0x1E, 0xB9, 0x47, 0xCE, 0x62, 0x75, 0xA4, 0x75, 0xEA, 0xD2, 0xDF, 0x33, 0x36, 0xEE, 0x3A, 0xFF, 0x70, 
+0x3F, 0x7E, 0x70, 0x4F, 0x45, 0x9C, 0x62, 0xCD, 0x86, 0x9C, 0x3A, 0x28, 0x10, 0x89, 0xA6, 0x09, 0xC8, 
+0x5E, 0x9C, 0x77, 0x29, 0x09, 0xE9, 0x92, 0x74, 0x82, 0x63, 0xDA, 0x75, 0xC6, 0x8C, 0x4E, 0x52, 0x21, 
+0x75, 0x41, 0x60, 0xC2, 0x88, 0x8E, 0xBA, 0x84, 0x8E, 0x59, 0x40, 0x5D, 0x7B, 0xB3, 0x87, 0x58, 0xC2, 
+0x34, 0xC3, 0xDC, 0x55, 0x01, 0xE6, 0xB4, 0xDB, 0x29, 0x82, 0x69, 0xA6, 0x39, 0xED, 0x5D, 0x88, 0xC1, 
+0x0D, 0x72, 0x51, 0xFF, 0x7C, 0x30, 0xB8, 0xB8, 0xFC, 0xA9, 0xEF, 0x7B, 0x79, 0xF1, 0xBC, 0x19, 0x67, 
+0xC9, 0x17, 0x14, 0x49, 0x3A, 0xEA, 0x3A, 0x92, 0x82, 0x51, 0xAD, 0x40, 0x29, 0x07, 0x49, 0xCA, 0xBB, 
+0x8E, 0xD2, 0x77, 0x9C, 0xAA, 0x88, 0x52, 0xD0, 0x42, 0xDF, 0xA5, 0xA0, 0x95, 0xA6, 0xB7, 0xDA, 0x33, 
+0x0D, 0xCA, 0x01, 0xAC, 0xC0, 0x26, 0x00, 0xBE, 0x37, 0x77, 0xAF, 0x3F, 0x14, 0xE4, 0x0E, 0x05, 0x1C, 
+0x2B, 0x65, 0x6C, 0xD5, 0x91, 0x3B, 0x62, 0xB7, 0x94, 0xB8, 0x31, 0x4D, 0xB2, 0x62, 0x7F, 0x2C, 0x49, 
+0x33, 0x3D, 0x85, 0x0B, 0x22, 0x1A, 0x7C, 0x19, 0x8A, 0x5B, 0x67, 0x26, 0x17, 0x31, 0x42, 0x60, 0xEC, 
+0x10, 0x23, 0x5D, 0x27, 0xC1, 0x63, 0x57, 0x8B, 0x30, 0x34, 0x5E, 0xC7, 0x99, 0x16, 0x01, 0x8C, 0x02, 
+0xA7, 0x1A, 0xC4, 0xC4, 0x68, 0x54, 0x44, 0x24, 0x6C, 0x3C, 0x93, 0x07, 0x19, 0x64, 0xBB, 0x45, 0xA1, 
+0x64, 0xC4, 0x35, 0xBE, 0xC7, 0x2C, 0xA1, 0xB2, 0xD0, 0x7C, 0x51, 0x64, 0x55, 0x9B, 0xC5, 0x76, 0x52, 
+0x4C, 0x4A, 0x5A, 0x2C, 0xA3, 0x71, 0x18, 0x71, 0xEE, 0x26, 0x29, 0xBA, 0x55, 0x6E, 0x67, 0x1F, 0xA9, 
+0xD8, 0x3D, 0x42, 0x31, 0x71, 0xDF, 0xAD, 0x10, 0xCE, 0x7D, 0x12, 0x87, 0x48, 0xC9, 0xA0, 0xEB, 0x70, 
+0x11, 0x8A, 0xDF, 0x26, 0x11, 0xD3, 0xB4, 0x95, 0x26, 0xE1, 0xBD, 0x5B, 0x4C, 0x31, 0x38, 0x81, 0x1B, 
+0xDA, 0x01, 0x21, 0xD6, 0x41, 0x65, 0x7C, 0x75, 0xE5, 0x74, 0xBC, 0x7B, 0x3E, 0x9E, 0x0E, 0xB8, 0x47, 
+0xB0, 0x8A, 0x86, 0x02, 0x4B, 0x32, 0xEF, 0x0A, 0xE8, 0xE0, 0xF4, 0xCE, 0x66, 0xE5, 0xBE, 0x87, 0x7B, 
+0xBE, 0x07, 0x32, 0x8F, 0x81, 0xCE, 0xE4, 0x71, 0xA0, 0xD9, 0x18, 0x66, 0xC5, 0xBC, 0x0F, 0x20, 0xA5, 
+0x66, 0x49, 0xA8, 0x16, 0xBA, 0xE8, 0x4F, 0x8B, 0x2B, 0xF7, 0x50, 0x80, 0x4C, 0xA8, 0x9E, 0x08, 0xF9, 
+0x65, 0x01, 0xF1, 0x32, 0x2F, 0xDD, 0x06, 0x30, 0xFE, 0x5D, 0xEB, 0x05, 0xB4, 0xBF, 0xFD, 0x7D, 0x30, 
+0xD8, 0x06, 0x2A, 0xA2, 0x3C, 0x5D, 0x80, 0xFA, 0x19, 0x8A, 0xB6, 0x81, 0x32, 0xC3, 0x9E, 0x2D, 0xEA, 
+0xF5, 0x8B, 0x2D, 0x7C, 0x1C, 0xCE, 0xF7, 0x56, 0x51, 0xC1, 0xF7, 0x80, 0xB0, 0xDB, 0x51, 0xF9, 0xC0, 
+0x50, 0xF9, 0x10, 0x99, 0x30, 0xE0, 0x4A, 0x16, 0x46, 0x7A, 0x1D, 0x15, 0x0B, 0x58, 0x26, 0x4C, 0x3C, 
+0x2A, 0x60, 0x85, 0x54, 0x8A, 0x13, 0x3B, 0xFD, 0x23, 0x37, 0xE0, 0x22, 0x00, 0x83, 0xDB, 0xED, 0x96, 
+0xFD, 0x6D, 0xB7, 0xBD, 0x76, 0xFB, 0xD8, 0xFE, 0xFA, 0x9E, 0x69, 0x56, 0x01, 0xA9, 0xF7, 0xAF, 0xCA, 
+0x4D, 0xA7, 0x9D, 0x2A, 0xC5, 0x08, 0x90, 0xB3, 0x7F, 0x71, 0xF6, 0x0D, 0x3B, 0x91, 0xD0, 0x8B, 0xD3, 
+0xBB, 0x81, 0x5E, 0xBE, 0x61, 0x27, 0x63, 0xC1, 0x35, 0x36, 0x0B, 0x14, 0x38, 0xEF, 0xD3, 0x37, 0xEC, 
+0xC7, 0xCE, 0x9D, 0xDE, 0xE5, 0xD5, 0x63, 0x72, 0xEB, 0x68, 0x57, 0x5E, 0x55, 0x52, 0xBC, 0x50, 0xB4, 
+0x78, 0xCB, 0xF1, 0x90, 0x72, 0x34, 0x12, 0xF2, 0xC1, 0xF2, 0x61, 0x66, 0x8A, 0xA9, 0x28, 0x5F, 0x33, 
+0xAA, 0x2C, 0x12, 0xE5, 0xC1, 0x7F, 0x71, 0xB6, 0xE4, 0xD3, 0x04, 0x66, 0x48, 0x67, 0x7F, 0xD5, 0x52, 
+0xF1, 0xDA, 0x85, 0xC5, 0xFC, 0x4E, 0x69, 0x1A, 0x23, 0xD7, 0x5D, 0xD1, 0x06, 0xD4, 0x8F, 0x91, 0x89, 
+0xA3, 0x22, 0xE9, 0x3A, 0x0E, 0x82, 0xAC, 0x22, 0x12, 0xE0, 0xE9, 0x54, 0xA8, 0x79, 0x2C, 0x50, 0xD4, 
+0xD6, 0xAF, 0x9B, 0x7E, 0x23, 0x46, 0x39, 0x81, 0xE0, 0xFB, 0x58, 0xC4, 0xA1, 0x21, 0x4D, 0x48, 0x2F, 
+0x57, 0x0A, 0x1C, 0x95, 0xDF, 0xAE, 0x97, 0x29, 0xD8, 0xBD, 0x76, 0x9D, 0x7D, 0x4C, 0x78, 0xF5, 0x9A, 
+0x5A, 0xD9, 0xD5, 0x6F, 0xAA, 0x05, 0xA3, 0x72, 0x02, 0x4F, 0x01, 0x8D, 0xC3, 0x5D, 0xCB, 0x10, 0xA7, 
+0xF7, 0xE3, 0xAF, 0xE8, 0x13, 0x95, 0x0A, 0x7C, 0x7B, 0x5C, 0x65, 0x22, 0x54, 0x20, 0x77, 0x65, 0x53, 
+0x8E, 0x36, 0xD1, 0xDF, 0x80, 0x98, 0xF9, 0x97, 0x29, 0x2A, 0xC7, 0xB9, 0xC2, 0xCE, 0x34, 0xF7, 0x7C, 
+0x50, 0x54, 0x62, 0xE2, 0x26, 0xBA, 0x56, 0x6B, 0x5A, 0xB5, 0xD9, 0xD3, 0x1E, 0xFA, 0x53, 0x91, 0x8C, 
+0x58, 0x88, 0x7E, 0x95, 0x90, 0x7E, 0xA9, 0xE7, 0x31, 0xFA, 0xC1, 0x28, 0x9C, 0x58, 0x75, 0x67, 0x63, 
+0x5F, 0x28, 0x78, 0x19, 0xF9, 0xCA, 0x23, 0xFF, 0x31, 0x81, 0x47, 0xC2, 0x24, 0x84, 0xC7, 0x86, 0x3E, 
+0x1E, 0x3F, 0xA3, 0xB1, 0x57, 0x5F, 0x58, 0x9A, 0x52, 0x52, 0x18, 0xFC, 0xFB, 0x92, 0x97, 0xD1, 0x5F, 
+0x5E, 0xE9, 0xE6, 0xC9, 0xC1, 0x10, 0x67, 0x44, 0x62, 0x4D, 0x4B, 0xFD, 0xF4, 0xC3, 0xB4, 0xF2, 0x78, 
+0x29, 0x6D, 0x78, 0x52, 0x3C, 0x50, 0x94, 0x43, 0x12, 0x60, 0xA9, 0x30, 0x37, 0x27, 0x27, 0x42, 0xB9, 
+0x79, 0x66, 0x95, 0x96, 0x82, 0x3B, 0x28, 0xE5, 0x38, 0xA0, 0x91, 0xE0, 0x84, 0x82, 0x2B, 0xDE, 0xBF, 
+0x6D, 0xB7, 0x37, 0xE8, 0xD6, 0x76, 0x2D, 0x52, 0x93, 0x7C, 0xA0, 0x31, 0xE6, 0x19, 0xF4, 0xB6, 0x7F, 
+0x60, 0x10, 0xCC, 0xA7, 0xEF, 0xE5, 0x35, 0x7F, 0x09, 0xEE, 0xE0, 0xC8, 0xC0, 0x99, 0xCF, 0x5A, 0xE0, 
+0x72, 0xFB, 0xCC, 0x67, 0x2D, 0x70, 0x9D, 0xF7, 0xFB, 0x06, 0xCF, 0x5E, 0x6A, 0x01, 0x7C, 0x73, 0x64, 
+0xDD, 0x67, 0x2F, 0xB5, 0x00, 0x1E, 0xBE, 0xB3, 0x16, 0xDB, 0x4B, 0x3D, 0x26, 0x77, 0x0E, 0x73, 0x9B, 
+0xED, 0x75, 0x1B, 0x48, 0x88, 0xA7, 0x96, 0xAC, 0xDF, 0x7D, 0xF0, 0x29, 0x89, 0x36, 0x1F, 0xCC, 0x86, 
+0x09, 0xB6, 0xFE, 0x0E, 0x04, 0x79, 0xEA, 0x41, 0xA7, 0xB8, 0x7B, 0x67, 0x1C, 0x91, 0x6F, 0xD5, 0xE1, 
+0x00, 0xCF, 0x8C, 0x70, 0x8D, 0x11, 0xB3, 0x38, 0xB4, 0x5C, 0x3E, 0xA5, 0x54, 0x95, 0xC0, 0x54, 0x70, 
+0xCC, 0xA9, 0x95, 0x95, 0x66, 0x4F, 0x56, 0x52, 0x62, 0x76, 0x3A, 0xF3, 0x6F, 0x8E, 0xF7, 0xC2, 0xA8, 
+0x65, 0x46, 0xDD, 0xD0, 0xA1, 0x10, 0x1A, 0xE5, 0x3B, 0xCD, 0x4F, 0x9C, 0x4F, 0xB3, 0xBD, 0xAE, 0xCF, 
+0x78, 0x8C, 0x55, 0x20, 0x59, 0xAA, 0x8F, 0xA5, 0x55, 0xFF, 0xCC, 0x6A, 0xDF, 0xD8, 0x3D, 0xB9, 0xA7, 
+0xCA, 0x50, 0x27, 0x08, 0xFE, 0x5C, 0x33, 0xEE, 0x53, 0x1B, 0xCD, 0x2E, 0xD8, 0xF3, 0x21, 0x40, 0x71, 
+0xEE, 0xA8, 0x6C, 0x18, 0x33, 0xBD, 0x64, 0xDB, 0xD0, 0x6C, 0x79, 0xD9, 0x6F, 0x31, 0xB1, 0x17, 0x21, 
+0x4D, 0x5E, 0x7A, 0x3F, 0x6F, 0x4C, 0x7A, 0xEA, 0xD4, 0x62, 0xC7, 0x23, 0x4D, 0x7C, 0x6F, 0xFD, 0xF6, 
+0x01, 0xD4, 0x03, 0xE3, 0xD6, 0x6C, 0x72, 0x5C, 0x0E, 0xAE, 0x9F, 0xD8, 0x0E, 0x87, 0xD1, 0xA8, 0x6F, 
+0x9F, 0x8C, 0xBF, 0x9F, 0x5D, 0x8E, 0xE2, 0x7E, 0x98, 0x4E, 0x5D, 0x22, 0x62, 0x30, 0xA0, 0x34, 0xE9, 
+0x9D, 0x7B, 0xE7, 0x59, 0xAE, 0x40, 0x45, 0xEB, 0xF2, 0xB5, 0xA7, 0x58, 0xB2, 0xC1, 0xAA, 0x63, 0xFC, 
+0x70, 0x96, 0x8B, 0xBD, 0x2C, 0x2E, 0xF7, 0xC4, 0xD1, 0x7F, 0x94, 0x92, 0x66, 0xC0, 0x62, 0xFA, 0x87, 
+0x48, 0x9E, 0xD1, 0x93, 0xD2, 0xCC, 0x98, 0x39, 0x47, 0x16, 0x4D, 0x2B, 0xA7, 0x45, 0x73, 0xBF, 0x34, 
+0xFF, 0xF8, 0x4B, 0x79, 0xB5, 0xDB, 0xE9, 0x38, 0x3D, 0xF8, 0xA8, 0x25, 0x49, 0x77, 0x3B, 0x6D, 0x03, 
+0x56, 0x4F, 0xC6, 0xEF, 0xBE, 0x07, 0xAC, 0xF7, 0xF5, 0x40, 0xC1, 0x48, 0xB9, 0x47, 0xF5, 0x40, 0xBD, 
+0x03, 0xA8, 0x77, 0xF5, 0x40, 0xBD, 0x05, 0xA8, 0xB7, 0xF5, 0x40, 0x1D, 0x02, 0xD4, 0x61, 0x3D, 0x50, 
+0x07, 0x00, 0x75, 0x50, 0x0F, 0xD4, 0x1B, 0x80, 0x7A, 0x53, 0x0F, 0xD4, 0x3E, 0x40, 0xED, 0xD7, 0x44, 
+0x52, 0xC3, 0xD1, 0x5A, 0xA0, 0x80, 0xED, 0xCD, 0x9A, 0x1E, 0x6F, 0x01, 0xA9, 0x1E, 0x9D, 0xC0, 0x51, 
+0xCD, 0x7A, 0x1C, 0x05, 0xA3, 0xD7, 0xAC, 0x67, 0xF4, 0x80, 0x52, 0xCD, 0x7A, 0x28, 0x05, 0x3C, 0x6F, 
+0xD6, 0xC3, 0x73, 0x98, 0x7C, 0xCD, 0x7A, 0x26, 0x1F, 0x44, 0x84, 0x66, 0x3D, 0x11, 0x01, 0xC2, 0x54, 
+0xB3, 0x9E, 0x30, 0x05, 0xB1, 0xB3, 0x59, 0x4F, 0xEC, 0x34, 0x21, 0xBD, 0xD9, 0xA9, 0x6B, 0x13, 0xC7, 
+0x60, 0xD5, 0xC3, 0x73, 0xF3, 0x7A, 0xB3, 0xD9, 0xD9, 0x82, 0xE9, 0xCF, 0x70, 0x1F, 0xE8, 0xBB, 0x7A, 
+0x68, 0x3B, 0x85, 0x9C, 0x86, 0x26, 0x9A, 0x71, 0xF5, 0xC4, 0x9E, 0xDD, 0x66, 0x8A, 0x61, 0xAE, 0xBE, 
+0xCB, 0x87, 0x37, 0xF3, 0x4A, 0xB7, 0x34, 0x03, 0xFF, 0xA8, 0x9E, 0xE9, 0x03, 0x5B, 0x6E, 0xD1, 0xFC, 
+0x85, 0xF5, 0x46, 0x0F, 0x69, 0xC6, 0x6A, 0x23, 0xFA, 0xB2, 0x27, 0xB8, 0x9A, 0x32, 0x29, 0xA0, 0x4E, 
+0x84, 0x2C, 0x7F, 0x15, 0x78, 0x3D, 0xAD, 0x7C, 0x46, 0xD4, 0x99, 0xDB, 0x63, 0xE8, 0x33, 0xBF, 0xCB, 
+0x29, 0x34, 0xBF, 0xDF, 0x80, 0x46, 0xD7, 0xF7, 0x42, 0xDE, 0xCB, 0x8A, 0xF4, 0xA4, 0x56, 0xA4, 0xCD, 
+0x4F, 0x7E, 0x15, 0x7C, 0x39, 0x12, 0x42, 0x53, 0x89, 0x62, 0xED, 0x1E, 0xB6, 0xFF, 0xAF, 0x07, 0x7F, 
+0xE7, 0xE7, 0xBF, 0xDA, 0xF9, 0xFC, 0x0D, 0x60, 0xCD, 0xA2, 0xD2, 0xBD, 0x55, 0xEB, 0x56, 0xC2, 0x14, 
+0xD9, 0x73, 0xD6, 0x86, 0xC3, 0x84, 0xB0, 0x24, 0x74, 0xB5, 0x48, 0x8F, 0x51, 0xA7, 0x9D, 0xDE, 0x9E, 
+0x38, 0x3D, 0x5F, 0x01, 0x6F, 0x93, 0xD0, 0x9E, 0x03, 0x87, 0xEC, 0x29, 0xBF, 0x41, 0x13, 0xAC, 0x10, 
+0xA1, 0x8A, 0x85, 0x09, 0x25, 0x08, 0x27, 0x30, 0xC6, 0x19, 0xE3, 0x1A, 0x0D, 0xEF, 0xD0, 0x95, 0xE4, 
+0x2C, 0x41, 0x67, 0x0C, 0x58, 0x21, 0xC5, 0xB8, 0xE5, 0x7B, 0xE9, 0x37, 0x3E, 0x71, 0x97, 0x6F, 0xDA, 
+0xDB, 0x63, 0xF7, 0x19, 0x0E, 0x69, 0x71, 0x27, 0xFF, 0xC1, 0xA1, 0xF1, 0x62, 0xB1, 0x3D, 0xEA, 0xEC, 
+0xC5, 0x2C, 0x90, 0x02, 0x7F, 0xC6, 0xB7, 0xAD, 0xCF, 0xCA, 0x1C, 0x4E, 0xC8, 0x6B, 0x6B, 0x81, 0x26, 
+0x74, 0xFC, 0x9B, 0xD2, 0x58, 0x67, 0xAA, 0x2A, 0xF6, 0xCE, 0x1C, 0x64, 0x27, 0xC7, 0xDE, 0x59, 0xC0, 
+0xDE, 0xE9, 0xBD, 0x7A, 0xE0, 0x97, 0x51, 0x96, 0xD8, 0x24, 0x07, 0x3D, 0x7C, 0x5F, 0x81, 0xFE, 0x5C, 
+0x72, 0xAA, 0xE7, 0xA1, 0x9F, 0x07, 0x83, 0x6B, 0xF4, 0x21, 0xD3, 0x91, 0x49, 0x62, 0x02, 0xFB, 0x52, 
+0xAB, 0xB5, 0xD4, 0x0E, 0x66, 0xC9, 0x27, 0x33, 0x3F, 0x55, 0x63, 0xC7, 0xC3, 0x29, 0xF3, 0xC6, 0x1D, 
+0x2F, 0xC7, 0xDE, 0xD9, 0x3D, 0x79, 0xD0, 0xF8, 0xEB, 0x0A, 0x4D, 0x42, 0xAA, 0x7F, 0xA2, 0x40, 0x68, 
+0xCC, 0xA7, 0x38, 0x2B, 0xB4, 0xC9, 0x75, 0xB5, 0x91, 0xD3, 0xB2, 0x67, 0x7A, 0x58, 0xAC, 0x92, 0x46, 
+0x61, 0xDE, 0x41, 0x30, 0x0A, 0x37, 0xD0, 0xCA, 0x98, 0x6F, 0xAC, 0xAF, 0xDB, 0x3D, 0x18, 0x44, 0xAA, 
+0xAA, 0x71, 0x71, 0x73, 0x2A, 0xE2, 0x18, 0xCC, 0x55, 0x8D, 0x4C, 0xF2, 0x3D, 0x04, 0xB3, 0x8C, 0x05, 
+0x65, 0xFA, 0x8C, 0xB1, 0xCC, 0x2B, 0x51, 0x37, 0xBF, 0x9E, 0x94, 0x36, 0xA1, 0x63, 0x50, 0xB6, 0x2F, 
+0x32, 0x09, 0x9E, 0xEC, 0xA2, 0x84, 0x4E, 0xD0, 0xF9, 0xBC, 0xC4, 0x74, 0x01, 0x7A, 0x2D, 0x09, 0xEA, 
+0x88, 0xA9, 0x96, 0xF9, 0xA7, 0x0F, 0x10, 0x99, 0x69, 0xD6, 0xD8, 0x5D, 0x6A, 0xF6, 0x67, 0xE9, 0x9C, 
+0x2D, 0xF4, 0xD8, 0x12, 0x89, 0x48, 0x69, 0x52, 0x44, 0xA1, 0xBB, 0x2B, 0xC4, 0xCC, 0x0F, 0xC4, 0x3A, 
+0x25, 0x38, 0x6D, 0x71, 0x11, 0x36, 0x9C, 0x8B, 0x1B, 0x74, 0x05, 0xC2, 0x90, 0x2A, 0xED, 0x9E, 0x94, 
+0x4A, 0x7C, 0x3D, 0xA9, 0xD0, 0x3F, 0x95, 0x52, 0xC8, 0xCA, 0x0A, 0xB0, 0x11, 0x6A, 0xD0, 0x96, 0xC6, 
+0x12, 0xD8, 0xD0, 0x92, 0x14, 0x93, 0xBB, 0x3E, 0xCC, 0x4F, 0x8A, 0x5E, 0x77, 0x8B, 0x6E, 0x6B, 0x5D, 
+0x5D, 0x9F, 0x5F, 0xAE, 0x83, 0x29, 0xB3, 0xE5, 0x94, 0x0B, 0xB5, 0xDA, 0x96, 0x9C, 0x12, 0x5B, 0x5B, 
+0x19, 0x53, 0xA5, 0x20, 0x3E, 0x6C, 0xE7, 0x68, 0x6B, 0xD9, 0x31, 0x72, 0x50, 0x13, 0xD1, 0x16, 0xC1, 
+0x1A, 0x6F, 0xEF, 0x6F, 0x58, 0x1A, 0x2C, 0xDA, 0x2F, 0x4C, 0x69, 0x33, 0x03, 0x1B, 0x96, 0x99, 0x7B, 
+0x1B, 0x78, 0xFF, 0xF5, 0x54, 0x85, 0x95, 0x8D, 0xD6, 0x7B, 0x5D, 0x52, 0x9D, 0xC9, 0x64, 0x53, 0x1F, 
+0x9B, 0x9F, 0x4A, 0xBE, 0x5A, 0xEB, 0x9F, 0xD9, 0x94, 0xB3, 0xB9, 0x04, 0x0C, 0x05, 0x11, 0x41, 0x16, 
+0x83, 0x33, 0x5A, 0x40, 0xA6, 0x73, 0x4E, 0xCD, 0xD7, 0x1F, 0xEE, 0x2E, 0x48, 0x63, 0xF9, 0xBC, 0xC1, 
+0x1A, 0x40, 0x0B, 0xD6, 0xB2, 0x09, 0x11, 0x40, 0xE6, 0xFD, 0xAF, 0x18, 0x1E, 0x70, 0x33, 0x3C, 0x78, 
+0xD2, 0x12, 0xB0, 0xAF, 0xEB, 0x42, 0xCF, 0x84, 0x25, 0x44, 0x4C, 0x80, 0x44, 0x5C, 0x60, 0x52, 0x60, 
+0x10, 0x2A, 0x0D, 0x83, 0x10, 0xDE, 0xCC, 0xEB, 0x14, 0x91, 0xE9, 0xC6, 0x62, 0x1C, 0xDF, 0x43, 0x87, 
+0xED, 0x76, 0x49, 0xEF, 0x0F, 0x45, 0x66, 0x41, 0x76, 0x0F, 0x72, 0x87, 0xD2, 0xE6, 0xC6, 0x85, 0x10, 
+0x97, 0x40, 0x13, 0x67, 0x16, 0x40, 0x2D, 0xC5, 0x94, 0x53, 0x12, 0xA9, 0x4C, 0x63, 0x26, 0x67, 0x21, 
+0x73, 0x1A, 0xE1, 0x16, 0x63, 0xA8, 0x73, 0xDF, 0xA2, 0xCC, 0xD3, 0x73, 0x71, 0x1B, 0xF2, 0x1A, 0xBB, 
+0x2B, 0xBA, 0xC9, 0x0F, 0x2A, 0xF4, 0xED, 0x7A, 0x3D, 0xED, 0xE8, 0xAC, 0x50, 0x34, 0x8D, 0xA5, 0x8B, 
+0x92, 0x45, 0xA9, 0x7B, 0xFC, 0x15, 0xA3, 0xF1, 0x30, 0x01, 0xF0, 0x3D, 0xF3, 0xAF, 0x6A, 0xBD, 0x57, 
+0xBE, 0x97, 0xFF, 0xE3, 0xE0, 0xFF, 0x00, 0x6D, 0x25, 0xD5, 0x06, 0x4C, 0x38, 0x00, 0x00};#endif // _BZF_SETTINGS_H
\ No newline at end of file
@@ -1,4 +1,4 @@
-// // bzf_style.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_STYLE_H#define _BZF_STYLE_H #define BZF_STYLE_MT "text/css"#define BZF_STYLE_PATH "/style.css"#define BZF_STYLE_SIZE 4647const uint8_t bzf_style[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0xC5, 0x85, 0xDE, 0x5F, 0x02, 0xFF, 0xDD, 0x3C, 0x6B, 0x93, 0xDB, 0x38, 0x72, 
+// // bzf_style.h// // THIS FILE IS AUTOMATIC GENERATED#ifndef _BZF_STYLE_H#define _BZF_STYLE_H #define BZF_STYLE_MT "text/css"#define BZF_STYLE_PATH "/style.css"#define BZF_STYLE_SIZE 4647#define BZF_STYLE_HASH 0x535DFDCBULconst uint8_t bzf_style[] PROGMEM = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xDD, 0x3C, 0x6B, 0x93, 0xDB, 0x38, 0x72, 
 0x9F, 0xC7, 0x55, 0xFE, 0x0F, 0x8C, 0xB7, 0x7C, 0x7E, 0xDC, 0x90, 0xA6, 0x48, 0x51, 0xD2, 0xC8, 0xB5, 
 0x97, 0x7D, 0xD4, 0xBA, 0x2E, 0x95, 0xDC, 0x5E, 0x25, 0xDE, 0x54, 0x25, 0xE5, 0xF8, 0x03, 0x44, 0x42, 
 0x12, 0x6F, 0x28, 0x51, 0x45, 0x52, 0x9E, 0x99, 0x4D, 0x6D, 0x7E, 0x7B, 0x1A, 0x6F, 0x34, 0x00, 0x4A, 
@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+# -*- coding: utf8 -*-
+
+"""
+
+IoTR - Robot Monitoring Device System
+
+Copyright (C) [2020] [Orlin Dmitrov]
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+
+import time
+import json
+import argparse
+import threading
+import statistics
+
+import paho.mqtt.client as mqtt
+
+#region File Attributes
+
+__author__ = "Orlin Dimitrov"
+"""Author of the file."""
+
+__copyright__ = "Orlin Dimitrov"
+"""Copyrighter"""
+
+__credits__ = ["Milen Cholakov"]
+"""Credits"""
+
+__license__ = "GPLv3"
+"""License
+@see http://www.gnu.org/licenses/"""
+
+__version__ = "1.0.0"
+"""Version of the file."""
+
+__maintainer__ = "Orlin Dimitrov"
+"""Name of the maintainer."""
+
+__email__ = "orlin369@gmail.com"
+"""E-mail of the author.
+@see orlin369@gmail.com"""
+
+__status__ = "Debug"
+"""File status."""
+
+#endregion
+
+class Benchmark:
+    """Publish telemetry like the device does and measure rate and latency."""
+
+#region Attributes
+
+    __host = "localhost"
+    """Broker host."""
+
+    __port = 1883
+    """Broker port."""
+
+    __topic = "roboleague/iotr/benchmark/serial/in"
+    """Benchmark topic."""
+
+    __received = []
+    """Latencies of the received messages [ms]."""
+
+    __done = None
+    """All messages received event."""
+
+    __count = 0
+    """Messages per run."""
+
+#endregion
+
+#region Constructor
+
+    def __init__(self, host, port):
+
+        self.__host = host
+        self.__port = port
+        self.__done = threading.Event()
+
+#endregion
+
+#region Private Methods
+
+    def __on_message(self, client, userdata, msg):
+
+        now = time.time() * 1000.0
+
+        # Skip retained message from previous run.
+        if msg.retain or len(msg.payload) == 0:
+            return
+
+        jmsg = json.loads(msg.payload.decode("utf-8"))
+        self.__received.append(now - jmsg["ts"])
+
+        if len(self.__received) >= self.__count:
+            self.__done.set()
+
+    def __create_client(self, name):
+
+        client = mqtt.Client(client_id="iotr-benchmark-{}".format(name))
+        client.connect(host=self.__host, port=self.__port, keepalive=60)
+        client.loop_start()
+
+        return client
+
+#endregion
+
+#region Public Methods
+
+    def run(self, qos, retain, count, size, timeout):
+        """Run one setting.
+
+        Parameters
+        ----------
+        qos : int
+            Publish and subscribe QoS.
+        retain : bool
+            Publish retain flag.
+        count : int
+            Count of messages.
+        size : int
+            Size of the message content.
+        timeout : float
+            Maximum run time [s].
+
+        Returns
+        -------
+        dict
+            Run results.
+        """
+
+        self.__received = []
+        self.__count = count
+        self.__done.clear()
+
+        subscriber = self.__create_client("sub")
+        subscriber.on_message = self.__on_message
+        subscriber.subscribe(self.__topic, qos)
+
+        publisher = self.__create_client("pub")
+
+        # Let the subscription settle.
+        time.sleep(0.5)
+
+        content = "x" * size
+        start = time.time()
+
+        for index in range(count):
+            payload = json.dumps({"ts": time.time() * 1000.0, "msg": content})
+            info = publisher.publish(self.__topic, payload, qos, retain)
+            info.wait_for_publish()
+
+        self.__done.wait(timeout)
+        elapsed = time.time() - start
+
+        # Do not leave retained message for the next run.
+        if retain:
+            publisher.publish(self.__topic, "", 0, True).wait_for_publish()
+
+        publisher.loop_stop()
+        publisher.disconnect()
+        subscriber.loop_stop()
+        subscriber.disconnect()
+
+        latencies = sorted(self.__received)
+        received = len(latencies)
+
+        result = {"qos": qos, "retain": retain, "sent": count, "received": received,\
+            "rate": received / elapsed if elapsed > 0 else 0.0,\
+            "avg": statistics.mean(latencies) if received > 0 else 0.0,\
+            "p95": latencies[int(received * 0.95) - 1] if received > 0 else 0.0}
+
+        return result
+
+#endregion
+
+def main():
+    """Main"""
+
+    # Create parser.
+    parser = argparse.ArgumentParser()
+
+    # Add arguments.
+    parser.add_argument("--host", type=str, default="localhost", help="Broker host.")
+    parser.add_argument("--port", type=int, default=1883, help="Broker port.")
+    parser.add_argument("--count", type=int, default=1000, help="Messages per setting.")
+    parser.add_argument("--size", type=int, default=64, help="Size of the message content.")
+    parser.add_argument("--timeout", type=float, default=30.0, help="Maximum time of one setting [s].")
+
+    # Take arguments.
+    args = parser.parse_args()
+
+    benchmark = Benchmark(args.host, args.port)
+
+    print("QoS\tRetain\tSent\tRecv\tRate[msg/s]\tAvg[ms]\tP95[ms]")
+
+    for qos in [0, 1, 2]:
+        for retain in [False, True]:
+            result = benchmark.run(qos, retain, args.count, args.size, args.timeout)
+            print("{qos}\t{retain}\t{sent}\t{received}\t{rate:.1f}\t\t{avg:.2f}\t{p95:.2f}".format(**result))
+
+if __name__ == "__main__":
+    main()
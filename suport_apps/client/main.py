@@ -33,6 +33,7 @@ import traceback
 import configparser
 
 import paho.mqtt.client as mqtt
+import msgpack
 
 #region File Attributes
 
@@ -215,15 +216,41 @@ class Device:
     def __on_subscribe(self, client, userdata, mid, granted_qos):
         self.__logger.info("Subscribed to Topic: {} with QoS: {}".format(mid, str(granted_qos)))
 
+    def __decode_payload(self, payload):
+        """Decode JSON or MessagePack payload.
+
+        Parameters
+        ----------
+        payload : bytes
+            Message payload.
+
+        Returns
+        -------
+        object
+            Decoded message.
+        """
+
+        # JSON always starts with an object or an array.
+        if payload[:1] in (b"{", b"["):
+            return json.loads(payload.decode("utf-8"))
+
+        return msgpack.unpackb(payload, raw=False)
+
     def __on_message(self, client, userdata, msg):
 
-        message = msg.payload.decode("utf-8")
+        if len(msg.payload) == 0:
+            return
+
+        if msg.topic in (self.__create_topic("/status"), self.__create_topic("/serial/in")):
+            message = self.__decode_payload(msg.payload)
+        else:
+            message = msg.payload.decode("utf-8")
+
         content = {"topic": str(msg.topic), "payload": message, "qos": msg.qos}
         self.__logger.info(str(content))
 
         if msg.topic == self.__create_topic("/status"):
-            jmsg = json.loads(message)
-            dt_object = datetime.fromtimestamp(jmsg["ts"])
+            dt_object = datetime.fromtimestamp(message["ts"])
             print(dt_object)
 
         elif msg.topic == self.__create_topic("/serial/in"):
@@ -129,6 +129,16 @@ class CPPWriter:
         value_name = name.replace(".", "_")
         self.__file_content += "#define {} {}\r".format(value_name, value)
 
+    def write_include(self, file_name):
+        """Write include line."""
+
+        self.__file_content += "#include \"{}\"\r".format(file_name)
+
+    def write_line(self, text=""):
+        """Write raw line."""
+
+        self.__file_content += "{}\r".format(text)
+
     def write_ifdef(self, value):
         """Write ifdef open block."""
 
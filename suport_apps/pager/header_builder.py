@@ -68,6 +68,9 @@ class HeaderBuilder:
     __output_file = None
     """Output file."""
 
+    __assets = None
+    """Built assets, name and path pairs."""
+
 #endregion
 
 #region Constructor
@@ -77,6 +80,7 @@ class HeaderBuilder:
 
         self.__base_path = base_path
         self.__output_file = CPPWriter()
+        self.__assets = []
 
 #endregion
 
@@ -150,7 +154,19 @@ class HeaderBuilder:
             src_data = src_file.read()
             src_file.close()
 
-        return gzip.compress(src_data)
+        # Zero time stamp, so the same source gives the same header.
+        return gzip.compress(src_data, mtime=0)
+
+    def __get_hash(self, data):
+        """FNV-1a 32 bit hash of the content."""
+
+        hash_value = 2166136261
+
+        for single_byte in data:
+            hash_value ^= single_byte
+            hash_value = (hash_value * 16777619) & 0xFFFFFFFF
+
+        return hash_value
 
     def __escape_extention(self, text):
         """Escape extention."""
@@ -206,6 +222,11 @@ class HeaderBuilder:
         def_value = len(compressed_dst_data)
         self.__output_file.write_define(def_name, def_value)
 
+        # Define content hash.
+        def_name = "{}{}".format(out_file_name_no_h.upper(), "_HASH")
+        def_value = "0x{:08X}UL".format(self.__get_hash(compressed_dst_data))
+        self.__output_file.write_define(def_name, def_value)
+
         # Write array.
         self.__output_file.write_array("const uint8_t", out_file_name_no_h, "PROGMEM", compressed_dst_data)
 
@@ -222,5 +243,66 @@ class HeaderBuilder:
         self.__output_file.to_file(dst_file_path)
         self.__output_file.clear()
 
+        # Remember the asset for the table.
+        self.__assets.append((out_file_name_no_h, "/{}".format(dir_item)))
+
+        # Generate Include lines
+        print(self.__generate_include_line(out_file_name))
+
+    def build_table(self):
+        """Build the assets table of all built files."""
+
+        out_file_name = "bzf_assets.h"
+        dst_file_path = os.path.join(self.__base_path, "..\\pages\\", out_file_name)
+
+        # The table is binary searched, so keep it sorted by path.
+        assets = sorted(self.__assets, key=lambda asset: asset[1])
+
+        # Header name
+        self.__output_file.write_header(out_file_name)
+
+        # Write automation comment.
+        self.__output_file.write_comment("THIS FILE IS AUTOMATIC GENERATED")
+
+        # Write security strings
+        self.__output_file.write_ifndef("_BZF_ASSETS_H")
+        self.__output_file.write_define("_BZF_ASSETS_H")
+
+        # Beautify
+        self.__output_file.write_new_line()
+
+        # Include all assets.
+        for name, _ in assets:
+            self.__output_file.write_include("{}.h".format(name))
+
+        # Beautify
+        self.__output_file.write_new_line()
+
+        # Define assets count.
+        self.__output_file.write_define("BZF_ASSETS_COUNT", len(assets))
+
+        # Beautify
+        self.__output_file.write_new_line()
+
+        # Write table entries: path, MIME type, data, size, hash.
+        self.__output_file.write_comment("Sorted by path.")
+        self.__output_file.write_line("#define BZF_ASSETS_TABLE \\")
+        for index, (name, _) in enumerate(assets):
+            prefix = name.upper()
+            entry = "{{ {0}_PATH, {0}_MT, {1}, {0}_SIZE, {0}_HASH }}".format(prefix, name)
+            if index < len(assets) - 1:
+                entry += ", \\"
+            self.__output_file.write_line("\t" + entry)
+
+        # Beautify
+        self.__output_file.write_new_line()
+
+        # End security.
+        self.__output_file.write_endif("_BZF_ASSETS_H")
+
+        # Put it to file.
+        self.__output_file.to_file(dst_file_path)
+        self.__output_file.clear()
+
         # Generate Include lines
         print(self.__generate_include_line(out_file_name))
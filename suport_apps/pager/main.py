@@ -81,6 +81,9 @@ def main():
         finally:
             pass
 
+    # Table of all assets for the WEB server.
+    header_builder.build_table()
+
     print("Done")
 
 if __name__ == "__main__":
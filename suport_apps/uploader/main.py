@@ -24,6 +24,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 import os
 import sys
+import gzip
 import argparse
 from base64 import b64encode
 
@@ -72,6 +73,7 @@ def main():
     parser.add_argument("--path", type=str, default=".", help="Path to the target files.")
     parser.add_argument("--user", type=str, default="admin", help="Usre name")
     parser.add_argument("--password", type=str, default="admin", help="Password")
+    parser.add_argument("--gzip", action="store_true", help="Upload gzip compressed files as \"name.gz\".")
 
     # Take arguments.
     args = parser.parse_args()
@@ -85,6 +87,11 @@ def main():
             file_name = os.path.join(base_path, file)
             fin = open(file_name, 'rb')
             files = {'file': fin}
+
+            # The device serves the ".gz" sibling with gzip content encoding.
+            if args.gzip and not file.endswith(".gz"):
+                files = {'file': (file + ".gz", gzip.compress(fin.read(), mtime=0))}
+
             print(file_name)
             r = requests.post(url=url, auth=HTTPDigestAuth(args.user, args.password), files=files)
             print(r)
@@ -0,0 +1,205 @@
+/*
+
+IoTR - Robot Monitoring Device System
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+// bench_frame_pool.cpp
+
+// Host benchmark of the serial frame serialization. Counts the heap
+// allocations per message with a replaced operator new, for the frame
+// pool and for the String concatenation it replaced.
+
+#include <new>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include "FramePool.h"
+
+#pragma region Host
+
+HostSerial Serial;
+HostSerial Serial1;
+
+unsigned long micros() { return 0; }
+unsigned long millis() { return 0; }
+
+/** @brief Heap allocations while counting. */
+static unsigned long Allocations_g = 0;
+
+/** @brief Count the allocations. */
+static bool Counting_g = false;
+
+void* operator new(size_t size)
+{
+	if (Counting_g)
+	{
+		Allocations_g++;
+	}
+
+	void* BlockL = malloc((size > 0) ? size : 1);
+	if (BlockL == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return BlockL;
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* block) noexcept
+{
+	free(block);
+}
+
+void operator delete[](void* block) noexcept
+{
+	free(block);
+}
+
+void operator delete(void* block, size_t size) noexcept
+{
+	free(block);
+}
+
+void operator delete[](void* block, size_t size) noexcept
+{
+	free(block);
+}
+
+#pragma endregion
+
+#pragma region Paths
+
+/** @brief Keeps the payloads alive for the optimizer. */
+static size_t Sink_g = 0;
+
+/** @brief Message the way the firmware publishes it, continued in more frames if needed. */
+static void publish_pool(const std::string& message, bool msgpack)
+{
+	size_t PositionL = 0;
+
+	while (PositionL < message.size())
+	{
+		SerialFrame_t* FrameL = FramePool.acquire();
+		if (FrameL == nullptr)
+		{
+			return;
+		}
+
+		if (msgpack)
+		{
+			PositionL += FramePoolClass::serializeMsgPack(FrameL, 1602720000000ULL, message.data() + PositionL, message.size() - PositionL);
+		}
+		else
+		{
+			PositionL += FramePoolClass::serialize(FrameL, 1602720000000ULL, message.data() + PositionL, message.size() - PositionL);
+		}
+
+		Sink_g += FrameL->Length;
+		FramePool.release(FrameL);
+	}
+}
+
+/** @brief Message built by concatenation, as before the frame pool. */
+static void publish_concat(const std::string& message)
+{
+	std::string MessageL = "";
+	for (size_t index = 0; index < message.size(); index++)
+	{
+		MessageL += message[index];
+	}
+
+	char TimestampL[21];
+	snprintf(TimestampL, sizeof(TimestampL), "%llu", 1602720000000ULL);
+
+	std::string JSONMsgL = "";
+	JSONMsgL += "{\"ts\":";
+	JSONMsgL += std::string(TimestampL);
+	JSONMsgL += ", \"msg\":\"";
+	JSONMsgL += MessageL;
+	JSONMsgL += "\"}";
+
+	Sink_g += JSONMsgL.size();
+}
+
+#pragma endregion
+
+/** @brief Run one path over all messages.
+ *  @return unsigned long, Allocations.
+ */
+template <typename Path>
+static unsigned long run(const char* name, const std::vector<std::string>& messages, unsigned long rounds, Path path)
+{
+	Allocations_g = 0;
+	Counting_g = true;
+	auto StartL = std::chrono::steady_clock::now();
+
+	for (unsigned long round = 0; round < rounds; round++)
+	{
+		for (const std::string& message : messages)
+		{
+			path(message);
+		}
+	}
+
+	double TimeL = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - StartL).count();
+	Counting_g = false;
+
+	double CountL = (double)messages.size() * (double)rounds;
+	printf("%-10s %8.2f allocations/message %10.1f ns/message\n", name, Allocations_g / CountL, TimeL / CountL);
+
+	return Allocations_g;
+}
+
+int main(int argc, char** argv)
+{
+	const char* PathL = (argc > 1) ? argv[1] : "fixtures/serial_capture.txt";
+	const unsigned long RoundsL = 2000;
+	std::vector<std::string> MessagesL;
+	std::ifstream FileL(PathL);
+	std::string LineL;
+
+	while (std::getline(FileL, LineL))
+	{
+		MessagesL.push_back(LineL);
+	}
+
+	if (MessagesL.empty())
+	{
+		printf("FAIL no capture in %s\n", PathL);
+		return 1;
+	}
+
+	unsigned long JsonL = run("pool json", MessagesL, RoundsL, [](const std::string& message) { publish_pool(message, false); });
+	unsigned long MsgPackL = run("pool mpk", MessagesL, RoundsL, [](const std::string& message) { publish_pool(message, true); });
+	unsigned long ConcatL = run("concat", MessagesL, RoundsL, publish_concat);
+
+	// The reference path proves the counter works.
+	bool PassL = (JsonL == 0) && (MsgPackL == 0) && (ConcatL > 0) && (FramePool.available() == SERIAL_FRAME_POOL_SIZE);
+
+	printf("%s (%zu bytes out)\n", PassL ? "PASS" : "FAIL", Sink_g);
+
+	return PassL ? 0 : 1;
+}
@@ -0,0 +1,20 @@
+#!/bin/sh
+# Build and run the host tests. Needs g++ only, run it from any directory.
+
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+SRC="$HERE/../../IoTR"
+OUT="${OUT:-$HERE/build}"
+CXXFLAGS="-std=c++14 -O2 -Wall -Wno-unknown-pragmas -DARDUINO=200 -I$HERE/stub -I$SRC"
+
+mkdir -p "$OUT"
+
+g++ $CXXFLAGS "$HERE/test_serial_ingest.cpp" "$SRC/SerialIngest.cpp" -o "$OUT/test_serial_ingest"
+"$OUT/test_serial_ingest" "$HERE/fixtures/serial_capture.txt"
+
+g++ $CXXFLAGS "$HERE/bench_frame_pool.cpp" "$SRC/FramePool.cpp" "$SRC/MsgPack.cpp" -o "$OUT/bench_frame_pool"
+"$OUT/bench_frame_pool" "$HERE/fixtures/serial_capture.txt"
+
+g++ $CXXFLAGS "$HERE/test_scheduler.cpp" "$SRC/Scheduler.cpp" -o "$OUT/test_scheduler"
+"$OUT/test_scheduler"
@@ -0,0 +1,93 @@
+/*
+
+IoTR - Robot Monitoring Device System
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+// Arduino.h
+
+// Host stub of the Arduino core, only what the modules under test use.
+
+#ifndef _ARDUINO_STUB_h
+#define _ARDUINO_STUB_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+/** @brief Time source, the test drives it. */
+unsigned long micros();
+unsigned long millis();
+
+/** @brief Waiting, the test provides it when the module needs it. */
+void delay(unsigned long ms);
+void yield();
+
+/** @brief Output that drops everything. */
+class Print
+{
+public:
+	virtual ~Print() {}
+	virtual size_t write(uint8_t data) { return 1; }
+	virtual size_t write(const uint8_t* buffer, size_t size) { return size; }
+	size_t printf(const char* format, ...) { return 0; }
+	size_t print(const char* text) { return strlen(text); }
+};
+
+/** @brief Input stream. */
+class Stream : public Print
+{
+public:
+	virtual int available() = 0;
+	virtual int read() = 0;
+	virtual int peek() = 0;
+
+	virtual size_t readBytes(char* buffer, size_t length)
+	{
+		size_t CountL = 0;
+		while ((CountL < length) && (available() > 0))
+		{
+			buffer[CountL++] = (char)read();
+		}
+		return CountL;
+	}
+
+	size_t readBytes(uint8_t* buffer, size_t length)
+	{
+		return readBytes((char*)buffer, length);
+	}
+};
+
+/** @brief Debug and device ports, output is dropped. */
+class HostSerial : public Print
+{
+public:
+	void begin(unsigned long baudrate) {}
+};
+
+extern HostSerial Serial;
+extern HostSerial Serial1;
+
+#endif
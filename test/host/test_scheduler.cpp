@@ -0,0 +1,186 @@
+/*
+
+IoTR - Robot Monitoring Device System
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+// test_scheduler.cpp
+
+// Host test of the scheduler. Tasks restart and cancel themselves and
+// each other from their runs, the heap has to hold every active task
+// exactly once and nothing may run twice or after it is cancelled.
+
+#include "Scheduler.h"
+
+#pragma region Host
+
+HostSerial Serial;
+HostSerial Serial1;
+
+/** @brief Simulated time [ms]. */
+static unsigned long Now_g = 0;
+
+unsigned long micros() { return Now_g * 1000UL; }
+unsigned long millis() { return Now_g; }
+void delay(unsigned long ms) { Now_g += ms; }
+void yield() {}
+
+/** @brief Failed checks. */
+static int Failures_g = 0;
+
+#define CHECK(condition, ...) do { if (!(condition)) { Failures_g++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+/** @brief Scheduler with the heap open for the checks. */
+class TestScheduler : public SchedulerClass
+{
+public:
+	uint8_t heapCount() { return m_heapCount; }
+};
+
+static TestScheduler Scheduler_g;
+
+/** @brief Run the scheduler for a time, one pass per millisecond.
+ *  @param time unsigned long, Time [ms].
+ */
+static void run_for(unsigned long time)
+{
+	for (unsigned long index = 0; index < time; index++)
+	{
+		Scheduler_g.update();
+		Now_g++;
+	}
+}
+
+#pragma endregion
+
+#pragma region Tasks
+
+static uint8_t FastId_g = SCHEDULER_NO_TASK;
+static uint8_t SlowId_g = SCHEDULER_NO_TASK;
+static uint8_t OnceId_g = SCHEDULER_NO_TASK;
+
+static unsigned long FastRuns_g = 0;
+static unsigned long SlowRuns_g = 0;
+static unsigned long OnceRuns_g = 0;
+
+static bool FastRestart_g = false;
+static bool FastCancelSlow_g = false;
+
+void task_fast(unsigned long now)
+{
+	FastRuns_g++;
+
+	if (FastRestart_g)
+	{
+		Scheduler_g.restart(FastId_g, 10);
+	}
+
+	if (FastCancelSlow_g)
+	{
+		Scheduler_g.cancel(SlowId_g);
+	}
+}
+
+void task_slow(unsigned long now)
+{
+	SlowRuns_g++;
+}
+
+void task_once(unsigned long now)
+{
+	// Rearm itself, the way a one-shot is reused.
+	if (++OnceRuns_g < 3)
+	{
+		Scheduler_g.restart(OnceId_g, 50);
+	}
+}
+
+#pragma endregion
+
+#pragma region Tests
+
+/** @brief Periodic tasks keep their rate. */
+static void test_period()
+{
+	FastId_g = Scheduler_g.every("fast", 10, task_fast, PriorityHigh);
+	SlowId_g = Scheduler_g.every("slow", 10, task_slow, PriorityLow);
+
+	run_for(100);
+
+	CHECK(FastRuns_g == 10, "fast ran %lu times", FastRuns_g);
+	CHECK(SlowRuns_g == 10, "slow ran %lu times", SlowRuns_g);
+	CHECK(Scheduler_g.heapCount() == 2, "heap holds %u tasks", Scheduler_g.heapCount());
+}
+
+/** @brief A task that restarts itself from its run is queued once. */
+static void test_restart_self()
+{
+	FastRuns_g = 0;
+	FastRestart_g = true;
+
+	run_for(100);
+
+	CHECK(FastRuns_g == 10, "restarted task ran %lu times", FastRuns_g);
+	CHECK(Scheduler_g.heapCount() == 2, "heap holds %u tasks", Scheduler_g.heapCount());
+
+	FastRestart_g = false;
+}
+
+/** @brief A task cancelled by an earlier task of the same pass does not run. */
+static void test_cancel_due()
+{
+	SlowRuns_g = 0;
+	FastCancelSlow_g = true;
+
+	run_for(100);
+
+	CHECK(SlowRuns_g == 0, "cancelled task ran %lu times", SlowRuns_g);
+	CHECK(Scheduler_g.heapCount() == 1, "heap holds %u tasks", Scheduler_g.heapCount());
+
+	FastCancelSlow_g = false;
+}
+
+/** @brief A one-shot task runs once per restart. */
+static void test_one_shot()
+{
+	OnceId_g = Scheduler_g.after("once", 50, task_once);
+
+	run_for(500);
+
+	CHECK(OnceRuns_g == 3, "one-shot ran %lu times", OnceRuns_g);
+	CHECK(Scheduler_g.heapCount() == 1, "heap holds %u tasks", Scheduler_g.heapCount());
+
+	// Accounting is kept for the API.
+	const SchedulerTask_t* TaskL = Scheduler_g.get(OnceId_g);
+	CHECK((TaskL != NULL) && (TaskL->Runs == 3), "one-shot accounted %lu runs", (TaskL != NULL) ? TaskL->Runs : 0UL);
+	CHECK(Scheduler_g.count() == 3, "scheduler has %u tasks", Scheduler_g.count());
+}
+
+#pragma endregion
+
+int main()
+{
+	test_period();
+	test_restart_self();
+	test_cancel_due();
+	test_one_shot();
+
+	printf("%s\n", (Failures_g == 0) ? "PASS" : "FAIL");
+
+	return (Failures_g == 0) ? 0 : 1;
+}
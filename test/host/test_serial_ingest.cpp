@@ -0,0 +1,315 @@
+/*
+
+IoTR - Robot Monitoring Device System
+Copyright (C) [2020] [Orlin Dimitrov] GPLv3
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+// test_serial_ingest.cpp
+
+// Host test of the serial ingest engine. A recorded device stream is
+// replayed at the line rate and the frames, their latency and the time
+// spent in update() are checked.
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+
+#include "SerialIngest.h"
+
+#pragma region Host
+
+HostSerial Serial;
+HostSerial Serial1;
+
+/** @brief Simulated time [us]. */
+static unsigned long Now_g = 0;
+
+unsigned long micros() { return Now_g; }
+unsigned long millis() { return Now_g / 1000UL; }
+
+/** @brief Worst update() time on the host [us], the engine never waits for the port. */
+#define UPDATE_TIME_LIMIT 1000.0
+
+/** @brief Failed checks. */
+static int Failures_g = 0;
+
+#define CHECK(condition, ...) do { if (!(condition)) { Failures_g++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+#pragma endregion
+
+#pragma region Replay port
+
+/** @brief Replays bytes at the line rate, each byte has its arrival time. */
+class ReplayPort : public Stream
+{
+public:
+	std::string Data;
+	std::vector<unsigned long> Arrival;
+	size_t Position = 0;
+	bool Overread = false;
+
+	/** @brief Queue bytes that start to arrive at the given time.
+	 *  @return unsigned long, Arrival time of the last byte [us].
+	 */
+	unsigned long send(const std::string& bytes, unsigned long start, unsigned long baudrate)
+	{
+		// 10 bits per character: start, 8 data, stop.
+		double CharTimeL = 10.0e6 / (double)baudrate;
+		for (size_t index = 0; index < bytes.size(); index++)
+		{
+			Data.push_back(bytes[index]);
+			Arrival.push_back(start + (unsigned long)(CharTimeL * (index + 1)));
+		}
+		return Arrival.empty() ? start : Arrival.back();
+	}
+
+	int available() override
+	{
+		// Arrival times are sorted.
+		auto EndL = std::upper_bound(Arrival.begin() + Position, Arrival.end(), Now_g);
+		return (int)(EndL - (Arrival.begin() + Position));
+	}
+
+	int read() override
+	{
+		return (available() > 0) ? (uint8_t)Data[Position++] : -1;
+	}
+
+	int peek() override
+	{
+		return (available() > 0) ? (uint8_t)Data[Position] : -1;
+	}
+
+	size_t readBytes(char* buffer, size_t length) override
+	{
+		// The engine must only ask for what is already received.
+		if (length > (size_t)available())
+		{
+			Overread = true;
+			length = (size_t)available();
+		}
+		memcpy(buffer, Data.data() + Position, length);
+		Position += length;
+		return length;
+	}
+};
+
+#pragma endregion
+
+#pragma region Frames
+
+struct Frame_t
+{
+	std::string Data;
+	unsigned long Time;
+};
+
+static std::vector<Frame_t> Frames_g;
+
+static void on_frame(const char* data, size_t length)
+{
+	Frames_g.push_back({ std::string(data, length), Now_g });
+}
+
+/** @brief Read the recorded stream. */
+static std::vector<std::string> load_capture(const char* path)
+{
+	std::vector<std::string> LinesL;
+	std::ifstream FileL(path);
+	std::string LineL;
+
+	while (std::getline(FileL, LineL))
+	{
+		LinesL.push_back(LineL);
+	}
+
+	return LinesL;
+}
+
+/** @brief Split message the way the engine does when it does not fit in one frame. */
+static void expect_frames(std::vector<std::string>& expected, const std::string& message)
+{
+	for (size_t index = 0; index < message.size(); index += SERIAL_FRAME_MAX_SIZE)
+	{
+		expected.push_back(message.substr(index, SERIAL_FRAME_MAX_SIZE));
+	}
+}
+
+/** @brief Run the loop until the port is empty and the line is silent. */
+static double run_loop(ReplayPort& port, unsigned long pass, unsigned long end, double* worst)
+{
+	double TotalL = 0.0;
+	unsigned long PassesL = 0;
+
+	*worst = 0.0;
+
+	while ((Now_g <= end) || (port.Position < port.Data.size()))
+	{
+		auto StartL = std::chrono::steady_clock::now();
+		SerialIngest.update();
+		double TimeL = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - StartL).count();
+
+		TotalL += TimeL;
+		*worst = std::max(*worst, TimeL);
+		PassesL++;
+		Now_g += pass;
+	}
+
+	return TotalL / (double)PassesL;
+}
+
+#pragma endregion
+
+#pragma region Tests
+
+/** @brief Delimiter framing at the device baud rate, frame latency is one loop pass. */
+static void test_delimiter(const std::vector<std::string>& lines, unsigned long pass)
+{
+	ReplayPort PortL;
+	std::vector<std::string> ExpectedL;
+	std::vector<unsigned long> DoneL;
+	const unsigned long BaudrateL = 115200;
+
+	Now_g = 1000;
+	Frames_g.clear();
+	SerialIngest.init(&PortL);
+	SerialIngest.setDelimiter('\n');
+	SerialIngest.setBaudrate(BaudrateL);
+	SerialIngest.setFrameCb(on_frame);
+
+	unsigned long TimeL = Now_g;
+	for (const std::string& line : lines)
+	{
+		TimeL = PortL.send(line + "\n", TimeL, BaudrateL);
+		expect_frames(ExpectedL, line);
+		DoneL.push_back(TimeL);
+	}
+
+	double WorstL;
+	double AverageL = run_loop(PortL, pass, TimeL + 10000UL, &WorstL);
+
+	CHECK(!PortL.Overread, "read more than available");
+	CHECK(Frames_g.size() == ExpectedL.size(), "pass %lu us: %zu frames, expected %zu", pass, Frames_g.size(), ExpectedL.size());
+
+	for (size_t index = 0; (index < Frames_g.size()) && (index < ExpectedL.size()); index++)
+	{
+		CHECK(Frames_g[index].Data == ExpectedL[index], "pass %lu us: frame %zu differs", pass, index);
+	}
+
+	CHECK(WorstL <= UPDATE_TIME_LIMIT, "pass %lu us: update() took %.2f us", pass, WorstL);
+
+	// While one pass brings less than the ring holds, lines are out in the pass after the delimiter.
+	bool BoundedL = ((pass * BaudrateL) / 10000000UL) < (SERIAL_INGEST_RING_SIZE - 1);
+	unsigned long MaxLatencyL = 0;
+	size_t FrameL = 0;
+	for (size_t index = 0; index < lines.size(); index++)
+	{
+		FrameL += (lines[index].size() + SERIAL_FRAME_MAX_SIZE - 1) / SERIAL_FRAME_MAX_SIZE;
+		if ((FrameL == 0) || (FrameL > Frames_g.size()))
+		{
+			break;
+		}
+
+		unsigned long LatencyL = Frames_g[FrameL - 1].Time - DoneL[index];
+		MaxLatencyL = std::max(MaxLatencyL, LatencyL);
+		CHECK(!BoundedL || (LatencyL <= pass), "pass %lu us: line %zu latency %lu us", pass, index, LatencyL);
+	}
+
+	printf("delimiter, pass %6lu us: %zu frames, latency max %lu us, update() avg %.2f us, max %.2f us\n",
+		pass, Frames_g.size(), MaxLatencyL, AverageL, WorstL);
+}
+
+/** @brief Idle gap framing, every burst is one frame. */
+static void test_idle_gap(const std::vector<std::string>& lines)
+{
+	ReplayPort PortL;
+	std::vector<std::string> ExpectedL;
+	std::vector<unsigned long> DoneL;
+	const unsigned long BaudrateL = 115200;
+	const unsigned long PassL = 100;
+
+	Now_g = 1000;
+	Frames_g.clear();
+	SerialIngest.init(&PortL);
+	SerialIngest.setDelimiter(SERIAL_FRAME_NO_DELIMITER);
+	SerialIngest.setBaudrate(BaudrateL);
+	SerialIngest.setFrameCb(on_frame);
+
+	unsigned long TimeL = Now_g;
+	for (const std::string& line : lines)
+	{
+		TimeL = PortL.send(line, TimeL, BaudrateL);
+		expect_frames(ExpectedL, line);
+		DoneL.push_back(TimeL);
+
+		// Silence between the messages.
+		TimeL += 3000;
+	}
+
+	double WorstL;
+	run_loop(PortL, PassL, TimeL + 10000UL, &WorstL);
+
+	CHECK(Frames_g.size() == ExpectedL.size(), "idle gap: %zu frames, expected %zu", Frames_g.size(), ExpectedL.size());
+
+	for (size_t index = 0; (index < Frames_g.size()) && (index < ExpectedL.size()); index++)
+	{
+		CHECK(Frames_g[index].Data == ExpectedL[index], "idle gap: frame %zu differs", index);
+	}
+
+	// The last frame of a message closes after the idle gap.
+	size_t FrameL = 0;
+	for (size_t index = 0; index < lines.size(); index++)
+	{
+		FrameL += (lines[index].size() + SERIAL_FRAME_MAX_SIZE - 1) / SERIAL_FRAME_MAX_SIZE;
+		if (FrameL > Frames_g.size())
+		{
+			break;
+		}
+
+		unsigned long LatencyL = Frames_g[FrameL - 1].Time - DoneL[index];
+		CHECK(LatencyL <= DEFAULT_SERIAL_FRAME_IDLE_GAP + (2 * PassL), "idle gap: message %zu latency %lu us", index, LatencyL);
+	}
+
+	printf("idle gap,  pass %6lu us: %zu frames\n", PassL, Frames_g.size());
+}
+
+#pragma endregion
+
+int main(int argc, char** argv)
+{
+	const char* PathL = (argc > 1) ? argv[1] : "fixtures/serial_capture.txt";
+	std::vector<std::string> LinesL = load_capture(PathL);
+
+	if (LinesL.empty())
+	{
+		printf("FAIL no capture in %s\n", PathL);
+		return 1;
+	}
+
+	// Fast loop, slow loop and a loop slow enough to fill the ring.
+	test_delimiter(LinesL, 50);
+	test_delimiter(LinesL, 2000);
+	test_delimiter(LinesL, 100000);
+	test_idle_gap(LinesL);
+
+	printf("%s\n", (Failures_g == 0) ? "PASS" : "FAIL");
+
+	return (Failures_g == 0) ? 0 : 1;
+}